@@ -1,5 +1,16 @@
+#include <cstdlib>
+
 #include "backend/backend.h"
 
 using namespace thdb;
 // 利用backend接口生成可执行程序，实现数据库系统
-int main() { Init(); }
+// 可选参数或环境变量 THDB_CODEC 指定数据文件的压缩方式：none、zero 或 lz
+int main(int argc, char **argv) {
+  const char *sCodec = argc > 1 ? argv[1] : getenv("THDB_CODEC");
+  try {
+    Init(sCodec ? sCodec : "none");
+  } catch (const std::exception &e) {
+    printf("%s\n", e.what());
+    return 1;
+  }
+}
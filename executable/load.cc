@@ -0,0 +1,32 @@
+#include <chrono>
+#include <iostream>
+
+#include "backend/backend.h"
+
+using namespace thdb;
+// 从 CSV 文件批量导入一张表，不经过 SQL 解析器，结束后输出导入速度
+// 用法：thdb_load <table> <file.csv> [delimiter]
+int main(int argc, char **argv) {
+  if (argc < 3 || argc > 4 || (argc == 4 && String(argv[3]).size() != 1)) {
+    std::cerr << "usage: " << argv[0] << " <table> <file.csv> [delimiter]\n";
+    return 1;
+  }
+  char cDelim = argc == 4 ? argv[3][0] : ',';
+  Instance *pDB = new Instance();
+  int nRet = 0;
+  try {
+    auto iBegin = std::chrono::steady_clock::now();
+    Size nRows = pDB->CopyFrom(argv[1], argv[2], cDelim);
+    double fSeconds = std::chrono::duration<double>(
+                          std::chrono::steady_clock::now() - iBegin)
+                          .count();
+    printf("Loaded %u rows in %.3f s (%.0f rows/s)\n", nRows, fSeconds,
+           fSeconds > 0 ? nRows / fSeconds : 0);
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << '\n';
+    nRet = 1;
+  }
+  delete pDB;
+  Close();
+  return nRet;
+}
@@ -1,16 +1,21 @@
 #include "backend/backend.h"
 
+#include <cstdlib>
 #include <fstream>
 
 #include "antlr4-runtime.h"
 #include "exception/exceptions.h"
 #include "macros.h"
+#include "minios/data_file.h"
 #include "minios/os.h"
+#include "minios/page_codec.h"
 #include "page/record_page.h"
 #include "parser/ErrorListener.h"
 #include "parser/SQLLexer.h"
 #include "parser/SQLParser.h"
 #include "parser/SystemVisitor.h"
+#include "record/fixed_record.h"
+#include "utils/arena.h"
 
 namespace thdb {
 
@@ -24,10 +29,16 @@ bool Exists() {
     return false;
 }
 
-void Init() {
+void Init(const String &sCodec) {
   if (Exists()) return;
+  // 创建 MiniOS 之前确定压缩方式，未知的名称抛出异常
+  delete NewPageCodec(sCodec);
   printf("Database Init.\n");
 
+  std::ofstream fout{"THDB_CODEC"};
+  fout << sCodec;
+  fout.close();
+
   RecordPage *pNotUsed1 = new RecordPage(256, true);
   RecordPage *pNotUsed2 = new RecordPage(256, true);
   RecordPage *pTableManagerPage = new RecordPage(TABLE_NAME_SIZE + 4, true);
@@ -54,13 +65,18 @@ void Clear() {
   if (!Exists()) return;
   // std::remove: 
   //     Deletes the file identified by character string pointed to by `fname`
-  std::remove("THDB_BITMAP");
-  std::remove("THDB_PAGE");
+  for (Size i = 0; i < DB_PAGES / SEGMENT_PAGES; ++i) {
+    std::remove(SegmentName("THDB_BITMAP", i).c_str());
+    std::remove(SegmentName("THDB_PAGE", i).c_str());
+    std::remove(SegmentName("THDB_PAGEDIR", i).c_str());
+  }
+  std::remove("THDB_CODEC");
 }
 
 void Help() { printf("Sorry, Help Tips is developing.\n"); }
 
-std::vector<Result *> Execute(Instance *pDB, const String &sSQL) {
+static std::vector<Result *> ExecuteStatement(Instance *pDB,
+                                             const String &sSQL) {
   ANTLRInputStream sInputStream(sSQL);
   SQLLexer iLexer(&sInputStream);
   CommonTokenStream sTokenStream(&iLexer);
@@ -74,4 +90,27 @@ std::vector<Result *> Execute(Instance *pDB, const String &sSQL) {
   return iVisitor.visit(iTree);
 }
 
+static bool UseArena() {
+  const char *sEnv = getenv("THDB_ARENA");
+  return sEnv == nullptr || atoi(sEnv) != 0;
+}
+
+std::vector<Result *> Execute(Instance *pDB, const String &sSQL) {
+  static const bool bArena = UseArena();
+  if (!bArena) return ExecuteStatement(pDB, sSQL);
+  // 语句执行中产生的记录、字段在内存池中分配，
+  // 返回的结果各持有一个引用，全部结果释放后内存池一次性回收
+  Arena *pArena = new Arena();
+  std::vector<Result *> iResVec;
+  try {
+    ArenaScope iScope(pArena);
+    iResVec = ExecuteStatement(pDB, sSQL);
+  } catch (...) {
+    pArena->Unref();
+    throw;
+  }
+  pArena->Unref();
+  return iResVec;
+}
+
 }  // namespace thdb
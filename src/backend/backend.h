@@ -9,7 +9,12 @@
 namespace thdb {
 
 bool Exists();
-void Init();
+/**
+ * @brief 初始化数据库
+ *
+ * @param sCodec 数据文件的压缩方式：none、zero 或 lz，初始化之后不能修改
+ */
+void Init(const String &sCodec = "none");
 void Close();
 void Clear();
 void Help();
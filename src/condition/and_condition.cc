@@ -21,4 +21,25 @@ bool AndCondition::Match(const Record &iRecord) const {
   return true;
 }
 
+bool AndCondition::Match(const RowView &iRow) const {
+  for (const auto &pCond : _iCondVec)
+    if (!pCond->Match(iRow)) return false;
+  return true;
+}
+
+// 每个子条件在前一个子条件留下的槽中继续筛选
+void AndCondition::Filter(RowView &iRow, const uint8_t *pData,
+                          std::vector<SlotID> &iSlotVec) const {
+  for (const auto &pCond : _iCondVec) {
+    if (iSlotVec.empty()) return;
+    pCond->Filter(iRow, pData, iSlotVec);
+  }
+}
+
+bool AndCondition::GetColumns(std::vector<FieldID> &iPosVec) const {
+  for (const auto &pCond : _iCondVec)
+    if (!pCond->GetColumns(iPosVec)) return false;
+  return true;
+}
+
 }  // namespace thdb
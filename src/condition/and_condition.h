@@ -11,6 +11,10 @@ class AndCondition : public Condition {
   AndCondition(const std::vector<Condition *> &iCondVec);
   ~AndCondition();
   bool Match(const Record &iRecord) const override;
+  bool Match(const RowView &iRow) const override;
+  void Filter(RowView &iRow, const uint8_t *pData,
+              std::vector<SlotID> &iSlotVec) const override;
+  bool GetColumns(std::vector<FieldID> &iPosVec) const override;
   void PushBack(Condition *pCond);
 
  private:
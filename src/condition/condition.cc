@@ -4,4 +4,19 @@ namespace thdb {
 
 ConditionType Condition::GetType() const { return ConditionType::SIMPLE_TYPE; }
 
+void Condition::Filter(RowView &iRow, const uint8_t *pData,
+                       std::vector<SlotID> &iSlotVec) const {
+  Size nStride = iRow.GetTotalSize();
+  Size nKept = 0;
+  for (const auto &nSlotID : iSlotVec) {
+    iRow.Reset(pData + nSlotID * nStride);
+    if (Match(iRow)) iSlotVec[nKept++] = nSlotID;
+  }
+  iSlotVec.resize(nKept);
+}
+
+bool Condition::GetColumns(std::vector<FieldID> &iPosVec) const {
+  return false;
+}
+
 }  // namespace thdb
@@ -2,6 +2,7 @@
 #define THDB_CONDITION_H_
 
 #include "record/record.h"
+#include "record/row_view.h"
 
 // 用于条件检索的抽象类，实现统一的匹配函数
 namespace thdb {
@@ -23,7 +24,31 @@ class Condition {
    * @return false 不符合
    */
   virtual bool Match(const Record &iRecord) const = 0;
+  /**
+   * @brief 判断定长格式化的记录是否符合当前条件，不需要构建 Record
+   *
+   * @param iRow 指向记录原始内容的视图
+   */
+  virtual bool Match(const RowView &iRow) const = 0;
+  /**
+   * @brief 批量判断一个页面中的定长记录，扫描时每个页面调用一次。
+   * 逐条判断的循环在具体条件内部按列类型展开，每条记录不再经过虚函数调用，
+   * 默认实现逐条调用 Match(const RowView &)
+   *
+   * @param iRow 记录的布局，调用中会依次指向各条记录
+   * @param pData 槽 i 的记录从 pData + i * iRow.GetTotalSize() 开始
+   * @param iSlotVec 递增的候选槽编号，结束时只保留符合条件的槽
+   */
+  virtual void Filter(RowView &iRow, const uint8_t *pData,
+                      std::vector<SlotID> &iSlotVec) const;
   virtual ConditionType GetType() const;
+  /**
+   * @brief 追加 Match 需要读取的字段位置，列存页面只读取这些列
+   *
+   * @param iPosVec 字段位置，可能重复
+   * @return false 无法确定需要的字段，调用者需要提供完整的记录
+   */
+  virtual bool GetColumns(std::vector<FieldID> &iPosVec) const;
 };
 
 }  // namespace thdb
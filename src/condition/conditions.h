@@ -3,4 +3,5 @@
 #include "join_condition.h"
 #include "not_condition.h"
 #include "or_condition.h"
-#include "range_condition.h"
\ No newline at end of file
+#include "range_condition.h"
+#include "string_range_condition.h"
\ No newline at end of file
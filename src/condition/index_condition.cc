@@ -3,24 +3,56 @@
 #include <assert.h>
 #include <math.h>
 
+#include <algorithm>
+
+#include "exception/exceptions.h"
+
 namespace thdb {
 
+// 索引中 TINYINT、SMALLINT、INT 的键都是 IntField，边界截断到 int 的范围
+static Field *IntegerBound(int64_t nVal, FieldType iType) {
+  if (iType == FieldType::BIGINT_TYPE) return new BigIntField(nVal);
+  if (nVal < INT32_MIN) nVal = INT32_MIN;
+  if (nVal > INT32_MAX) nVal = INT32_MAX;
+  return new IntField((int)nVal);
+}
+
 IndexCondition::IndexCondition(const String &sTableName, const String &sColName,
                                double fMin, double fMax, FieldType iType)
     : _sTableName(sTableName), _sColName(sColName) {
-  if (iType == FieldType::INT_TYPE) {
-    int dMin = (fMin < INT32_MIN) ? INT32_MIN : (ceil(fMin));
-    int dMax = (fMax > INT32_MAX) ? INT32_MAX : (ceil(fMax));
-    _pLow = new IntField(dMin);
-    _pHigh = new IntField(dMax);
+  if (IsIntegerType(iType)) {
+    _pLow = IntegerBound(CeilToInteger(fMin), iType);
+    _pHigh = IntegerBound(CeilToInteger(fMax), iType);
   } else if (iType == FieldType::FLOAT_TYPE) {
     _pLow = new FloatField(fMin);
     _pHigh = new FloatField(fMax);
   } else {
-    assert(false);
+    throw IndexTypeException();
   }
 }
 
+IndexCondition::IndexCondition(const String &sTableName, const String &sColName,
+                               int64_t nMin, int64_t nMax, FieldType iType,
+                               bool)
+    : _sTableName(sTableName), _sColName(sColName), _bClosed(true) {
+  assert(IsIntegerType(iType));
+  // 截断后两端都在列的取值范围内，空区间统一为[1, 0]
+  int64_t nTypeMin, nTypeMax;
+  GetIntegerRange(iType, nTypeMin, nTypeMax);
+  nMin = std::max(nMin, nTypeMin);
+  nMax = std::min(nMax, nTypeMax);
+  if (nMin > nMax) nMin = 1, nMax = 0;
+  _pLow = IntegerBound(nMin, iType);
+  _pHigh = IntegerBound(nMax, iType);
+}
+
+IndexCondition::IndexCondition(const String &sTableName, const String &sColName,
+                               const String &sMin, const String &sMax)
+    : _sTableName(sTableName), _sColName(sColName) {
+  _pLow = new StringField(sMin);
+  _pHigh = new StringField(sMax);
+}
+
 IndexCondition::~IndexCondition() {
   delete _pLow;
   delete _pHigh;
@@ -28,6 +60,11 @@ IndexCondition::~IndexCondition() {
 
 bool IndexCondition::Match(const Record &iRecord) const { return true; }
 
+bool IndexCondition::Match(const RowView &iRow) const { return true; }
+
+void IndexCondition::Filter(RowView &iRow, const uint8_t *pData,
+                            std::vector<SlotID> &iSlotVec) const {}
+
 ConditionType IndexCondition::GetType() const {
   return ConditionType::INDEX_TYPE;
 }
@@ -40,4 +77,11 @@ std::pair<Field *, Field *> IndexCondition::GetIndexRange() const {
   return {_pLow, _pHigh};
 }
 
+bool IndexCondition::IsClosed() const { return _bClosed; }
+
+// 由索引完成检索，Match 不读取字段
+bool IndexCondition::GetColumns(std::vector<FieldID> &iPosVec) const {
+  return true;
+}
+
 }  // namespace thdb
@@ -10,17 +10,37 @@ class IndexCondition : public Condition {
  public:
   IndexCondition(const String &sTableName, const String &sColName, double fMin,
                  double fMax, FieldType iType);
+  /**
+   * @brief 整数索引上的范围条件，闭区间[nMin, nMax]，先截断到列类型的取值范围，
+   * nMin > nMax 时不匹配任何值，bool参数只是为了重载
+   */
+  IndexCondition(const String &sTableName, const String &sColName,
+                 int64_t nMin, int64_t nMax, FieldType iType, bool);
+  /**
+   * @brief 字符串索引上的范围条件，左闭右开区间[sMin, sMax)
+   */
+  IndexCondition(const String &sTableName, const String &sColName,
+                 const String &sMin, const String &sMax);
   ~IndexCondition();
 
   bool Match(const Record &iRecord) const override;
+  bool Match(const RowView &iRow) const override;
+  void Filter(RowView &iRow, const uint8_t *pData,
+              std::vector<SlotID> &iSlotVec) const override;
+  bool GetColumns(std::vector<FieldID> &iPosVec) const override;
   ConditionType GetType() const override;
 
   std::pair<String, String> GetIndexName() const;
   std::pair<Field *, Field *> GetIndexRange() const;
+  /**
+   * @brief 范围是否包含上界，只有整数索引上的条件包含上界
+   */
+  bool IsClosed() const;
 
  private:
   String _sTableName, _sColName;
   Field *_pLow, *_pHigh;
+  bool _bClosed = false;
 };
 
 }  // namespace thdb
@@ -12,8 +12,14 @@ JoinCondition::JoinCondition(const String &sTableA, const String &sColA,
 
 bool JoinCondition::Match(const Record &iRecord) const { return true; }
 
+bool JoinCondition::Match(const RowView &iRow) const { return true; }
+
 ConditionType JoinCondition::GetType() const {
   return ConditionType::JOIN_TYPE;
 }
 
+bool JoinCondition::GetColumns(std::vector<FieldID> &iPosVec) const {
+  return true;
+}
+
 }  // namespace thdb
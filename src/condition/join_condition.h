@@ -13,6 +13,8 @@ class JoinCondition : public Condition {
                 const String &sTableB, const String &sColB);
   ~JoinCondition() = default;
   bool Match(const Record &iRecord) const override;
+  bool Match(const RowView &iRow) const override;
+  bool GetColumns(std::vector<FieldID> &iPosVec) const override;
   ConditionType GetType() const override;
   String sTableA, sTableB;
   String sColA, sColB;
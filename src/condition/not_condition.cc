@@ -1,12 +1,49 @@
 #include "condition/not_condition.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace thdb {
-NotCondition::NotCondition(Condition *pCond) : _pCond(pCond) {}
+NotCondition::NotCondition(Condition *pCond)
+    : _pCond(pCond), _bColumn(false), _nPos(0) {}
+
+NotCondition::NotCondition(Condition *pCond, FieldID nPos)
+    : _pCond(pCond), _bColumn(true), _nPos(nPos) {}
 
 NotCondition::~NotCondition() { delete _pCond; }
 
 bool NotCondition::Match(const Record &iRecord) const {
+  if (_bColumn && iRecord.GetField(_nPos)->GetType() == FieldType::NONE_TYPE)
+    return false;
   return !_pCond->Match(iRecord);
 }
 
+bool NotCondition::Match(const RowView &iRow) const {
+  if (_bColumn && iRow.IsNull(_nPos)) return false;
+  return !_pCond->Match(iRow);
+}
+
+void NotCondition::Filter(RowView &iRow, const uint8_t *pData,
+                          std::vector<SlotID> &iSlotVec) const {
+  // 先去掉该列为空的记录，页面中没有空值时跳过
+  if (_bColumn && iRow.MayHaveNull()) {
+    Size nStride = iRow.GetTotalSize();
+    Size nKept = 0;
+    for (const auto &nSlotID : iSlotVec) {
+      const uint8_t *pRow = pData + nSlotID * nStride;
+      if (!((pRow[_nPos / 8] >> (_nPos % 8)) & 1)) iSlotVec[nKept++] = nSlotID;
+    }
+    iSlotVec.resize(nKept);
+  }
+  std::vector<SlotID> iPart = iSlotVec, iResult;
+  _pCond->Filter(iRow, pData, iPart);
+  std::set_difference(iSlotVec.begin(), iSlotVec.end(), iPart.begin(),
+                      iPart.end(), std::back_inserter(iResult));
+  iSlotVec.swap(iResult);
+}
+
+bool NotCondition::GetColumns(std::vector<FieldID> &iPosVec) const {
+  return _pCond->GetColumns(iPosVec);
+}
+
 }  // namespace thdb
@@ -7,11 +7,22 @@ namespace thdb {
 class NotCondition : public Condition {
  public:
   NotCondition(Condition *pCond);
+  /**
+   * @brief 对 nPos 列上比较条件的否定，用于 <>。
+   * 与 NULL 的比较结果未知，取反后仍然未知，所以该列为空的记录不满足条件
+   */
+  NotCondition(Condition *pCond, FieldID nPos);
   ~NotCondition();
   bool Match(const Record &iRecord) const override;
+  bool Match(const RowView &iRow) const override;
+  void Filter(RowView &iRow, const uint8_t *pData,
+              std::vector<SlotID> &iSlotVec) const override;
+  bool GetColumns(std::vector<FieldID> &iPosVec) const override;
 
  private:
   Condition *_pCond;
+  bool _bColumn;
+  FieldID _nPos;
 };
 }  // namespace thdb
 
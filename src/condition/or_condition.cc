@@ -1,5 +1,8 @@
 #include "condition/or_condition.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace thdb {
 
 OrCondition::OrCondition(const std::vector<Condition *> &iCondVec)
@@ -21,4 +24,31 @@ bool OrCondition::Match(const Record &iRecord) const {
   return false;
 }
 
+bool OrCondition::Match(const RowView &iRow) const {
+  for (const auto &pCond : _iCondVec)
+    if (pCond->Match(iRow)) return true;
+  return false;
+}
+
+// 每个子条件分别从全部候选槽中筛选，结果按槽编号合并
+void OrCondition::Filter(RowView &iRow, const uint8_t *pData,
+                         std::vector<SlotID> &iSlotVec) const {
+  std::vector<SlotID> iResult, iPart, iMerged;
+  for (const auto &pCond : _iCondVec) {
+    iPart = iSlotVec;
+    pCond->Filter(iRow, pData, iPart);
+    iMerged.clear();
+    std::set_union(iResult.begin(), iResult.end(), iPart.begin(), iPart.end(),
+                   std::back_inserter(iMerged));
+    iResult.swap(iMerged);
+  }
+  iSlotVec.swap(iResult);
+}
+
+bool OrCondition::GetColumns(std::vector<FieldID> &iPosVec) const {
+  for (const auto &pCond : _iCondVec)
+    if (!pCond->GetColumns(iPosVec)) return false;
+  return true;
+}
+
 }  // namespace thdb
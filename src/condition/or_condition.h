@@ -10,6 +10,10 @@ class OrCondition : public Condition {
   OrCondition(const std::vector<Condition *> &iCondVec);
   ~OrCondition();
   bool Match(const Record &iRecord) const override;
+  bool Match(const RowView &iRow) const override;
+  void Filter(RowView &iRow, const uint8_t *pData,
+              std::vector<SlotID> &iSlotVec) const override;
+  bool GetColumns(std::vector<FieldID> &iPosVec) const override;
   void PushBack(Condition *pCond);
 
  private:
@@ -1,33 +1,117 @@
 #include "condition/range_condition.h"
 
-#include <assert.h>
-
 #include <cmath>
+#include <cstring>
 
+#include "exception/exceptions.h"
 #include "field/fields.h"
 
 namespace thdb {
-RangeCondition::RangeCondition(FieldID nPos, const double &fMin,
-                               const double &fMax)
-    : _nPos(nPos), _fMin(fMin), _fMax(fMax) {}
+
+RangeCondition::Kind RangeCondition::GetKind(FieldType iType) {
+  switch (iType) {
+    case FieldType::TINYINT_TYPE:
+      return Kind::INT8;
+    case FieldType::SMALLINT_TYPE:
+      return Kind::INT16;
+    case FieldType::INT_TYPE:
+      return Kind::INT32;
+    case FieldType::BIGINT_TYPE:
+      return Kind::INT64;
+    case FieldType::FLOAT_TYPE:
+      return Kind::FLOAT64;
+    default:
+      // 字符串列上的范围条件由 StringRangeCondition 处理
+      throw RecordTypeException();
+  }
+}
+
+RangeCondition::RangeCondition(FieldID nPos, FieldType iType,
+                               const double &fMin, const double &fMax)
+    : _nPos(nPos), _iKind(GetKind(iType)), _fMin(fMin), _fMax(fMax) {
+  // 整数列的范围在建立条件时换算一次，[fMin, fMax) 中的整数即闭区间
+  // [ceil(fMin), ceil(fMax) - 1]；截断到 INT64_MAX 的上界仍然包含 INT64_MAX
+  _nMin = CeilToInteger(_fMin);
+  _nMax = CeilToInteger(_fMax);
+  if (_fMax < (double)INT64_MAX) {
+    if (_nMax == INT64_MIN)
+      _nMin = INT64_MAX;
+    else
+      --_nMax;
+  }
+}
+
+RangeCondition::RangeCondition(FieldID nPos, FieldType iType, int64_t nMin,
+                               int64_t nMax, bool)
+    : _nPos(nPos),
+      _iKind(GetKind(iType)),
+      _fMin(nMin),
+      _fMax(nMax),
+      _nMin(nMin),
+      _nMax(nMax) {}
 
 bool RangeCondition::Match(const Record &iRecord) const {
   Field *pField = iRecord.GetField(_nPos);
   if (pField->GetType() == FieldType::NONE_TYPE) return false;
-  if (pField->GetType() == FieldType::INT_TYPE) {
-    auto pIntField = dynamic_cast<IntField *>(pField);
-    int dData = pIntField->GetIntData();
-    int fMin = (_fMin < INT32_MIN) ? INT32_MIN : (ceil(_fMin));
-    int fMax = (_fMax > INT32_MAX) ? INT32_MAX : (ceil(_fMax));
-    return (dData >= fMin) && (dData < fMax);
-  } else if (pField->GetType() == FieldType::FLOAT_TYPE) {
-    auto pFloatField = dynamic_cast<FloatField *>(pField);
-    double fData = pFloatField->GetFloatData();
-    return (fData >= _fMin) && (fData < _fMax);
-  } else {
-    // TODO: Throw Error Here
-    assert(false);
+  // TINYINT、SMALLINT、INT 的值都是 IntField
+  if (_iKind == Kind::FLOAT64)
+    return MatchFloat(static_cast<FloatField *>(pField)->GetFloatData());
+  if (_iKind == Kind::INT64)
+    return MatchInt(static_cast<BigIntField *>(pField)->GetBigIntData());
+  return MatchInt(static_cast<IntField *>(pField)->GetIntData());
+}
+
+bool RangeCondition::Match(const RowView &iRow) const {
+  if (iRow.IsNull(_nPos)) return false;
+  if (_iKind == Kind::FLOAT64) return MatchFloat(iRow.GetFloat(_nPos));
+  return MatchInt(iRow.GetBigInt(_nPos));
+}
+
+// 按存储类型 T 展开的筛选循环，空值不在任何范围内。
+// 整数列使用闭区间[nMin, nMax]，浮点数列使用左闭右开区间[nMin, nMax)
+template <typename T, typename B, bool bClosed>
+static void FilterValues(const RowView &iRow, FieldID nPos,
+                         const uint8_t *pData, B nMin, B nMax,
+                         std::vector<SlotID> &iSlotVec) {
+  Size nStride = iRow.GetTotalSize();
+  Size nOffset = iRow.GetOffset(nPos);
+  bool bNullable = iRow.MayHaveNull();
+  Size nKept = 0;
+  for (const auto &nSlotID : iSlotVec) {
+    const uint8_t *pRow = pData + nSlotID * nStride;
+    if (bNullable && ((pRow[nPos / 8] >> (nPos % 8)) & 1)) continue;
+    T nVal;
+    memcpy(&nVal, pRow + nOffset, sizeof(T));
+    if ((B)nVal >= nMin && (bClosed ? (B)nVal <= nMax : (B)nVal < nMax))
+      iSlotVec[nKept++] = nSlotID;
+  }
+  iSlotVec.resize(nKept);
+}
+
+void RangeCondition::Filter(RowView &iRow, const uint8_t *pData,
+                            std::vector<SlotID> &iSlotVec) const {
+  switch (_iKind) {
+    case Kind::INT8:
+      return FilterValues<int8_t, int64_t, true>(iRow, _nPos, pData, _nMin,
+                                                 _nMax, iSlotVec);
+    case Kind::INT16:
+      return FilterValues<int16_t, int64_t, true>(iRow, _nPos, pData, _nMin,
+                                                  _nMax, iSlotVec);
+    case Kind::INT32:
+      return FilterValues<int32_t, int64_t, true>(iRow, _nPos, pData, _nMin,
+                                                  _nMax, iSlotVec);
+    case Kind::INT64:
+      return FilterValues<int64_t, int64_t, true>(iRow, _nPos, pData, _nMin,
+                                                  _nMax, iSlotVec);
+    case Kind::FLOAT64:
+      return FilterValues<double, double, false>(iRow, _nPos, pData, _fMin,
+                                                 _fMax, iSlotVec);
   }
 }
 
+bool RangeCondition::GetColumns(std::vector<FieldID> &iPosVec) const {
+  iPosVec.push_back(_nPos);
+  return true;
+}
+
 }  // namespace thdb
@@ -10,17 +10,47 @@ namespace thdb {
 
 /**
  * @brief 范围检索的条件
- * 
+ * 建立时按列类型选择值的读取方式，扫描时按页面批量判断，
+ * 循环内直接从记录的原始内容中读取对应宽度的值
  */
 class RangeCondition : public Condition {
  public:
-  RangeCondition(FieldID nPos, const double &fMin, const double &fMax);
+  /**
+   * @brief 整数或浮点数列上的范围条件，左闭右开区间[fMin, fMax)
+   * @param iType 列的类型，不是数值类型时抛出 RecordTypeException
+   */
+  RangeCondition(FieldID nPos, FieldType iType, const double &fMin,
+                 const double &fMax);
+  /**
+   * @brief 整数列上的范围条件，闭区间[nMin, nMax]，值不经过 double，
+   * nMin > nMax 时不匹配任何值，bool参数只是为了重载
+   */
+  RangeCondition(FieldID nPos, FieldType iType, int64_t nMin, int64_t nMax,
+                 bool);
   ~RangeCondition() = default;
   bool Match(const Record &iRecord) const override;
+  bool Match(const RowView &iRow) const override;
+  void Filter(RowView &iRow, const uint8_t *pData,
+              std::vector<SlotID> &iSlotVec) const override;
+  bool GetColumns(std::vector<FieldID> &iPosVec) const override;
 
  private:
+  // 列在定长格式中的存储类型
+  enum class Kind { INT8, INT16, INT32, INT64, FLOAT64 };
+  static Kind GetKind(FieldType iType);
+
+  bool MatchInt(int64_t nData) const {
+    return (nData >= _nMin) && (nData <= _nMax);
+  }
+  bool MatchFloat(double fData) const {
+    return (fData >= _fMin) && (fData < _fMax);
+  }
+
   uint32_t _nPos = 0xFFFF;
+  Kind _iKind;
   double _fMin = DBL_MIN, _fMax = DBL_MAX;
+  // 整数列的闭区间
+  int64_t _nMin, _nMax;
 };
 
 }  // namespace thdb
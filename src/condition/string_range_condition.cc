@@ -0,0 +1,49 @@
+#include "condition/string_range_condition.h"
+
+#include "field/fields.h"
+
+namespace thdb {
+
+StringRangeCondition::StringRangeCondition(FieldID nPos, const String &sMin,
+                                           const String &sMax)
+    : _nPos(nPos), _sMin(sMin), _sMax(sMax) {}
+
+bool StringRangeCondition::MatchString(const char *pData, Size nSize) const {
+  // 直接与字段内容比较，不构造临时字符串
+  return _sMin.compare(0, String::npos, pData, nSize) <= 0 &&
+         _sMax.compare(0, String::npos, pData, nSize) > 0;
+}
+
+bool StringRangeCondition::Match(const Record &iRecord) const {
+  Field *pField = iRecord.GetField(_nPos);
+  if (pField->GetType() != FieldType::STRING_TYPE) return false;
+  const String &sData = static_cast<StringField *>(pField)->GetString();
+  return MatchString(sData.data(), sData.size());
+}
+
+bool StringRangeCondition::Match(const RowView &iRow) const {
+  if (iRow.GetType(_nPos) != FieldType::STRING_TYPE || iRow.IsNull(_nPos))
+    return false;
+  return MatchString(iRow.GetString(_nPos), iRow.GetStringSize(_nPos));
+}
+
+// 条件只用于字符串列，循环内不再检查列类型
+void StringRangeCondition::Filter(RowView &iRow, const uint8_t *pData,
+                                  std::vector<SlotID> &iSlotVec) const {
+  Size nStride = iRow.GetTotalSize();
+  Size nKept = 0;
+  for (const auto &nSlotID : iSlotVec) {
+    iRow.Reset(pData + nSlotID * nStride);
+    if (iRow.IsNull(_nPos)) continue;
+    if (MatchString(iRow.GetString(_nPos), iRow.GetStringSize(_nPos)))
+      iSlotVec[nKept++] = nSlotID;
+  }
+  iSlotVec.resize(nKept);
+}
+
+bool StringRangeCondition::GetColumns(std::vector<FieldID> &iPosVec) const {
+  iPosVec.push_back(_nPos);
+  return true;
+}
+
+}  // namespace thdb
@@ -0,0 +1,32 @@
+#ifndef THDB_STRING_RANGE_CONDITION_H_
+#define THDB_STRING_RANGE_CONDITION_H_
+
+#include "condition/condition.h"
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief 字符串列的范围检索条件，左闭右开区间[sMin, sMax)
+ * 按字节比较，与字符串索引中键的顺序一致
+ */
+class StringRangeCondition : public Condition {
+ public:
+  StringRangeCondition(FieldID nPos, const String &sMin, const String &sMax);
+  ~StringRangeCondition() = default;
+  bool Match(const Record &iRecord) const override;
+  bool Match(const RowView &iRow) const override;
+  void Filter(RowView &iRow, const uint8_t *pData,
+              std::vector<SlotID> &iSlotVec) const override;
+  bool GetColumns(std::vector<FieldID> &iPosVec) const override;
+
+ private:
+  bool MatchString(const char *pData, Size nSize) const;
+
+  FieldID _nPos;
+  String _sMin, _sMax;
+};
+
+}  // namespace thdb
+
+#endif
@@ -5,3 +5,4 @@
 #include "special_exception.h"
 #include "table_exception.h"
 #include "index_exception.h"
+#include "load_exception.h"
@@ -0,0 +1,22 @@
+#ifndef THDB_LOAD_EXCEPTION_H_
+#define THDB_LOAD_EXCEPTION_H_
+
+#include "defines.h"
+#include "exception/exception.h"
+
+namespace thdb {
+
+class LoadException : public Exception {
+ public:
+  LoadException(const String& sMsg) : _sMsg(sMsg) {}
+  LoadException(Size nLine, const String& sMsg)
+      : _sMsg("line " + std::to_string(nLine) + ": " + sMsg) {}
+  const char* what() const throw() { return _sMsg.c_str(); }
+
+ private:
+  String _sMsg;
+};
+
+}  // namespace thdb
+
+#endif
@@ -34,6 +34,36 @@ class PageOutOfSizeException : public OsException {
   virtual const char* what() const throw() { return "Page out of size"; }
 };
 
+class BufferPoolFullException : public OsException {
+ public:
+  virtual const char* what() const throw() {
+    return "No unpinned frame in buffer pool";
+  }
+};
+
+class PageIOException : public OsException {
+ public:
+  PageIOException(PageID pid) : _pid(pid) {
+    _msg = "Page " + std::to_string(_pid) + " I/O failed";
+  }
+  virtual const char* what() const throw() { return _msg.c_str(); }
+
+ private:
+  PageID _pid;
+  String _msg;
+};
+
+class PageCodecException : public OsException {
+ public:
+  PageCodecException(const String& sName) {
+    _msg = "Unknown page codec " + sName;
+  }
+  virtual const char* what() const throw() { return _msg.c_str(); }
+
+ private:
+  String _msg;
+};
+
 }  // namespace thdb
 
 #endif
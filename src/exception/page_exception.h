@@ -22,11 +22,32 @@ class RecordPageException : public PageException {
   String _msg;
 };
 
+class RecordSizeException : public PageException {
+ public:
+  RecordSizeException(Size nSize) : _nSize(nSize) {
+    _msg = "Record of " + std::to_string(_nSize) + " bytes exceeds page size";
+  }
+  virtual const char* what() const throw() { return _msg.c_str(); }
+ private:
+  Size _nSize;
+  String _msg;
+};
+
 class RecordTypeException : public PageException {
  public:
   virtual const char* what() const throw() { return "Unknown record type";; }
 };
 
+class RecordValueException : public PageException {
+ public:
+  RecordValueException(const String& sValue, FieldType iType) {
+    _msg = "Value " + sValue + " is out of range for " + toString(iType);
+  }
+  virtual const char* what() const throw() { return _msg.c_str(); }
+ private:
+  String _msg;
+};
+
 }  // namespace thdb
 
 #endif
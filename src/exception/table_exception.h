@@ -36,6 +36,13 @@ class TableExistException : public TableException {
   String _msg;
 };
 
+class TableBusyException : public TableException {
+ public:
+  virtual const char* what() const throw() {
+    return "table cannot be vacuumed while transactions are active";
+  }
+};
+
 }  // namespace thdb
 
 #endif
@@ -0,0 +1,31 @@
+#include "big_int_field.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace thdb {
+
+BigIntField::BigIntField(const int64_t &nData) : _nData(nData) {}
+
+BigIntField::BigIntField(const uint8_t *src, Size nSize) {
+  assert(nSize == 8);
+  memcpy((uint8_t *)&_nData, src, nSize);
+}
+
+void BigIntField::SetData(const uint8_t *src, Size nSize) {
+  assert(nSize == 8);
+  memcpy((uint8_t *)&_nData, src, nSize);
+}
+
+void BigIntField::GetData(uint8_t *dst, Size nSize) const {
+  assert(nSize == 8);
+  memcpy(dst, (uint8_t *)&_nData, nSize);
+}
+
+FieldType BigIntField::GetType() const { return FieldType::BIGINT_TYPE; }
+
+String BigIntField::ToString() const { return std::to_string(_nData); }
+
+Field *BigIntField::Copy() const { return new BigIntField(_nData); }
+
+}  // namespace thdb
@@ -0,0 +1,33 @@
+#ifndef THDB_BIG_INT_FIELD_H_
+#define THDB_BIG_INT_FIELD_H_
+
+#include "field.h"
+
+namespace thdb {
+
+// BIGINT 列的值，以8字节保存
+class BigIntField : public Field {
+ public:
+  BigIntField() = default;
+  BigIntField(const int64_t &nData);
+  BigIntField(const uint8_t *src, Size nSize);
+  ~BigIntField() = default;
+
+  void SetData(const uint8_t *src, Size nSize) override;
+  void GetData(uint8_t *dst, Size nSize) const override;
+
+  FieldType GetType() const override;
+
+  String ToString() const override;
+
+  Field *Copy() const override;
+
+  int64_t GetBigIntData() const { return _nData; }
+
+ private:
+  int64_t _nData;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_BIG_INT_FIELD_H_
@@ -1,49 +1,131 @@
-#include <assert.h>
+#include "field/compare.h"
 
-#include "field/fields.h"
+#include <algorithm>
 
 namespace thdb {
 
-bool Less(Field *pA, Field *pB, FieldType iType) {
-  if (iType == FieldType::INT_TYPE) {
-    IntField *pIntA = dynamic_cast<IntField *>(pA);
-    IntField *pIntB = dynamic_cast<IntField *>(pB);
-    return *pIntA < *pIntB;
-  } else if (iType == FieldType::FLOAT_TYPE) {
-    FloatField *pFloatA = dynamic_cast<FloatField *>(pA);
-    FloatField *pFloatB = dynamic_cast<FloatField *>(pB);
-    return *pFloatA < *pFloatB;
-  } else {
-    return false;
+FieldComparator::FieldComparator(FieldType iType) {
+  if (IsIntType(iType))
+    _iKind = Kind::INT;
+  else if (iType == FieldType::BIGINT_TYPE)
+    _iKind = Kind::BIGINT;
+  else if (iType == FieldType::FLOAT_TYPE)
+    _iKind = Kind::FLOAT;
+  else if (iType == FieldType::STRING_TYPE)
+    _iKind = Kind::STRING;
+  else
+    _iKind = Kind::NONE;
+}
+
+template <typename T>
+static Size TypedLowerBound(const std::vector<Field *> &iKeyVec,
+                            const Field *pKey) {
+  Size nBegin = 0, nEnd = iKeyVec.size();
+  while (nBegin < nEnd) {
+    Size nMid = (nBegin + nEnd) / 2;
+    if (!TypedCompare<T>::Less(iKeyVec[nMid], pKey))
+      nEnd = nMid;
+    else
+      nBegin = nMid + 1;
   }
+  return nBegin;
 }
 
-bool Equal(Field *pA, Field *pB, FieldType iType) {
-  if (iType == FieldType::INT_TYPE) {
-    IntField *pIntA = dynamic_cast<IntField *>(pA);
-    IntField *pIntB = dynamic_cast<IntField *>(pB);
-    return *pIntA == *pIntB;
-  } else if (iType == FieldType::FLOAT_TYPE) {
-    FloatField *pFloatA = dynamic_cast<FloatField *>(pA);
-    FloatField *pFloatB = dynamic_cast<FloatField *>(pB);
-    return *pFloatA == *pFloatB;
-  } else {
-    return false;
+template <typename T>
+static Size TypedUpperBound(const std::vector<Field *> &iKeyVec,
+                            const Field *pKey) {
+  Size nBegin = 0, nEnd = iKeyVec.size();
+  while (nBegin < nEnd) {
+    Size nMid = (nBegin + nEnd) / 2;
+    if (TypedCompare<T>::Less(pKey, iKeyVec[nMid]))
+      nEnd = nMid;
+    else
+      nBegin = nMid + 1;
   }
+  return nBegin;
 }
 
-bool Greater(Field *pA, Field *pB, FieldType iType) {
-  if (iType == FieldType::INT_TYPE) {
-    IntField *pIntA = dynamic_cast<IntField *>(pA);
-    IntField *pIntB = dynamic_cast<IntField *>(pB);
-    return *pIntA > *pIntB;
-  } else if (iType == FieldType::FLOAT_TYPE) {
-    FloatField *pFloatA = dynamic_cast<FloatField *>(pA);
-    FloatField *pFloatB = dynamic_cast<FloatField *>(pB);
-    return *pFloatA > *pFloatB;
-  } else {
-    return false;
+template <typename T>
+static void TypedSort(std::vector<std::pair<Field *, PageSlotID>> &iEntryVec) {
+  std::stable_sort(iEntryVec.begin(), iEntryVec.end(),
+                   [](const std::pair<Field *, PageSlotID> &a,
+                      const std::pair<Field *, PageSlotID> &b) {
+                     return TypedCompare<T>::Less(a.first, b.first);
+                   });
+}
+
+Size FieldComparator::LowerBound(const std::vector<Field *> &iKeyVec,
+                                 const Field *pKey) const {
+  switch (_iKind) {
+    case Kind::INT:
+      return TypedLowerBound<IntField>(iKeyVec, pKey);
+    case Kind::BIGINT:
+      return TypedLowerBound<BigIntField>(iKeyVec, pKey);
+    case Kind::FLOAT:
+      return TypedLowerBound<FloatField>(iKeyVec, pKey);
+    case Kind::STRING:
+      return TypedLowerBound<StringField>(iKeyVec, pKey);
+    default:
+      return iKeyVec.size();
+  }
+}
+
+Size FieldComparator::UpperBound(const std::vector<Field *> &iKeyVec,
+                                 const Field *pKey) const {
+  switch (_iKind) {
+    case Kind::INT:
+      return TypedUpperBound<IntField>(iKeyVec, pKey);
+    case Kind::BIGINT:
+      return TypedUpperBound<BigIntField>(iKeyVec, pKey);
+    case Kind::FLOAT:
+      return TypedUpperBound<FloatField>(iKeyVec, pKey);
+    case Kind::STRING:
+      return TypedUpperBound<StringField>(iKeyVec, pKey);
+    default:
+      return 0;
+  }
+}
+
+void FieldComparator::Sort(
+    std::vector<std::pair<Field *, PageSlotID>> &iEntryVec) const {
+  switch (_iKind) {
+    case Kind::INT:
+      return TypedSort<IntField>(iEntryVec);
+    case Kind::BIGINT:
+      return TypedSort<BigIntField>(iEntryVec);
+    case Kind::FLOAT:
+      return TypedSort<FloatField>(iEntryVec);
+    case Kind::STRING:
+      return TypedSort<StringField>(iEntryVec);
+    default:
+      return;
   }
 }
 
+static const FieldComparator INT_COMPARATOR(FieldType::INT_TYPE);
+static const FieldComparator BIGINT_COMPARATOR(FieldType::BIGINT_TYPE);
+static const FieldComparator FLOAT_COMPARATOR(FieldType::FLOAT_TYPE);
+static const FieldComparator STRING_COMPARATOR(FieldType::STRING_TYPE);
+static const FieldComparator NONE_COMPARATOR(FieldType::NONE_TYPE);
+
+const FieldComparator &GetComparator(FieldType iType) {
+  if (IsIntType(iType)) return INT_COMPARATOR;
+  if (iType == FieldType::BIGINT_TYPE) return BIGINT_COMPARATOR;
+  if (iType == FieldType::FLOAT_TYPE) return FLOAT_COMPARATOR;
+  if (iType == FieldType::STRING_TYPE) return STRING_COMPARATOR;
+  return NONE_COMPARATOR;
+}
+
+bool Less(Field *pA, Field *pB, FieldType iType) {
+  return GetComparator(iType).Less(pA, pB);
+}
+
+bool Equal(Field *pA, Field *pB, FieldType iType) {
+  return GetComparator(iType).Equal(pA, pB);
+}
+
+bool Greater(Field *pA, Field *pB, FieldType iType) {
+  return GetComparator(iType).Greater(pA, pB);
+}
+
 }  // namespace thdb
\ No newline at end of file
@@ -1,8 +1,123 @@
+#ifndef THDB_COMPARE_H_
+#define THDB_COMPARE_H_
+
+#include <utility>
+#include <vector>
+
+#include "defines.h"
+#include "field/big_int_field.h"
 #include "field/field.h"
+#include "field/float_field.h"
+#include "field/int_field.h"
+#include "field/string_field.h"
 
 namespace thdb {
 
+inline int FieldValue(const IntField *pField) { return pField->GetIntData(); }
+inline int64_t FieldValue(const BigIntField *pField) {
+  return pField->GetBigIntData();
+}
+inline double FieldValue(const FloatField *pField) {
+  return pField->GetFloatData();
+}
+inline const String &FieldValue(const StringField *pField) {
+  return pField->GetString();
+}
+
+/**
+ * @brief 按字段类型特化的比较，调用者保证两个字段都是 T 类型，
+ * 直接比较字段中的值，不检查类型也不使用 dynamic_cast
+ */
+template <typename T>
+struct TypedCompare {
+  static bool Less(const Field *pA, const Field *pB) {
+    return FieldValue(static_cast<const T *>(pA)) <
+           FieldValue(static_cast<const T *>(pB));
+  }
+  static bool Equal(const Field *pA, const Field *pB) {
+    return FieldValue(static_cast<const T *>(pA)) ==
+           FieldValue(static_cast<const T *>(pB));
+  }
+  static bool Greater(const Field *pA, const Field *pB) {
+    return FieldValue(static_cast<const T *>(pB)) <
+           FieldValue(static_cast<const T *>(pA));
+  }
+};
+
+/**
+ * @brief 某一字段类型的比较，在建立索引或执行计划时按类型选择一次。
+ * Less/Equal/Greater 按选择的类型展开为 TypedCompare<T> 的直接比较，不经过函数指针；
+ * 二分查找和排序在循环外选择一次类型，循环内只有内联的值比较
+ */
+class FieldComparator {
+ public:
+  explicit FieldComparator(FieldType iType);
+
+  bool Less(const Field *pA, const Field *pB) const;
+  bool Equal(const Field *pA, const Field *pB) const;
+  bool Greater(const Field *pA, const Field *pB) const;
+
+  /**
+   * @brief 有序键数组中第一个 >= pKey 的位置
+   */
+  Size LowerBound(const std::vector<Field *> &iKeyVec,
+                  const Field *pKey) const;
+  /**
+   * @brief 有序键数组中第一个 > pKey 的位置
+   */
+  Size UpperBound(const std::vector<Field *> &iKeyVec,
+                  const Field *pKey) const;
+  /**
+   * @brief 按键稳定排序，键不能为空值
+   */
+  void Sort(std::vector<std::pair<Field *, PageSlotID>> &iEntryVec) const;
+
+ private:
+  // TINYINT、SMALLINT 的值也是 IntField，与 INT 共用一种比较
+  enum class Kind { INT, BIGINT, FLOAT, STRING, NONE };
+  Kind _iKind;
+};
+
+inline bool FieldComparator::Less(const Field *pA, const Field *pB) const {
+  switch (_iKind) {
+    case Kind::INT:
+      return TypedCompare<IntField>::Less(pA, pB);
+    case Kind::BIGINT:
+      return TypedCompare<BigIntField>::Less(pA, pB);
+    case Kind::FLOAT:
+      return TypedCompare<FloatField>::Less(pA, pB);
+    case Kind::STRING:
+      return TypedCompare<StringField>::Less(pA, pB);
+    default:
+      // 空值与任何值比较都不成立
+      return false;
+  }
+}
+
+inline bool FieldComparator::Equal(const Field *pA, const Field *pB) const {
+  switch (_iKind) {
+    case Kind::INT:
+      return TypedCompare<IntField>::Equal(pA, pB);
+    case Kind::BIGINT:
+      return TypedCompare<BigIntField>::Equal(pA, pB);
+    case Kind::FLOAT:
+      return TypedCompare<FloatField>::Equal(pA, pB);
+    case Kind::STRING:
+      return TypedCompare<StringField>::Equal(pA, pB);
+    default:
+      return false;
+  }
+}
+
+inline bool FieldComparator::Greater(const Field *pA, const Field *pB) const {
+  return Less(pB, pA);
+}
+
+const FieldComparator &GetComparator(FieldType iType);
+
 bool Less(Field *pA, Field *pB, FieldType iType);
 bool Equal(Field *pA, Field *pB, FieldType iType);
 bool Greater(Field *pA, Field *pB, FieldType iType);
-}  // namespace thdb
\ No newline at end of file
+}  // namespace thdb
+
+#endif  // THDB_COMPARE_H_
@@ -1,9 +1,21 @@
 #include "field/field.h"
 
+#include <cmath>
+
+#include "exception/exceptions.h"
+#include "field/big_int_field.h"
+#include "field/int_field.h"
+
 namespace thdb {
 String toString(FieldType iType) {
   if (iType == FieldType::INT_TYPE) {
     return "Integer";
+  } else if (iType == FieldType::TINYINT_TYPE) {
+    return "TinyInt";
+  } else if (iType == FieldType::SMALLINT_TYPE) {
+    return "SmallInt";
+  } else if (iType == FieldType::BIGINT_TYPE) {
+    return "BigInt";
   } else if (iType == FieldType::FLOAT_TYPE) {
     return "Float";
   } else if (iType == FieldType::STRING_TYPE) {
@@ -14,4 +26,57 @@ String toString(FieldType iType) {
     return "Error";
   }
 }
+
+bool IsIntType(FieldType iType) {
+  return iType == FieldType::INT_TYPE || iType == FieldType::TINYINT_TYPE ||
+         iType == FieldType::SMALLINT_TYPE;
+}
+
+bool IsIntegerType(FieldType iType) {
+  return IsIntType(iType) || iType == FieldType::BIGINT_TYPE;
+}
+
+void GetIntegerRange(FieldType iType, int64_t &nMin, int64_t &nMax) {
+  if (iType == FieldType::TINYINT_TYPE) {
+    nMin = INT8_MIN, nMax = INT8_MAX;
+  } else if (iType == FieldType::SMALLINT_TYPE) {
+    nMin = INT16_MIN, nMax = INT16_MAX;
+  } else if (iType == FieldType::BIGINT_TYPE) {
+    nMin = INT64_MIN, nMax = INT64_MAX;
+  } else {
+    nMin = INT32_MIN, nMax = INT32_MAX;
+  }
+}
+
+int64_t CeilToInteger(double fVal) {
+  if (fVal <= (double)INT64_MIN) return INT64_MIN;
+  if (fVal >= (double)INT64_MAX) return INT64_MAX;
+  return (int64_t)ceil(fVal);
+}
+
+Size GetTypeSize(FieldType iType) {
+  switch (iType) {
+    case FieldType::TINYINT_TYPE:
+      return 1;
+    case FieldType::SMALLINT_TYPE:
+      return 2;
+    case FieldType::INT_TYPE:
+      return 4;
+    case FieldType::BIGINT_TYPE:
+    case FieldType::FLOAT_TYPE:
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+Field *ParseIntegerField(const String &sRaw, FieldType iType) {
+  int64_t nVal = std::stoll(sRaw);
+  if (iType == FieldType::BIGINT_TYPE) return new BigIntField(nVal);
+  int64_t nMin, nMax;
+  GetIntegerRange(iType, nMin, nMax);
+  if (nVal < nMin || nVal > nMax) throw RecordValueException(sRaw, iType);
+  return new IntField((int)nVal);
+}
+
 }  // namespace thdb
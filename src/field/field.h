@@ -2,6 +2,7 @@
 #define THDB_FIELD_H_
 
 #include "defines.h"
+#include "utils/arena.h"
 
 namespace thdb {
 
@@ -9,7 +10,10 @@ enum class FieldType {
   NONE_TYPE = 0,
   INT_TYPE = 1,
   FLOAT_TYPE = 2,
-  STRING_TYPE = 3
+  STRING_TYPE = 3,
+  TINYINT_TYPE = 4,
+  SMALLINT_TYPE = 5,
+  BIGINT_TYPE = 6
 };
 
 class Field {
@@ -22,10 +26,39 @@ class Field {
   virtual Field *Copy() const = 0;
 
   virtual ~Field() = default;
+
+  // 执行语句时在语句的内存池中分配
+  static void *operator new(size_t nSize) { return Arena::New(nSize); }
+  static void operator delete(void *pData) { Arena::Delete(pData); }
 };
 
 String toString(FieldType iType);
 
+/**
+ * @brief TINYINT、SMALLINT、INT 列的值都用 IntField 表示，只是在记录中保存的字节数不同
+ */
+bool IsIntType(FieldType iType);
+/**
+ * @brief 包括 BIGINT 在内的整数类型
+ */
+bool IsIntegerType(FieldType iType);
+/**
+ * @brief 整数类型的取值范围
+ */
+void GetIntegerRange(FieldType iType, int64_t &nMin, int64_t &nMax);
+/**
+ * @brief 检索条件中的浮点边界向上取整为整数边界，超出 int64_t 时取最近的端点
+ */
+int64_t CeilToInteger(double fVal);
+/**
+ * @brief 数值类型在定长记录中占用的字节数，字符串等其他类型返回0
+ */
+Size GetTypeSize(FieldType iType);
+/**
+ * @brief 按整数列的类型转换 INSERT/UPDATE 语句中的值，超出范围时抛出异常
+ */
+Field *ParseIntegerField(const String &sRaw, FieldType iType);
+
 }  // namespace thdb
 
 #endif  // THDB_FIELD_H_
@@ -1,3 +1,4 @@
+#include "big_int_field.h"
 #include "compare.h"
 #include "float_field.h"
 #include "int_field.h"
@@ -31,8 +31,6 @@ String FloatField::ToString() const {
   return strs.str();
 }
 
-double FloatField::GetFloatData() const { return _fData; }
-
 Field *FloatField::Copy() const { return new FloatField(_fData); }
 
 bool operator==(const FloatField &a, const FloatField &b) {
@@ -21,7 +21,7 @@ class FloatField : public Field {
 
   Field *Copy() const override;
 
-  double GetFloatData() const;
+  double GetFloatData() const { return _fData; }
 
  private:
   double _fData;
@@ -7,27 +7,38 @@ namespace thdb {
 
 IntField::IntField(const int &nData) : _nData(nData) {}
 
-IntField::IntField(const uint8_t* src, Size nSize) {
-  assert(nSize == 4);
-  memcpy((uint8_t *)&_nData, src, nSize);
-}
+IntField::IntField(const uint8_t* src, Size nSize) { SetData(src, nSize); }
 
+// TINYINT、SMALLINT 列以1、2字节保存，读出时按符号扩展
 void IntField::SetData(const uint8_t *src, Size nSize) {
-  assert(nSize == 4);
-  memcpy((uint8_t *)&_nData, src, nSize);
+  if (nSize == 1) {
+    _nData = (int8_t)src[0];
+  } else if (nSize == 2) {
+    int16_t nData;
+    memcpy(&nData, src, nSize);
+    _nData = nData;
+  } else {
+    assert(nSize == 4);
+    memcpy((uint8_t *)&_nData, src, nSize);
+  }
 }
 
 void IntField::GetData(uint8_t *dst, Size nSize) const {
-  assert(nSize == 4);
-  memcpy(dst, (uint8_t *)&_nData, nSize);
+  if (nSize == 1) {
+    dst[0] = (uint8_t)(int8_t)_nData;
+  } else if (nSize == 2) {
+    int16_t nData = _nData;
+    memcpy(dst, &nData, nSize);
+  } else {
+    assert(nSize == 4);
+    memcpy(dst, (uint8_t *)&_nData, nSize);
+  }
 }
 
 FieldType IntField::GetType() const { return FieldType::INT_TYPE; }
 
 String IntField::ToString() const { return std::to_string(_nData); }
 
-int IntField::GetIntData() const { return _nData; }
-
 Field *IntField::Copy() const { return new IntField(_nData); }
 
 bool operator==(const IntField &a, const IntField &b) {
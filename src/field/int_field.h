@@ -21,7 +21,8 @@ class IntField : public Field {
 
   Field *Copy() const override;
 
-  int GetIntData() const;
+  // 内联，比较函数直接读取值
+  int GetIntData() const { return _nData; }
 
  private:
   int _nData;
@@ -31,8 +31,6 @@ FieldType StringField::GetType() const { return FieldType::STRING_TYPE; }
 
 String StringField::ToString() const { return _sData; }
 
-String StringField::GetString() const { return _sData; }
-
 Field *StringField::Copy() const { return new StringField(_sData); }
 
 bool operator==(const StringField &a, const StringField &b) {
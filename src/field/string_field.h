@@ -24,7 +24,7 @@ class StringField : public Field {
 
   String ToString() const override;
 
-  String GetString() const;
+  const String &GetString() const { return _sData; }
 
  private:
   String _sData;
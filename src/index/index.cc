@@ -1,16 +1,18 @@
 #include "index/index.h"
 #include <cassert>
+#include <cstring>
 #include <vector>
 #include <algorithm>
 
 namespace thdb {
-Index::Index(FieldType iType): _iKeyType(iType) {
+Index::Index(FieldType iType, Size nKeySize): _iKeyType(iType), _pCmp(&GetComparator(iType)) {
   // 建立一个新的根结点，注意需要基于类型判断根结点的属性
   // 注意记录RootID
-  if (iType == FieldType::INT_TYPE) {
-    _nKeySize = 4;
-  } else if (iType == FieldType::FLOAT_TYPE) {
-    _nKeySize = 8;
+  // 整数键按列类型的宽度保存，TINYINT、SMALLINT 的节点可以容纳更多的键
+  if (IsIntegerType(iType) || iType == FieldType::FLOAT_TYPE) {
+    _nKeySize = GetTypeSize(iType);
+  } else if (iType == FieldType::STRING_TYPE && nKeySize <= BPTREE_MAX_KEY_SIZE) {
+    _nKeySize = nKeySize;
   } else {
     throw IndexTypeException();
   }
@@ -25,6 +27,7 @@ Index::Index(PageID nPageID) {
   BPTreeNode* root = new BPTreeNode(_nRootID);
   _nKeySize = root->GetKeySize();
   _iKeyType = root->GetKeyType();
+  _pCmp = &GetComparator(_iKeyType);
   delete root;
 }
 
@@ -32,40 +35,24 @@ Index::~Index() {}
 
 PageID Index::GetRootID() const { return _nRootID; }
 
+// 字符串键规范化为记录中实际保存的内容：截断到列长度，去掉'\0'之后的部分
+// 规范化后的键按字节比较的顺序就是键的顺序
+Field* Index::NormalizeKey(Field* pKey) const {
+    if (_iKeyType != FieldType::STRING_TYPE) return pKey;
+    const String& sKey = ((StringField*)pKey)->GetString();
+    Size size = std::min<Size>(_nKeySize, sKey.size());
+    const void* pEnd = memchr(sKey.data(), 0, size);
+    if (pEnd) size = (const char*)pEnd - sKey.data();
+    if (size == sKey.size()) return pKey;
+    return new StringField(sKey.substr(0, size));
+}
+
 // 递归处理上溢, 所有的新节点在这里产生，注意维护父子关系
 void Index::SolveOverflow(BPTreeNode* curPage) {
     if (!curPage->needSplit()) {
         delete curPage;
         return;
     }
-    Size half = curPage->GetCap() / 2;
-    // 分裂出去右半部分
-    BPTreeNode* neighborPage;
-    if (curPage->isLeaf()) {
-        neighborPage = new BPTreeNode(_nKeySize, _iKeyType, NodeType::LEAF_NODE_TYPE);
-        neighborPage->_iOverflowVec.insert(neighborPage->_iOverflowVec.end(), curPage->_iOverflowVec.begin()+half+1, curPage->_iOverflowVec.end());
-        curPage->_iOverflowVec.erase(curPage->_iOverflowVec.begin() + half+1, curPage->_iOverflowVec.end());
-        neighborPage->_nNextID = curPage->_nNextID;
-        curPage->_nNextID = neighborPage->GetPageID();
-    } else {
-        neighborPage = new BPTreeNode(_nKeySize, _iKeyType, NodeType::INNER_NODE_TYPE);
-    }
-    neighborPage->_iKeyVec.insert(neighborPage->_iKeyVec.end(), curPage->_iKeyVec.begin()+half+1, curPage->_iKeyVec.end());
-    curPage->_iKeyVec.erase(curPage->_iKeyVec.begin() + half+1, curPage->_iKeyVec.end());
-    neighborPage->_iChildVec.insert(neighborPage->_iChildVec.end(), curPage->_iChildVec.begin()+half+1, curPage->_iChildVec.end());
-    curPage->_iChildVec.erase(curPage->_iChildVec.begin() + half+1, curPage->_iChildVec.end());
-    neighborPage->_bModified = true;
-    curPage->_bModified = true;
-    // 维护新节点子代的父子关系
-    if (!neighborPage->isLeaf()) {
-        Size size = neighborPage->GetSize();
-        for (Size i = 0; i < size; ++i) {
-            PageID childPageID = neighborPage->_iChildVec[i].first;
-            BPTreeNode* child = new BPTreeNode(childPageID);
-            child->SetParentID(neighborPage->GetPageID());
-            delete child;
-        }
-    }
     // 维护新节点父代的父子关系
     PageID fatherID = curPage->GetParentID();
     BPTreeNode* father;
@@ -78,14 +65,46 @@ void Index::SolveOverflow(BPTreeNode* curPage) {
     } else {
         father = new BPTreeNode(fatherID);
     }
-    // 得到新节点key插入位置
-    Rank rank = father->LowerBound(neighborPage->_iKeyVec[0]);
-    father->_iKeyVec.insert(father->_iKeyVec.begin() + rank, neighborPage->_iKeyVec[0]);
-    father->_iChildVec.insert(father->_iChildVec.begin() + rank, std::pair<PageID, SlotID>(neighborPage->GetPageID(), 0));
-    father->_bModified = true;
-    neighborPage->SetParentID(fatherID);
+    // 定长键分裂一次即可；变长键的节点可能要拆成多个，每次拆出的右侧部分都能放进一个节点
+    do {
+        Size half = curPage->SplitRank();
+        // 分裂出去右半部分
+        BPTreeNode* neighborPage;
+        if (curPage->isLeaf()) {
+            // 分裂出的叶子尽量与当前叶子相邻，叶子链表遍历时访问相邻的页面
+            neighborPage = new BPTreeNode(_nKeySize, _iKeyType, NodeType::LEAF_NODE_TYPE, curPage->GetPageID());
+            neighborPage->_iOverflowVec.insert(neighborPage->_iOverflowVec.end(), curPage->_iOverflowVec.begin()+half+1, curPage->_iOverflowVec.end());
+            curPage->_iOverflowVec.erase(curPage->_iOverflowVec.begin() + half+1, curPage->_iOverflowVec.end());
+            neighborPage->_nNextID = curPage->_nNextID;
+            curPage->_nNextID = neighborPage->GetPageID();
+        } else {
+            neighborPage = new BPTreeNode(_nKeySize, _iKeyType, NodeType::INNER_NODE_TYPE, curPage->GetPageID());
+        }
+        neighborPage->_iKeyVec.insert(neighborPage->_iKeyVec.end(), curPage->_iKeyVec.begin()+half+1, curPage->_iKeyVec.end());
+        curPage->_iKeyVec.erase(curPage->_iKeyVec.begin() + half+1, curPage->_iKeyVec.end());
+        neighborPage->_iChildVec.insert(neighborPage->_iChildVec.end(), curPage->_iChildVec.begin()+half+1, curPage->_iChildVec.end());
+        curPage->_iChildVec.erase(curPage->_iChildVec.begin() + half+1, curPage->_iChildVec.end());
+        neighborPage->_bModified = true;
+        curPage->_bModified = true;
+        // 维护新节点子代的父子关系
+        if (!neighborPage->isLeaf()) {
+            Size size = neighborPage->GetSize();
+            for (Size i = 0; i < size; ++i) {
+                PageID childPageID = neighborPage->_iChildVec[i].first;
+                BPTreeNode* child = new BPTreeNode(childPageID);
+                child->SetParentID(neighborPage->GetPageID());
+                delete child;
+            }
+        }
+        // 得到新节点key插入位置
+        Rank rank = father->LowerBound(neighborPage->_iKeyVec[0]);
+        father->_iKeyVec.insert(father->_iKeyVec.begin() + rank, neighborPage->_iKeyVec[0]);
+        father->_iChildVec.insert(father->_iChildVec.begin() + rank, std::pair<PageID, SlotID>(neighborPage->GetPageID(), 0));
+        father->_bModified = true;
+        neighborPage->SetParentID(fatherID);
+        delete neighborPage;
+    } while (curPage->needSplit());
     curPage->SetParentID(fatherID);
-    delete neighborPage;
     delete curPage;
     SolveOverflow(father);
 }
@@ -143,7 +162,8 @@ void Index::SolveUnderflow(BPTreeNode* curPage) {
             curPage->_bModified = true;
             delete leftNode;
             delete curPage;
-            delete fatherNode;
+            // 替换的变长键可能更长，父节点需要分裂
+            SolveOverflow(fatherNode);
             return;
         }
         delete leftNode;
@@ -171,8 +191,8 @@ void Index::SolveUnderflow(BPTreeNode* curPage) {
             rightNode->_bModified = true;
             curPage->_bModified = true;
             delete rightNode;
-            delete fatherNode;
             delete curPage;
+            SolveOverflow(fatherNode);
             return;
         }
         delete rightNode;
@@ -253,21 +273,81 @@ void Index::Clear() {
 }
 
 bool Index::Insert(Field* pKey, const PageSlotID &iPair) {
-    PageID leafPage = searchIntoLeafInsert(pKey);
+    // NULL 不参与任何比较，不写入索引
+    if (pKey->GetType() == FieldType::NONE_TYPE) return false;
+    Field* pNormKey = NormalizeKey(pKey);
+    PageID leafPage = searchIntoLeafInsert(pNormKey);
     BPTreeNode* leaf = new BPTreeNode(leafPage);
     assert(leaf->isLeaf());
-    leaf->InsertInLeaf(pKey, iPair);
+    leaf->InsertInLeaf(pNormKey, iPair);
     SolveOverflow(leaf);
+    if (pNormKey != pKey) delete pNormKey;
     return true;
 }
 
+Size Index::InsertBatch(const std::vector<std::pair<Field*, PageSlotID>> &iEntryVec) {
+    Size nInserted = 0;
+    Size i = 0;
+    while (i < iEntryVec.size()) {
+        if (iEntryVec[i].first->GetType() == FieldType::NONE_TYPE) {
+            ++i;
+            continue;
+        }
+        Field* pFence = nullptr;
+        Field* pNormKey = NormalizeKey(iEntryVec[i].first);
+        BPTreeNode* leaf = new BPTreeNode(searchIntoLeafInsert(pNormKey, &pFence));
+        assert(leaf->isLeaf());
+        // 键有序，小于分隔键的后续键都落在这个叶节点，叶节点需要分裂时再从根下降
+        while (true) {
+            leaf->InsertInLeaf(pNormKey, iEntryVec[i].second);
+            if (pNormKey != iEntryVec[i].first) delete pNormKey;
+            ++nInserted;
+            ++i;
+            while (i < iEntryVec.size() && iEntryVec[i].first->GetType() == FieldType::NONE_TYPE) ++i;
+            if (i == iEntryVec.size() || leaf->needSplit()) break;
+            pNormKey = NormalizeKey(iEntryVec[i].first);
+            if (pFence && !_pCmp->Less(pNormKey, pFence)) {
+                if (pNormKey != iEntryVec[i].first) delete pNormKey;
+                break;
+            }
+        }
+        SolveOverflow(leaf);
+        if (pFence) delete pFence;
+    }
+    return nInserted;
+}
+
 Size Index::Delete(Field *pKey) {
+    if (pKey->GetType() == FieldType::NONE_TYPE) return 0;
+    Field* pNormKey = NormalizeKey(pKey);
+    Size size = DeleteNormalized(pNormKey);
+    if (pNormKey != pKey) delete pNormKey;
+    return size;
+}
+
+bool Index::Delete(Field* pKey, const PageSlotID &iPair) {
+    if (pKey->GetType() == FieldType::NONE_TYPE) return false;
+    Field* pNormKey = NormalizeKey(pKey);
+    bool exist = DeleteNormalized(pNormKey, iPair);
+    if (pNormKey != pKey) delete pNormKey;
+    return exist;
+}
+
+bool Index::Update(Field* pKey, const PageSlotID &iOld, const PageSlotID& iNew) {
+    if (pKey->GetType() == FieldType::NONE_TYPE) return false;
+    Field* pNormKey = NormalizeKey(pKey);
+    bool update = UpdateNormalized(pNormKey, iOld, iNew);
+    if (pNormKey != pKey) delete pNormKey;
+    return update;
+}
+
+Size Index::DeleteNormalized(Field *pKey) {
     PageID leafPage = searchIntoLeaf(pKey);
     BPTreeNode* leaf = new BPTreeNode(leafPage);
     assert(leaf->isLeaf());
     Rank rank = leaf->LessOrEqualBound(pKey);
     Size size = 0;
-    if (rank < 0 || !Equal(leaf->_iKeyVec[rank], pKey, _iKeyType)) {
+    if (rank < 0 || !_pCmp->Equal(leaf->_iKeyVec[rank], pKey)) {
         delete leaf;
     } else {
         size = leaf->DeleteAllInLeaf(rank);
@@ -276,13 +356,13 @@ Size Index::Delete(Field *pKey) {
     return size;
 }
 
-bool Index::Delete(Field* pKey, const PageSlotID &iPair) {
+bool Index::DeleteNormalized(Field* pKey, const PageSlotID &iPair) {
     PageID leafPage = searchIntoLeaf(pKey);
     BPTreeNode* leaf = new BPTreeNode(leafPage);
     assert(leaf->isLeaf());
     Rank rank = leaf->LessOrEqualBound(pKey);
     bool exist = false;
-    if (rank < 0 || !Equal(leaf->_iKeyVec[rank], pKey, _iKeyType)) {
+    if (rank < 0 || !_pCmp->Equal(leaf->_iKeyVec[rank], pKey)) {
         delete leaf;
     } else {
         exist = leaf->DeleteInLeaf(rank, iPair);
@@ -291,7 +371,7 @@ bool Index::Delete(Field* pKey, const PageSlotID &iPair) {
     return exist;
 }
 
-bool Index::Update(Field* pKey, const PageSlotID &iOld, const PageSlotID& iNew) {
+bool Index::UpdateNormalized(Field* pKey, const PageSlotID &iOld, const PageSlotID& iNew) {
     PageID leafPage = searchInfoLeafEqual(pKey);
     if (leafPage == NULL_PAGE) {
         return false;
@@ -304,7 +384,8 @@ bool Index::Update(Field* pKey, const PageSlotID &iOld, const PageSlotID& iNew)
     }
 }
 
-std::vector<PageSlotID> Index::Range(Field *pLow, Field *pHigh) {
+std::vector<PageSlotID> Index::Range(Field *pLow, Field *pHigh,
+                                     bool bClosed) {
     PageID leafID = searchIntoLeaf(pLow);
     std::vector<PageSlotID> result;
     // 沿着叶节点链表找
@@ -312,13 +393,16 @@ std::vector<PageSlotID> Index::Range(Field *pLow, Field *pHigh) {
         BPTreeNode* curleaf = new BPTreeNode(leafID);
         assert(curleaf->isLeaf());
         Size begin_rank = curleaf->LowerBound(pLow);
+        // 删除后叶节点中的键可能都小于 pLow，此时结果从后继叶节点开始
         if (begin_rank >= curleaf->GetSize()) {
+            leafID = curleaf->GetNextLeafID();
             delete curleaf;
-            break;
         } else {
             Size i;
             for (i = begin_rank; i < curleaf->GetSize(); ++i) {
-                if (!Less(curleaf->_iKeyVec[i], pHigh, _iKeyType)) break;
+                if (bClosed ? _pCmp->Less(pHigh, curleaf->_iKeyVec[i])
+                            : !_pCmp->Less(curleaf->_iKeyVec[i], pHigh))
+                    break;
                 std::vector<PageSlotID> temp = curleaf->GetAllValueByRank(i);
                 result.insert(result.end(), temp.begin(), temp.end());
             }
@@ -348,14 +432,28 @@ PageID Index::searchIntoLeaf(Field* pKey) const {
     return leafPage;
 }
 
-PageID Index::searchIntoLeafInsert(Field* pKey) {
+PageID Index::searchIntoLeafInsert(Field* pKey, Field** ppFence) {
     BPTreeNode* root = new BPTreeNode(_nRootID);
+    Field* pFence = nullptr;
     while (!root->isLeaf()) {
         Rank rank = root->LessOrEqualBound(pKey);
         if (rank < 0) rank = 0;
-        if (Less(pKey, root->_iKeyVec[rank], _iKeyType)) {
+        if (_pCmp->Less(pKey, root->_iKeyVec[rank])) {
             root->_iKeyVec[rank] = pKey;
             root->_bModified = true;
+            // 替换成更短的变长键后公共前缀可能变短，节点放不下时先分裂，再从根重新查找
+            if (root->needSplit()) {
+                SolveOverflow(root);
+                root = new BPTreeNode(_nRootID);
+                if (pFence) delete pFence;
+                pFence = nullptr;
+                continue;
+            }
+        }
+        // 越深的层次给出的分隔键越紧
+        if (ppFence && rank + 1 < (Rank)root->GetSize()) {
+            if (pFence) delete pFence;
+            pFence = root->_iKeyVec[rank + 1]->Copy();
         }
         PageID nextLevelID = root->_iChildVec[rank].first;
         delete root;
@@ -363,6 +461,7 @@ PageID Index::searchIntoLeafInsert(Field* pKey) {
     }
     PageID leafPage = root->GetPageID();
     delete root;
+    if (ppFence) *ppFence = pFence;
     return leafPage;
 }
 
@@ -379,7 +478,7 @@ PageID Index::searchInfoLeafEqual(Field* pKey) const {
         root = new BPTreeNode(nextLevelID);
     }
     Rank rank = root->LessOrEqualBound(pKey);
-    if (rank < 0 || !Equal(root->_iKeyVec[rank], pKey, _iKeyType)) {
+    if (rank < 0 || !_pCmp->Equal(root->_iKeyVec[rank], pKey)) {
         delete root;
         return NULL_PAGE;
     } else {
@@ -15,8 +15,9 @@ public:
     /**
     * @brief 构建一个特定类型的索引
     * @param iType 字段类型
+    * @param nKeySize 字段长度，只对字符串类型有效
     */
-    Index(FieldType iType);
+    Index(FieldType iType, Size nKeySize);
     /**
     * @brief 从一个页面编号构建索引
     * @param nRootID
@@ -33,6 +34,12 @@ public:
     * @return false 插入失败
     */
     bool Insert(Field *pKey, const PageSlotID &iPair);
+    /**
+    * @brief 按键升序批量插入，落在同一叶节点的连续键只从根下降一次
+    * @param iEntryVec 按键升序排列的Key Value Pair，NULL键被跳过
+    * @return Size 插入的数量
+    */
+    Size InsertBatch(const std::vector<std::pair<Field *, PageSlotID>> &iEntryVec);
     /**
      * @brief 删除某个Key下所有的Key Value Pair
      * @param pKey 删除的Key
@@ -61,9 +68,11 @@ public:
     *
     * @param pLow
     * @param pHigh
+    * @param bClosed 为 true 时查找闭区间[pLow, pHigh]
     * @return std::vector<PageSlotID> 所有符合范围条件的Value数组
     */
-    std::vector<PageSlotID> Range(Field *pLow, Field *pHigh);
+    std::vector<PageSlotID> Range(Field *pLow, Field *pHigh,
+                                  bool bClosed = false);
 
     /**
     * @brief 清空索引占用的所有空间
@@ -80,14 +89,23 @@ private:
     PageID _nRootID;
     Size _nKeySize;
     FieldType _iKeyType;
+    // 按键类型选择一次的比较器
+    const FieldComparator* _pCmp;
 
     // 递归处理上溢, 所有的新节点在这里产生，注意维护父子关系
     void SolveOverflow(BPTreeNode* curPage);
     // 递归处理下溢
     void SolveUnderflow(BPTreeNode* curPage);
 
+    // 字符串键截断到列长度，与记录中保存的内容一致；不需要修改时返回pKey本身
+    Field* NormalizeKey(Field* pKey) const;
+    Size DeleteNormalized(Field* pKey);
+    bool DeleteNormalized(Field* pKey, const PageSlotID &iPair);
+    bool UpdateNormalized(Field* pKey, const PageSlotID &iOld, const PageSlotID &iNew);
+
     PageID searchIntoLeaf(Field* pKey) const;
-    PageID searchIntoLeafInsert(Field* pKey);
+    // ppFence 不为空时返回叶节点右侧的分隔键(副本)，小于它的键都属于这个叶节点；最右侧的叶节点为nullptr
+    PageID searchIntoLeafInsert(Field* pKey, Field** ppFence = nullptr);
     PageID searchInfoLeafEqual(Field* pKey) const;
     void ClearInner(PageID nPageID);
 
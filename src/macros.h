@@ -10,6 +10,8 @@ const PageOffset HEADER_SIZE = 64;
 const PageOffset DATA_SIZE = PAGE_SIZE - HEADER_SIZE;
 const PageID MEM_PAGES = 1U << 18;
 const PageID DB_PAGES = 1U << 28;
+// 每个段文件保存的页面数量(1GB)
+const PageID SEGMENT_PAGES = 1U << 18;
 const PageID NULL_PAGE = 0xFFFFFFFF;
 const SlotID NULL_SLOT = 0xFFFF;
 const Size TABLE_CAPTION = 128;
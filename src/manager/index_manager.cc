@@ -47,10 +47,10 @@ Index *IndexManager::GetIndex(const String &sTableName,
 }
 
 Index *IndexManager::AddIndex(const String &sTableName, const String &sColName,
-                              FieldType iType) {
+                              FieldType iType, Size nSize) {
   if (IsIndex(sTableName, sColName)) throw IndexException();
   String sIndexName = GetIndexName(sTableName, sColName);
-  Index *pIndex = new Index(iType);
+  Index *pIndex = new Index(iType, nSize);
   PageID nRoot = pIndex->GetRootID();
   delete pIndex;
   pIndex = new Index(nRoot);
@@ -61,6 +61,8 @@ Index *IndexManager::AddIndex(const String &sTableName, const String &sColName,
   } else {
     _iTableIndexes[sTableName].push_back(sColName);
   }
+  // 目录页面立即更新，检查点写回的页面总能从目录中找到
+  Store();
   return pIndex;
 }
 
@@ -77,6 +79,7 @@ void IndexManager::DropIndex(const String &sTableName, const String &sColName) {
                                              _iTableIndexes[sTableName].end(),
                                              sColName));
   if (_iTableIndexes[sTableName].size() == 0) _iTableIndexes.erase(sTableName);
+  Store();
 }
 
 std::vector<String> IndexManager::GetTableIndexes(
@@ -95,6 +98,14 @@ bool IndexManager::HasIndex(const String &sTableName) const {
   return _iTableIndexes.find(sTableName)->second.size() > 0;
 }
 
+void IndexManager::Sync() {
+  for (const auto &iPair : _iIndexMap)
+    if (_iIndexIDMap[iPair.first] != iPair.second->GetRootID()) {
+      Store();
+      return;
+    }
+}
+
 void IndexManager::Store() {
   // Update Index Root
   for (const auto &iPair : _iIndexMap)
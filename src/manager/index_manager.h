@@ -13,13 +13,17 @@ class IndexManager {
 
   Index *GetIndex(const String &sTableName, const String &sColName);
   Index *AddIndex(const String &sTableName, const String &sColName,
-                  FieldType iType);
+                  FieldType iType, Size nSize);
   void DropIndex(const String &sTableName, const String &sColName);
   bool IsIndex(const String &sTableName, const String &sColName);
 
   std::vector<std::pair<String, String>> GetIndexInfos() const;
   std::vector<String> GetTableIndexes(const String &sTableName) const;
   bool HasIndex(const String &sTableName) const;
+  /**
+   * @brief 索引的根节点在分裂或合并后会改变，有变化时重写目录页面
+   */
+  void Sync();
 
  private:
   std::map<String, Index *> _iIndexMap;
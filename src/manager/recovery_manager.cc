@@ -1,6 +1,7 @@
 #include <vector>
 #include <algorithm>
 #include "manager/recovery_manager.h"
+#include "manager/table_manager.h"
 #include "page/log_page.h"
 #include "table/table.h"
 
@@ -10,10 +11,25 @@ void RecoveryManager::setLogPageID(PageID logPageID) {
     _logPageID = logPageID;
 };
 
+void RecoveryManager::setTableManager(TableManager *pTableManager) {
+    _pTableManager = pTableManager;
+}
+
+// 日志写满一个页面后按链表追加，按顺序读出所有页面中的日志
+static std::vector<LogLine> ReadLogs(PageID logPageID) {
+    std::vector<LogLine> logs;
+    while (logPageID != NULL_PAGE) {
+        LogPage* page = new LogPage(logPageID);
+        std::vector<LogLine> pageLogs = page->getLogs();
+        logs.insert(logs.end(), pageLogs.begin(), pageLogs.end());
+        logPageID = page->GetNextID();
+        delete page;
+    }
+    return logs;
+}
+
 void RecoveryManager::Redo() {
-    LogPage* page = new LogPage(_logPageID);
-    std::vector<LogLine> logs = page->getLogs();
-    delete page;
+    std::vector<LogLine> logs = ReadLogs(_logPageID);
     // 遍历logs得到redo
     std::vector<TxnID> commited;
     int length = logs.size();
@@ -32,9 +48,7 @@ void RecoveryManager::Redo() {
 }
 
 void RecoveryManager::Undo() {
-    LogPage* page = new LogPage(_logPageID);
-    std::vector<LogLine> logs = page->getLogs();
-    delete page;
+    std::vector<LogLine> logs = ReadLogs(_logPageID);
     // 遍历logs得到undo
     std::vector<TxnID> commited;
     int length = logs.size();
@@ -51,8 +65,13 @@ void RecoveryManager::Undo() {
     }
     // undo, delete
     for (auto log: undos) {
-        Table* pTable = new Table(log._tableID);
-        pTable->DeleteRecord(log._location.first, log._location.second);
+        Table* pTable = nullptr;
+        if (_pTableManager) pTable = _pTableManager->GetTable(log._tableID);
+        bool bOwned = (pTable == nullptr);
+        if (bOwned) pTable = new Table(log._tableID);
+        for (Size i = 0; i < log._count; ++i)
+            pTable->DeleteRecord(log._location.first, log._location.second + i);
+        if (bOwned) delete pTable;
     }
 }
 
@@ -5,6 +5,8 @@
 
 namespace thdb {
 
+class TableManager;
+
 class RecoveryManager {
  public:
   RecoveryManager() = default;
@@ -13,9 +15,11 @@ class RecoveryManager {
   void Redo();
   void Undo();
   void setLogPageID(PageID);
+  void setTableManager(TableManager *pTableManager);
 
  private:
   PageID _logPageID;
+  TableManager *_pTableManager = nullptr;
 };
 
 }  // namespace thdb
@@ -35,6 +35,12 @@ Table *TableManager::GetTable(const String &sTableName) {
   return _iTableMap[sTableName];
 }
 
+Table *TableManager::GetTable(PageID nTableID) {
+  for (const auto &iPair : _iTableIDMap)
+    if (iPair.second == nTableID) return GetTable(iPair.first);
+  return nullptr;
+}
+
 Table *TableManager::AddTable(const String &sTableName, const Schema &iSchema) {
   if (GetTable(sTableName) != nullptr) throw TableExistException(sTableName);
   TablePage *pPage = new TablePage(iSchema);
@@ -43,6 +49,8 @@ Table *TableManager::AddTable(const String &sTableName, const Schema &iSchema) {
   Table *pTable = new Table(nTableID);
   _iTableMap[sTableName] = pTable;
   _iTableIDMap[sTableName] = nTableID;
+  // 目录页面立即更新，检查点写回的页面总能从目录中找到
+  Store();
   return pTable;
 }
 
@@ -55,6 +63,7 @@ void TableManager::DropTable(const String &sTableName) {
   MiniOS::GetOS()->DeletePage(nTableID);
   _iTableIDMap.erase(sTableName);
   _iTableMap.erase(sTableName);
+  Store();
 }
 
 void TableManager::Store() {
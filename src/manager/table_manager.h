@@ -15,6 +15,11 @@ class TableManager {
   ~TableManager();
 
   Table *GetTable(const String &sTableName);
+  /**
+   * @brief 按表的元数据页面编号获取表，不存在时返回 nullptr。
+   * 事务回滚和恢复只记录了页面编号，需要与查询共用同一个 Table 对象
+   */
+  Table *GetTable(PageID nTableID);
   Table *AddTable(const String &sTableName, const Schema &iSchema);
   void DropTable(const String &sTableName);
 
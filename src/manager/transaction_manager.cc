@@ -2,6 +2,7 @@
 #include <cassert>
 
 #include "macros.h"
+#include "manager/table_manager.h"
 #include "manager/transaction_manager.h"
 #include "table/table.h"
 #include "page/log_page.h"
@@ -20,6 +21,13 @@ TransactionManager::TransactionManager() {
     else pPage = new LogPage();
     logPageID = pPage->GetPageID();
     delete pPage;
+    // 日志写满第一个页面后按链表追加，新的日志写到最后一个页面
+    logTailID = logPageID;
+    PageID nextID = LinkedPage(logTailID).GetNextID();
+    while (nextID != NULL_PAGE) {
+        logTailID = nextID;
+        nextID = LinkedPage(logTailID).GetNextID();
+    }
 };
 
 TransactionManager::~TransactionManager() {
@@ -33,6 +41,14 @@ PageID TransactionManager::getLogPageID() const {
     return logPageID;
 }
 
+bool TransactionManager::hasActiveTxns() const {
+    return !activeTxns.empty();
+}
+
+void TransactionManager::setTableManager(TableManager *pTableManager) {
+    _pTableManager = pTableManager;
+}
+
 Transaction *TransactionManager::Begin() {
     Transaction* txn = new Transaction(nextTxnID);
     activeTxns.push_back(nextTxnID);
@@ -46,9 +62,7 @@ void TransactionManager::Commit(Transaction *txn) {
     assert(_iter != activeTxns.end());
     activeTxns.erase(_iter);
     // wirte-ahead log
-    LogPage* pPage = new LogPage(logPageID);
-    pPage->log(LogLine(txn->getTableID(), txn->GetTxnID(), LogOperation::COMMIT, {0, 0}));
-    delete pPage;
+    appendLogs({LogLine(txn->getTableID(), txn->GetTxnID(), LogOperation::COMMIT, {0, 0})});
 }
 
 void TransactionManager::Abort(Transaction *txn) { 
@@ -56,20 +70,54 @@ void TransactionManager::Abort(Transaction *txn) {
     assert(_iter != activeTxns.end());
     activeTxns.erase(_iter);
     size_t insertNumber = txn->insertHistory.size();
-    Table* pTable = new Table(txn->getTableID());
+    // 与查询共用同一个 Table 对象，避免其中缓存的页面和空闲空间映射过时
+    Table* pTable = nullptr;
+    if (_pTableManager) pTable = _pTableManager->GetTable(txn->getTableID());
+    bool bOwned = (pTable == nullptr);
+    if (bOwned) pTable = new Table(txn->getTableID());
     for (int i = insertNumber-1; i >= 0; i--) {
-        // TODO: get pTable
         auto iPair = txn->insertHistory[i];
         pTable->DeleteRecord(iPair.first, iPair.second);
     }
-    delete pTable;
+    if (bOwned) delete pTable;
     txn->insertHistory.clear();
 }
 
 void TransactionManager::LogInsert(Transaction *txn, PageSlotID location) {
+    LogInserts(txn, {location});
+}
+
+void TransactionManager::LogInserts(Transaction *txn,
+                                    const std::vector<PageSlotID> &locations) {
     // wirte-ahead log
-    LogPage* pPage = new LogPage(logPageID);
-    pPage->log(LogLine(txn->getTableID(), txn->GetTxnID(), LogOperation::INSERT, location));
+    // 同一页面上连续的槽合并为一条日志，批量插入时通常每个页面只有一条
+    std::vector<LogLine> loglines;
+    for (const auto &location: locations) {
+        if (!loglines.empty()) {
+            LogLine &last = loglines.back();
+            if (last._location.first == location.first &&
+                last._location.second + last._count == location.second) {
+                ++last._count;
+                continue;
+            }
+        }
+        loglines.push_back(LogLine(txn->getTableID(), txn->GetTxnID(), LogOperation::INSERT, location));
+    }
+    appendLogs(loglines);
+}
+
+void TransactionManager::appendLogs(const std::vector<LogLine> &loglines) {
+    LogPage* pPage = new LogPage(logTailID);
+    for (const auto &logline: loglines) {
+        if (!pPage->CanLog(logline)) {
+            LogPage* pNext = new LogPage();
+            pPage->PushBack(pNext);
+            logTailID = pNext->GetPageID();
+            delete pPage;
+            pPage = pNext;
+        }
+        pPage->log(logline);
+    }
     delete pPage;
 }
 
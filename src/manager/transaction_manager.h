@@ -5,11 +5,14 @@
 
 #include "defines.h"
 #include "transaction/transaction.h"
+#include "page/log_page.h"
 #include "page/page.h"
 #include "minios/os.h"
 
 namespace thdb {
 
+class TableManager;
+
 class TransactionManager {
 public:
   TransactionManager();
@@ -18,12 +21,28 @@ public:
   void Commit(Transaction *txn);
   void Abort(Transaction *txn);
   void LogInsert(Transaction *txn, PageSlotID location);
+  /**
+   * @brief 一条语句插入的所有记录只打开一次日志页面，同一页面上连续的槽只写一条日志
+   */
+  void LogInserts(Transaction *txn, const std::vector<PageSlotID> &locations);
   PageID getLogPageID() const;
+  /**
+   * @brief 是否有尚未提交或回滚的事务
+   */
+  bool hasActiveTxns() const;
+  void setTableManager(TableManager *pTableManager);
 
 private:
+  /**
+   * @brief 追加到日志链表的最后一个页面，页面写满时在链表结尾添加新的日志页面
+   */
+  void appendLogs(const std::vector<LogLine> &loglines);
+
   std::vector<TxnID> activeTxns;
   TxnID nextTxnID = 0;
   PageID logPageID;
+  PageID logTailID;
+  TableManager *_pTableManager = nullptr;
 
 };
 
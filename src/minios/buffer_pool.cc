@@ -0,0 +1,266 @@
+#include "minios/buffer_pool.h"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+#include "settings.h"
+#include "utils/parallel.h"
+
+namespace thdb {
+
+BufferPool::BufferPool(DataFile *pFile, Size nFrames)
+    : _pFile(pFile), _nFrames(nFrames), _nClock(0), _nDirty(0) {
+  // 所有帧一次性分配在 FrameArena 中，此后不再有逐页的堆分配
+  _pArena = new FrameArena(_nFrames);
+  _pQueue = new IOQueue(_pFile, IO_THREADS, IO_QUEUE_PAGES);
+  _iPageVec.reserve(_nFrames);
+  _iFrameVec.reserve(_nFrames);
+  for (FrameID i = 0; i < _nFrames; ++i) {
+    _iPageVec.push_back(RawPage(_pArena->GetFrame(i)));
+    _iFrameVec.push_back({NULL_PAGE, 0, false, false, false});
+  }
+  _iFrameMap.reserve(_nFrames);
+}
+
+BufferPool::~BufferPool() {
+  Flush();
+  delete _pQueue;
+  delete _pArena;
+}
+
+uint8_t *BufferPool::Pin(PageID nPageID, bool bNew) {
+  std::unique_lock<std::mutex> iLock(_iMutex);
+  auto it = Find(iLock, nPageID);
+  if (it != _iFrameMap.end()) {
+    Frame &iFrame = _iFrameVec[it->second];
+    ++iFrame.nPin;
+    iFrame.bRef = true;
+    if (bNew) {
+      _iPageVec[it->second].Clear();
+      MarkDirty(it->second);
+    }
+    return _iPageVec[it->second].GetData();
+  }
+  FrameID nFrameID = Victim();
+  uint8_t *pData = _iPageVec[nFrameID].GetData();
+  _iFrameVec[nFrameID] = {nPageID, 1, false, true, false};
+  _iFrameMap[nPageID] = nFrameID;
+  if (bNew) {
+    // 新页面在文件中还没有内容，直接清零并标记为脏
+    _iPageVec[nFrameID].Clear();
+    MarkDirty(nFrameID);
+    return pData;
+  }
+  // 页面可能还在写回队列中，此时数据文件中的内容是旧的
+  if (_pQueue->Read(nPageID, pData)) return pData;
+  // 与 Prefetch 相同，在锁外读盘，期间固定这个页面的线程在 Find 中等待读入完成
+  _iFrameVec[nFrameID].bLoading = true;
+  iLock.unlock();
+  std::exception_ptr pError;
+  try {
+    _pFile->Read(nPageID, pData);
+  } catch (...) {
+    pError = std::current_exception();
+  }
+  iLock.lock();
+  _iFrameVec[nFrameID].bLoading = false;
+  if (pError) {
+    _iFrameMap.erase(nPageID);
+    _iFrameVec[nFrameID] = {NULL_PAGE, 0, false, false, false};
+    _pArena->Free(nFrameID);
+  }
+  iLock.unlock();
+  _iLoadCond.notify_all();
+  if (pError) std::rethrow_exception(pError);
+  return pData;
+}
+
+void BufferPool::Unpin(PageID nPageID, bool bDirty) {
+  std::lock_guard<std::mutex> iGuard(_iMutex);
+  auto it = _iFrameMap.find(nPageID);
+  if (it == _iFrameMap.end()) throw PageNotInitException(nPageID);
+  Frame &iFrame = _iFrameVec[it->second];
+  if (iFrame.nPin == 0) throw OsException();
+  --iFrame.nPin;
+  if (bDirty) MarkDirty(it->second);
+}
+
+void BufferPool::Drop(PageID nPageID) {
+  std::unique_lock<std::mutex> iLock(_iMutex);
+  auto it = Find(iLock, nPageID);
+  if (it == _iFrameMap.end()) return;
+  Frame &iFrame = _iFrameVec[it->second];
+  if (iFrame.nPin > 0) throw OsException();
+  if (iFrame.bDirty) --_nDirty;
+  _pQueue->Cancel(nPageID);
+  iFrame = {NULL_PAGE, 0, false, false, false};
+  _pArena->Free(it->second);
+  _iFrameMap.erase(it);
+}
+
+// 被固定的帧内容可能正被持有者修改，复制出的页面可能不完整，
+// 这些帧保持为脏，由下一次 Flush 或淘汰时写回最终内容
+Size BufferPool::Flush() {
+  Size nTotal = 0;
+  FrameID nFrom = 0;
+  while (nFrom < _nFrames && _nDirty > 0) {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    for (Size nSubmit = 0; nFrom < _nFrames && nSubmit < IO_QUEUE_PAGES;
+         ++nFrom) {
+      if (_iFrameVec[nFrom].nPageID == NULL_PAGE || !_iFrameVec[nFrom].bDirty ||
+          _iFrameVec[nFrom].nPin > 0)
+        continue;
+      WriteFrame(nFrom);
+      ++nSubmit;
+      ++nTotal;
+    }
+  }
+  // 淘汰时提交的页面也一并等待
+  _pQueue->Wait();
+  return nTotal;
+}
+
+Size BufferPool::Load(const std::vector<PageID> &iPageVec) {
+  // 直接从数据文件读入，先等待队列中的内容写出
+  _pQueue->Wait();
+  std::lock_guard<std::mutex> iGuard(_iMutex);
+  FrameList iLoadList;
+  for (const auto &nPageID : iPageVec) {
+    if (_iFrameMap.find(nPageID) != _iFrameMap.end()) continue;
+    FrameID nFrameID = _pArena->Allocate();
+    if (nFrameID == NULL_FRAME) break;
+    iLoadList.push_back({nPageID, nFrameID});
+  }
+  try {
+    ReadRuns(iLoadList);
+  } catch (const PageIOException &e) {
+    for (const auto &iPair : iLoadList) _pArena->Free(iPair.second);
+    throw;
+  }
+  for (const auto &iPair : iLoadList) {
+    _iFrameVec[iPair.second] = {iPair.first, 0, false, false, false};
+    _iFrameMap[iPair.first] = iPair.second;
+  }
+  return iLoadList.size();
+}
+
+Size BufferPool::Prefetch(const std::vector<PageID> &iPageVec) {
+  FrameList iLoadList;
+  {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    for (const auto &nPageID : iPageVec) {
+      if (iLoadList.size() >= _nFrames / 4) break;
+      if (_iFrameMap.find(nPageID) != _iFrameMap.end()) continue;
+      FrameID nFrameID = TryVictim();
+      if (nFrameID == NULL_FRAME) break;
+      _iFrameMap[nPageID] = nFrameID;
+      // 访问位置1，使页面在被扫描到之前至少经历一轮 Clock
+      _iFrameVec[nFrameID] = {nPageID, 0, false, true, false};
+      if (_pQueue->Read(nPageID, _iPageVec[nFrameID].GetData())) continue;
+      _iFrameVec[nFrameID].bLoading = true;
+      iLoadList.push_back({nPageID, nFrameID});
+    }
+  }
+  bool bSuccess = true;
+  try {
+    ReadRuns(iLoadList);
+  } catch (const PageIOException &e) {
+    bSuccess = false;
+  }
+  {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    for (const auto &iPair : iLoadList) {
+      _iFrameVec[iPair.second].bLoading = false;
+      if (bSuccess) continue;
+      // 读入失败时放弃这些页面，之后的 Pin 会重新读取并报告错误
+      _iFrameMap.erase(iPair.first);
+      _iFrameVec[iPair.second] = {NULL_PAGE, 0, false, false, false};
+      _pArena->Free(iPair.second);
+    }
+  }
+  _iLoadCond.notify_all();
+  return bSuccess ? iLoadList.size() : 0;
+}
+
+Size BufferPool::GetDirtySize() const { return _nDirty; }
+
+Size BufferPool::GetFrameSize() const { return _nFrames; }
+
+Size BufferPool::GetResidentSize() const { return _iFrameMap.size(); }
+
+void BufferPool::MarkDirty(FrameID nFrameID) {
+  if (_iFrameVec[nFrameID].bDirty) return;
+  _iFrameVec[nFrameID].bDirty = true;
+  ++_nDirty;
+}
+
+std::unordered_map<PageID, FrameID>::iterator BufferPool::Find(
+    std::unique_lock<std::mutex> &iLock, PageID nPageID) {
+  auto it = _iFrameMap.find(nPageID);
+  while (it != _iFrameMap.end() && _iFrameVec[it->second].bLoading) {
+    _iLoadCond.wait(iLock);
+    it = _iFrameMap.find(nPageID);
+  }
+  return it;
+}
+
+FrameID BufferPool::Victim() {
+  FrameID nFrameID = TryVictim();
+  if (nFrameID == NULL_FRAME) throw BufferPoolFullException();
+  return nFrameID;
+}
+
+// Clock 算法：跳过被固定和正在读入的帧，访问位为1的帧给第二次机会
+FrameID BufferPool::TryVictim() {
+  FrameID nFrameID = _pArena->Allocate();
+  if (nFrameID != NULL_FRAME) return nFrameID;
+  for (Size nStep = 0; nStep < 2 * _nFrames; ++nStep) {
+    nFrameID = _nClock;
+    _nClock = (_nClock + 1) % _nFrames;
+    Frame &iFrame = _iFrameVec[nFrameID];
+    if (iFrame.nPin > 0 || iFrame.bLoading) continue;
+    if (iFrame.bRef) {
+      iFrame.bRef = false;
+      continue;
+    }
+    if (iFrame.bDirty) WriteFrame(nFrameID);
+    _iFrameMap.erase(iFrame.nPageID);
+    iFrame = {NULL_PAGE, 0, false, false, false};
+    return nFrameID;
+  }
+  return NULL_FRAME;
+}
+
+void BufferPool::ReadRuns(FrameList &iFrameList) {
+  std::sort(iFrameList.begin(), iFrameList.end());
+  // 每个批次为 [iRunVec[i], iRunVec[i + 1])
+  std::vector<Size> iRunVec;
+  for (Size i = 0; i < iFrameList.size(); ++i) {
+    PageID nPageID = iFrameList[i].first;
+    if (i == 0 || nPageID != iFrameList[i - 1].first + 1 ||
+        DataFile::GetSegment(nPageID) != DataFile::GetSegment(nPageID - 1) ||
+        i - iRunVec.back() == IO_BATCH_PAGES)
+      iRunVec.push_back(i);
+  }
+  iRunVec.push_back(iFrameList.size());
+  std::vector<uint8_t *> iDataVec;
+  for (const auto &iPair : iFrameList)
+    iDataVec.push_back(_iPageVec[iPair.second].GetData());
+  ParallelFor(iRunVec.size() - 1, IO_THREADS, [&](Size nRun) {
+    Size nBegin = iRunVec[nRun], nPages = iRunVec[nRun + 1] - nBegin;
+    _pFile->ReadRun(iFrameList[nBegin].first, &iDataVec[nBegin], nPages);
+  });
+}
+
+// 提交到写回队列后帧立即变为干净的，可以被淘汰或复用
+void BufferPool::WriteFrame(FrameID nFrameID) {
+  _pQueue->Submit(_iFrameVec[nFrameID].nPageID,
+                  _iPageVec[nFrameID].GetData());
+  _iFrameVec[nFrameID].bDirty = false;
+  --_nDirty;
+}
+
+}  // namespace thdb
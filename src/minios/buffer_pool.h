@@ -0,0 +1,111 @@
+#ifndef THDB_BUFFER_POOL_H_
+#define THDB_BUFFER_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "defines.h"
+#include "minios/data_file.h"
+#include "minios/frame_arena.h"
+#include "minios/io_queue.h"
+#include "minios/page_store.h"
+#include "minios/raw_page.h"
+
+namespace thdb {
+
+/**
+ * @brief 固定帧数的缓冲池，按需从数据文件中换入页面。
+ * 页面在数据文件中的位置固定，使用 Clock 算法淘汰未被固定的帧，
+ * 脏帧在被淘汰或 Flush 时提交到异步写回队列，不阻塞查询线程。
+ */
+class BufferPool : public PageStore {
+ public:
+  /**
+   * @brief 构建缓冲池
+   *
+   * @param pFile 数据文件，由调用者负责释放
+   * @param nFrames 帧数量
+   */
+  BufferPool(DataFile *pFile, Size nFrames);
+  ~BufferPool();
+
+  /**
+   * @brief 固定一个页面，不在缓冲池中时换入，新页面不读盘
+   */
+  uint8_t *Pin(PageID nPageID, bool bNew = false) override;
+  void Unpin(PageID nPageID, bool bDirty) override;
+  /**
+   * @brief 丢弃页面所在的帧，不写回
+   */
+  void Drop(PageID nPageID) override;
+  /**
+   * @brief 将所有脏帧提交到写回队列并等待写出，由 I/O 线程合并为连续的批次并行写回。
+   * 每提交 IO_QUEUE_PAGES 个页面释放一次锁，不会长时间阻塞其他访问。
+   * 被固定的脏帧不提交，保持为脏，由之后的 Flush 或淘汰写回
+   */
+  Size Flush() override;
+  /**
+   * @brief 预先读入一组页面，只使用空闲帧，不会淘汰已缓存的页面
+   *
+   * @return Size 读入的页面数量
+   */
+  Size Load(const std::vector<PageID> &iPageVec);
+  Size GetDirtySize() const override;
+  /**
+   * @brief 换入一批页面而不阻塞其他访问。
+   * 先在锁内为页面预留帧，再在锁外合并读入，读入期间固定这些页面的线程等待读入完成。
+   * 每次最多占用四分之一的帧，避免淘汰正在使用的页面
+   */
+  Size Prefetch(const std::vector<PageID> &iPageVec) override;
+
+  Size GetFrameSize() const;
+  Size GetResidentSize() const;
+
+ private:
+  struct Frame {
+    PageID nPageID;
+    Size nPin;
+    bool bDirty;
+    bool bRef;
+    // 正在由 Pin 或 Prefetch 在锁外读入
+    bool bLoading;
+  };
+
+  typedef std::vector<std::pair<PageID, FrameID>> FrameList;
+
+  /**
+   * @brief 将帧按页面编号排序并划分为同一段内的连续批次，并行读入
+   */
+  void ReadRuns(FrameList &iFrameList);
+  /**
+   * @brief 查找页面所在的帧，页面正在读入时等待读入完成
+   */
+  std::unordered_map<PageID, FrameID>::iterator Find(
+      std::unique_lock<std::mutex> &iLock, PageID nPageID);
+  FrameID Victim();
+  /**
+   * @brief 与 Victim 相同，但没有可淘汰的帧时返回 NULL_FRAME
+   */
+  FrameID TryVictim();
+  void MarkDirty(FrameID nFrameID);
+  void WriteFrame(FrameID nFrameID);
+
+  DataFile *_pFile;
+  Size _nFrames;
+  FrameArena *_pArena;
+  IOQueue *_pQueue;
+  std::vector<RawPage> _iPageVec;
+  std::vector<Frame> _iFrameVec;
+  std::unordered_map<PageID, FrameID> _iFrameMap;
+  FrameID _nClock;
+  std::atomic<Size> _nDirty;
+  std::mutex _iMutex;
+  std::condition_variable _iLoadCond;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_BUFFER_POOL_H_
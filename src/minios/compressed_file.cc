@@ -0,0 +1,225 @@
+#include "minios/compressed_file.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+
+namespace thdb {
+
+// 编码后页面的存储单位
+const Size SECTOR_SIZE = 512;
+const uint32_t PAGE_SECTORS = PAGE_SIZE / SECTOR_SIZE;
+
+static uint64_t ElapsedNs(std::chrono::steady_clock::time_point iBegin) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - iBegin)
+      .count();
+}
+
+CompressedFile::CompressedFile(PageCodec *pCodec)
+    : _pCodec(pCodec),
+      _iSegmentVec(DB_PAGES / SEGMENT_PAGES, nullptr),
+      _nWritePages(0),
+      _nZeroPages(0),
+      _nStoredBytes(0),
+      _nEncodeNs(0),
+      _nDecodeNs(0) {}
+
+CompressedFile::~CompressedFile() {
+  Sync();
+  for (const auto &pSegment : _iSegmentVec)
+    if (pSegment) delete pSegment;
+  delete _pCodec;
+}
+
+void CompressedFile::Read(PageID nPageID, uint8_t *pData) {
+  Segment *pSegment = GetDirectory(GetSegment(nPageID));
+  Entry iEntry;
+  {
+    std::lock_guard<std::mutex> iGuard(pSegment->iMutex);
+    iEntry = pSegment->iEntryVec[nPageID % SEGMENT_PAGES];
+  }
+  uint8_t pBuffer[PAGE_SIZE];
+  if (iEntry.nLength > 0 &&
+      pread(GetFD(GetSegment(nPageID)), pBuffer, iEntry.nLength,
+            (off_t)iEntry.nSector * SECTOR_SIZE) != iEntry.nLength)
+    throw PageIOException(nPageID);
+  auto iBegin = std::chrono::steady_clock::now();
+  _pCodec->Decode(nPageID, pBuffer, iEntry.nLength, pData);
+  _nDecodeNs += ElapsedNs(iBegin);
+}
+
+void CompressedFile::Write(PageID nPageID, const uint8_t *pData) {
+  Segment *pSegment = GetDirectory(GetSegment(nPageID));
+  uint8_t pBuffer[PAGE_SIZE];
+  auto iBegin = std::chrono::steady_clock::now();
+  PageOffset nLength = _pCodec->Encode(pData, pBuffer);
+  _nEncodeNs += ElapsedNs(iBegin);
+  Extent iExtent = {0, GetSectors(nLength)};
+  if (iExtent.nSectors > 0) {
+    {
+      std::lock_guard<std::mutex> iGuard(pSegment->iMutex);
+      iExtent.nSector = AllocateSectors(pSegment, iExtent.nSectors);
+    }
+    if (pwrite(GetFD(GetSegment(nPageID)), pBuffer, nLength,
+               (off_t)iExtent.nSector * SECTOR_SIZE) != nLength) {
+      std::lock_guard<std::mutex> iGuard(pSegment->iMutex);
+      FreeSectors(pSegment, iExtent);
+      throw PageIOException(nPageID);
+    }
+  }
+  {
+    std::lock_guard<std::mutex> iGuard(pSegment->iMutex);
+    Entry &iEntry = pSegment->iEntryVec[nPageID % SEGMENT_PAGES];
+    if (iEntry.nLength > 0)
+      pSegment->iPendingVec.push_back(
+          {iEntry.nSector, GetSectors(iEntry.nLength)});
+    iEntry = {iExtent.nSector, nLength, 0};
+    pSegment->bDirty = true;
+  }
+  ++_nWritePages;
+  if (nLength == 0) ++_nZeroPages;
+  _nStoredBytes += iExtent.nSectors * SECTOR_SIZE;
+}
+
+// 编码后的页面长度不一，逐页读写
+void CompressedFile::ReadRun(PageID nFirstID, uint8_t *const *pDataVec,
+                             Size nPages) {
+  for (Size i = 0; i < nPages; ++i) Read(nFirstID + i, pDataVec[i]);
+}
+
+void CompressedFile::WriteRun(PageID nFirstID, uint8_t *const *pDataVec,
+                              Size nPages) {
+  for (Size i = 0; i < nPages; ++i) Write(nFirstID + i, pDataVec[i]);
+}
+
+// 与位图相同，先写入临时文件再重命名
+void CompressedFile::Sync() {
+  for (Size i = 0; i < _iSegmentVec.size(); ++i) {
+    Segment *pSegment = nullptr;
+    {
+      std::lock_guard<std::mutex> iGuard(_iSegmentMutex);
+      pSegment = _iSegmentVec[i];
+    }
+    if (!pSegment) continue;
+    std::vector<Entry> iEntryVec;
+    std::vector<Extent> iPendingVec;
+    {
+      std::lock_guard<std::mutex> iGuard(pSegment->iMutex);
+      if (!pSegment->bDirty) continue;
+      // 只保存到最后一个非空的页面，加载时其余页面视为全0
+      Size nEntries = SEGMENT_PAGES;
+      while (nEntries > 0 && pSegment->iEntryVec[nEntries - 1].nLength == 0)
+        --nEntries;
+      iEntryVec.assign(pSegment->iEntryVec.begin(),
+                       pSegment->iEntryVec.begin() + nEntries);
+      iPendingVec.swap(pSegment->iPendingVec);
+      pSegment->bDirty = false;
+    }
+    String sName = SegmentName("THDB_PAGEDIR", i);
+    bool bSaved = fsync(GetFD(i)) == 0;
+    if (bSaved) {
+      std::ofstream fout(sName + ".tmp", std::ios::binary);
+      fout.write((char *)iEntryVec.data(), iEntryVec.size() * sizeof(Entry));
+      fout.close();
+      bSaved = fout && rename((sName + ".tmp").c_str(), sName.c_str()) == 0;
+    }
+    std::lock_guard<std::mutex> iGuard(pSegment->iMutex);
+    if (bSaved) {
+      for (const auto &iExtent : iPendingVec) FreeSectors(pSegment, iExtent);
+    } else {
+      // 保存失败时旧扇区仍被引用，下一次 Sync 重试
+      pSegment->iPendingVec.insert(pSegment->iPendingVec.end(),
+                                   iPendingVec.begin(), iPendingVec.end());
+      pSegment->bDirty = true;
+    }
+  }
+}
+
+String CompressedFile::GetStats() const {
+  char sBuffer[256];
+  double fRawMB = (double)_nWritePages * PAGE_SIZE / (1 << 20);
+  double fStoredMB = (double)_nStoredBytes / (1 << 20);
+  snprintf(sBuffer, sizeof(sBuffer),
+           "codec %s: %lu pages written (%lu zero), %.1f MB -> %.1f MB "
+           "(%.1f%%), encode %.3f s, decode %.3f s",
+           _pCodec->GetName().c_str(), (unsigned long)_nWritePages,
+           (unsigned long)_nZeroPages, fRawMB, fStoredMB,
+           fRawMB > 0 ? fStoredMB * 100 / fRawMB : 0.0, _nEncodeNs / 1e9,
+           _nDecodeNs / 1e9);
+  return sBuffer;
+}
+
+CompressedFile::Segment *CompressedFile::GetDirectory(Size nSegment) {
+  std::lock_guard<std::mutex> iGuard(_iSegmentMutex);
+  if (nSegment >= _iSegmentVec.size()) throw OsException();
+  if (!_iSegmentVec[nSegment]) {
+    Segment *pSegment = new Segment();
+    LoadDirectory(nSegment, pSegment);
+    _iSegmentVec[nSegment] = pSegment;
+  }
+  return _iSegmentVec[nSegment];
+}
+
+// 加载页面目录，目录没有引用的扇区都是空闲的
+void CompressedFile::LoadDirectory(Size nSegment, Segment *pSegment) {
+  pSegment->iEntryVec.assign(SEGMENT_PAGES, {0, 0, 0});
+  pSegment->iFreeVec.resize(PAGE_SECTORS + 1);
+  pSegment->nTail = 0;
+  pSegment->bDirty = false;
+  std::ifstream fin(SegmentName("THDB_PAGEDIR", nSegment), std::ios::binary);
+  if (fin) {
+    fin.read((char *)pSegment->iEntryVec.data(),
+             pSegment->iEntryVec.size() * sizeof(Entry));
+    fin.close();
+  }
+  std::vector<Extent> iUsedVec;
+  for (const auto &iEntry : pSegment->iEntryVec)
+    if (iEntry.nLength > 0)
+      iUsedVec.push_back({iEntry.nSector, GetSectors(iEntry.nLength)});
+  std::sort(iUsedVec.begin(), iUsedVec.end(),
+            [](const Extent &a, const Extent &b) {
+              return a.nSector < b.nSector;
+            });
+  for (const auto &iExtent : iUsedVec) {
+    for (uint32_t nGap = pSegment->nTail; nGap < iExtent.nSector;) {
+      uint32_t nSectors = std::min(iExtent.nSector - nGap, PAGE_SECTORS);
+      pSegment->iFreeVec[nSectors].push_back(nGap);
+      nGap += nSectors;
+    }
+    pSegment->nTail = iExtent.nSector + iExtent.nSectors;
+  }
+}
+
+// 优先使用大小恰好的空闲扇区，其次拆分更大的空闲扇区，最后追加到文件末尾
+uint32_t CompressedFile::AllocateSectors(Segment *pSegment,
+                                         uint32_t nSectors) {
+  for (uint32_t i = nSectors; i <= PAGE_SECTORS; ++i) {
+    if (pSegment->iFreeVec[i].empty()) continue;
+    uint32_t nSector = pSegment->iFreeVec[i].back();
+    pSegment->iFreeVec[i].pop_back();
+    if (i > nSectors)
+      FreeSectors(pSegment, {nSector + nSectors, i - nSectors});
+    return nSector;
+  }
+  uint32_t nSector = pSegment->nTail;
+  pSegment->nTail += nSectors;
+  return nSector;
+}
+
+void CompressedFile::FreeSectors(Segment *pSegment, const Extent &iExtent) {
+  pSegment->iFreeVec[iExtent.nSectors].push_back(iExtent.nSector);
+}
+
+uint32_t CompressedFile::GetSectors(PageOffset nLength) {
+  return (nLength + SECTOR_SIZE - 1) / SECTOR_SIZE;
+}
+
+}  // namespace thdb
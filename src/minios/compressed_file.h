@@ -0,0 +1,84 @@
+#ifndef THDB_COMPRESSED_FILE_H_
+#define THDB_COMPRESSED_FILE_H_
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "defines.h"
+#include "minios/data_file.h"
+#include "minios/page_codec.h"
+
+namespace thdb {
+
+/**
+ * @brief 经过 PageCodec 压缩的数据文件。
+ * 段文件以 SECTOR_SIZE 为单位紧凑存放编码后的页面，每段的页面目录
+ * THDB_PAGEDIR.k 记录各页面所在的扇区和编码后的长度，全0页面不占用空间。
+ * 页面每次写回都放到新的扇区，旧扇区在页面目录持久化之后才会被复用，
+ * 因此已保存的页面目录引用的内容总是完整的。
+ */
+class CompressedFile : public DataFile {
+ public:
+  /**
+   * @param pCodec 页面编码器，由 CompressedFile 负责释放
+   */
+  CompressedFile(PageCodec *pCodec);
+  ~CompressedFile();
+
+  void Read(PageID nPageID, uint8_t *pData) override;
+  void Write(PageID nPageID, const uint8_t *pData) override;
+  void ReadRun(PageID nFirstID, uint8_t *const *pDataVec,
+               Size nPages) override;
+  void WriteRun(PageID nFirstID, uint8_t *const *pDataVec,
+                Size nPages) override;
+  /**
+   * @brief 保存修改过的页面目录，并释放其中不再引用的扇区
+   */
+  void Sync() override;
+  String GetStats() const override;
+
+ private:
+  struct Entry {
+    uint32_t nSector;
+    uint16_t nLength;
+    uint16_t nReserved;
+  };
+  struct Extent {
+    uint32_t nSector;
+    uint32_t nSectors;
+  };
+  struct Segment {
+    std::vector<Entry> iEntryVec;
+    // 按扇区数量分类的空闲扇区，下标为扇区数量
+    std::vector<std::vector<uint32_t>> iFreeVec;
+    // 已被替换但仍被磁盘上的页面目录引用的扇区
+    std::vector<Extent> iPendingVec;
+    uint32_t nTail;
+    bool bDirty;
+    std::mutex iMutex;
+  };
+
+  /**
+   * @brief 获取段的页面目录，第一次访问时从磁盘加载
+   */
+  Segment *GetDirectory(Size nSegment);
+  void LoadDirectory(Size nSegment, Segment *pSegment);
+  uint32_t AllocateSectors(Segment *pSegment, uint32_t nSectors);
+  void FreeSectors(Segment *pSegment, const Extent &iExtent);
+  static uint32_t GetSectors(PageOffset nLength);
+
+  PageCodec *_pCodec;
+  std::vector<Segment *> _iSegmentVec;
+  std::mutex _iSegmentMutex;
+
+  std::atomic<Size> _nWritePages;
+  std::atomic<Size> _nZeroPages;
+  std::atomic<uint64_t> _nStoredBytes;
+  std::atomic<uint64_t> _nEncodeNs;
+  std::atomic<uint64_t> _nDecodeNs;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_COMPRESSED_FILE_H_
@@ -0,0 +1,96 @@
+#include "minios/data_file.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+
+namespace thdb {
+
+String SegmentName(const String &sBase, Size nSegment) {
+  if (nSegment == 0) return sBase;
+  return sBase + "." + std::to_string(nSegment);
+}
+
+DataFile::DataFile(bool bDirect)
+    : _bDirect(bDirect), _iFDVec(DB_PAGES / SEGMENT_PAGES, -1) {}
+
+DataFile::~DataFile() {
+  for (const auto &fd : _iFDVec)
+    if (fd >= 0) close(fd);
+}
+
+int DataFile::GetFD(Size nSegment) {
+  std::lock_guard<std::mutex> iGuard(_iMutex);
+  if (nSegment >= _iFDVec.size()) throw OsException();
+  if (_iFDVec[nSegment] < 0) {
+    String sName = SegmentName("THDB_PAGE", nSegment);
+    int nFlags = O_RDWR | O_CREAT;
+#ifdef O_DIRECT
+    if (_bDirect) nFlags |= O_DIRECT;
+#endif
+    _iFDVec[nSegment] = open(sName.c_str(), nFlags, 0644);
+    // tmpfs 等文件系统不支持 O_DIRECT
+    if (_iFDVec[nSegment] < 0 && _bDirect && errno == EINVAL)
+      _iFDVec[nSegment] = open(sName.c_str(), O_RDWR | O_CREAT, 0644);
+    if (_iFDVec[nSegment] < 0) throw OsException();
+  }
+  return _iFDVec[nSegment];
+}
+
+void DataFile::Read(PageID nPageID, uint8_t *pData) {
+  ssize_t nRead =
+      pread(GetFD(GetSegment(nPageID)), pData, PAGE_SIZE, GetOffset(nPageID));
+  if (nRead < 0) throw PageIOException(nPageID);
+  if (nRead < PAGE_SIZE) memset(pData + nRead, 0, PAGE_SIZE - nRead);
+}
+
+void DataFile::Write(PageID nPageID, const uint8_t *pData) {
+  if (pwrite(GetFD(GetSegment(nPageID)), pData, PAGE_SIZE,
+             GetOffset(nPageID)) != PAGE_SIZE)
+    throw PageIOException(nPageID);
+}
+
+void DataFile::ReadRun(PageID nFirstID, uint8_t *const *pDataVec,
+                       Size nPages) {
+  std::vector<struct iovec> iIOVec(nPages);
+  for (Size i = 0; i < nPages; ++i) iIOVec[i] = {pDataVec[i], PAGE_SIZE};
+  ssize_t nRead = preadv(GetFD(GetSegment(nFirstID)), iIOVec.data(), nPages,
+                         GetOffset(nFirstID));
+  if (nRead < 0) throw PageIOException(nFirstID);
+  // 文件末尾之后的部分视为全0
+  for (Size i = 0; i < nPages; ++i) {
+    ssize_t nBegin = (ssize_t)i * PAGE_SIZE;
+    if (nRead >= nBegin + PAGE_SIZE) continue;
+    Size nValid = nRead > nBegin ? nRead - nBegin : 0;
+    memset(pDataVec[i] + nValid, 0, PAGE_SIZE - nValid);
+  }
+}
+
+void DataFile::WriteRun(PageID nFirstID, uint8_t *const *pDataVec,
+                        Size nPages) {
+  std::vector<struct iovec> iIOVec(nPages);
+  for (Size i = 0; i < nPages; ++i) iIOVec[i] = {pDataVec[i], PAGE_SIZE};
+  ssize_t nWrite = pwritev(GetFD(GetSegment(nFirstID)), iIOVec.data(), nPages,
+                           GetOffset(nFirstID));
+  if (nWrite == (ssize_t)nPages * PAGE_SIZE) return;
+  // 只写入了一部分时逐页补写
+  for (Size i = 0; i < nPages; ++i) Write(nFirstID + i, pDataVec[i]);
+}
+
+void DataFile::Sync() {}
+
+String DataFile::GetStats() const { return ""; }
+
+Size DataFile::GetSegment(PageID nPageID) { return nPageID / SEGMENT_PAGES; }
+
+off_t DataFile::GetOffset(PageID nPageID) {
+  return (off_t)(nPageID % SEGMENT_PAGES) * PAGE_SIZE;
+}
+
+}  // namespace thdb
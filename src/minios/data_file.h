@@ -0,0 +1,75 @@
+#ifndef THDB_DATA_FILE_H_
+#define THDB_DATA_FILE_H_
+
+#include <sys/types.h>
+
+#include <mutex>
+#include <vector>
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief 第 nSegment 段对应的文件名，第0段为 sBase 本身，其余为 sBase.nSegment
+ */
+String SegmentName(const String &sBase, Size nSegment);
+
+/**
+ * @brief 分段存储的数据文件。
+ * 第 k 段文件保存页面 [k * SEGMENT_PAGES, (k + 1) * SEGMENT_PAGES)，
+ * 页面在段内的位置固定为 (nPageID % SEGMENT_PAGES) * PAGE_SIZE。
+ * 段文件在第一次访问时才打开或创建，未使用的地址空间不占用磁盘和文件描述符。
+ */
+class DataFile {
+ public:
+  /**
+   * @param bDirect 是否以 O_DIRECT 打开段文件，此时读写的内存必须按 PAGE_SIZE 对齐。
+   * 文件系统不支持 O_DIRECT 时自动退回普通读写
+   */
+  DataFile(bool bDirect = false);
+  virtual ~DataFile();
+
+  /**
+   * @brief 获取段文件的描述符，不存在时创建
+   */
+  int GetFD(Size nSegment);
+  /**
+   * @brief 读入一个页面，文件末尾之后的部分视为全0
+   */
+  virtual void Read(PageID nPageID, uint8_t *pData);
+  virtual void Write(PageID nPageID, const uint8_t *pData);
+  /**
+   * @brief 用一次 preadv 读入从 nFirstID 开始的 nPages 个连续页面
+   * 页面必须位于同一段内，nPages 不超过 IOV_MAX
+   *
+   * @param pDataVec 各页面对应的帧地址
+   */
+  virtual void ReadRun(PageID nFirstID, uint8_t *const *pDataVec,
+                       Size nPages);
+  /**
+   * @brief 用一次 pwritev 写回从 nFirstID 开始的 nPages 个连续页面
+   */
+  virtual void WriteRun(PageID nFirstID, uint8_t *const *pDataVec,
+                        Size nPages);
+  /**
+   * @brief 持久化数据文件自身的元数据，在写回页面之后、保存位图之前调用
+   */
+  virtual void Sync();
+  /**
+   * @brief 返回读写统计信息，没有统计时为空串
+   */
+  virtual String GetStats() const;
+
+  static Size GetSegment(PageID nPageID);
+  static off_t GetOffset(PageID nPageID);
+
+ private:
+  bool _bDirect;
+  std::vector<int> _iFDVec;
+  std::mutex _iMutex;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_DATA_FILE_H_
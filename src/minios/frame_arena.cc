@@ -0,0 +1,52 @@
+#include "minios/frame_arena.h"
+
+#include <sys/mman.h>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+
+namespace thdb {
+
+const size_t HUGE_PAGE_SIZE = 2U << 20;
+
+FrameArena::FrameArena(Size nFrames) : _nFrames(nFrames) {
+  if (_nFrames == 0) throw BufferPoolFullException();
+  // 多映射一个大页的长度，从中截取按大页对齐的部分
+  size_t nSize = (size_t)_nFrames * PAGE_SIZE;
+  _nMapSize = nSize + HUGE_PAGE_SIZE;
+  void *pMap = mmap(nullptr, _nMapSize, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (pMap == MAP_FAILED) throw OsException();
+  _pMap = (uint8_t *)pMap;
+  _pBase = (uint8_t *)(((uintptr_t)_pMap + HUGE_PAGE_SIZE - 1) &
+                       ~(uintptr_t)(HUGE_PAGE_SIZE - 1));
+#ifdef MADV_HUGEPAGE
+  // 透明大页不可用时 madvise 失败，不影响正确性
+  madvise(_pBase, nSize, MADV_HUGEPAGE);
+#endif
+  // 匿名映射本身就是全0，不需要再初始化
+  _iFreeVec.reserve(_nFrames);
+  // 倒序压栈，使得先分配编号小的帧
+  for (FrameID i = _nFrames; i > 0; --i) _iFreeVec.push_back(i - 1);
+}
+
+FrameArena::~FrameArena() { munmap(_pMap, _nMapSize); }
+
+FrameID FrameArena::Allocate() {
+  if (_iFreeVec.empty()) return NULL_FRAME;
+  FrameID nFrameID = _iFreeVec.back();
+  _iFreeVec.pop_back();
+  return nFrameID;
+}
+
+void FrameArena::Free(FrameID nFrameID) { _iFreeVec.push_back(nFrameID); }
+
+uint8_t *FrameArena::GetFrame(FrameID nFrameID) const {
+  return _pBase + (size_t)nFrameID * PAGE_SIZE;
+}
+
+Size FrameArena::GetFrameSize() const { return _nFrames; }
+
+Size FrameArena::GetFreeSize() const { return _iFreeVec.size(); }
+
+}  // namespace thdb
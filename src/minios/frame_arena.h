@@ -0,0 +1,50 @@
+#ifndef THDB_FRAME_ARENA_H_
+#define THDB_FRAME_ARENA_H_
+
+#include <vector>
+
+#include "defines.h"
+
+namespace thdb {
+
+typedef uint32_t FrameID;
+
+const FrameID NULL_FRAME = 0xFFFFFFFF;
+
+/**
+ * @brief 缓冲池帧的内存区域。
+ * 所有帧位于一整块按 2MB 对齐的匿名映射中，并通过 madvise 申请透明大页，
+ * 减少 TLB 项的占用；帧的分配和回收只操作空闲帧栈，不进行堆分配。
+ * 每个帧都按 PAGE_SIZE 对齐，可以直接用于 O_DIRECT 读写。
+ */
+class FrameArena {
+ public:
+  FrameArena(Size nFrames);
+  ~FrameArena();
+
+  /**
+   * @brief 从空闲帧栈中取出一个帧
+   *
+   * @return FrameID 没有空闲帧时返回 NULL_FRAME
+   */
+  FrameID Allocate();
+  /**
+   * @brief 将帧放回空闲帧栈
+   */
+  void Free(FrameID nFrameID);
+
+  uint8_t *GetFrame(FrameID nFrameID) const;
+  Size GetFrameSize() const;
+  Size GetFreeSize() const;
+
+ private:
+  uint8_t *_pMap;
+  size_t _nMapSize;
+  uint8_t *_pBase;
+  Size _nFrames;
+  std::vector<FrameID> _iFreeVec;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_FRAME_ARENA_H_
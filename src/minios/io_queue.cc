@@ -0,0 +1,193 @@
+#include "minios/io_queue.h"
+
+#include <cstring>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+#include "settings.h"
+
+namespace thdb {
+
+IOQueue::IOQueue(DataFile *pFile, Size nThreads, Size nCapacity)
+    : _pFile(pFile),
+      _nSeq(0),
+      _nCursor(0),
+      _bStop(false),
+      _bError(false),
+      _nErrorID(NULL_PAGE) {
+  // 缓冲帧按 PAGE_SIZE 对齐，O_DIRECT 模式下可以直接写出
+  _pArena = new FrameArena(nCapacity);
+  for (Size i = 0; i < nThreads; ++i)
+    _iThreadVec.push_back(std::thread(&IOQueue::WorkerLoop, this));
+}
+
+IOQueue::~IOQueue() {
+  try {
+    Wait();
+  } catch (const PageIOException &e) {
+    // 无法写出的页面只能丢弃
+  }
+  {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    _bStop = true;
+    _bError = true;
+  }
+  _iWorkCond.notify_all();
+  for (auto &iThread : _iThreadVec) iThread.join();
+  delete _pArena;
+}
+
+void IOQueue::Submit(PageID nPageID, const uint8_t *pData,
+                     const IOCallback &iCallback) {
+  std::unique_lock<std::mutex> iLock(_iMutex);
+  auto it = _iPendingMap.find(nPageID);
+  if (it == _iPendingMap.end()) {
+    // 队列满时等待 I/O 线程写出
+    while (_pArena->GetFreeSize() == 0) {
+      if (_bError) {
+        _bError = false;
+        _iWorkCond.notify_all();
+        throw PageIOException(_nErrorID);
+      }
+      _iDoneCond.wait(iLock);
+    }
+    Request iRequest = {_pArena->Allocate(), ++_nSeq, {}};
+    _iSeqSet.insert(iRequest.nSeq);
+    it = _iPendingMap.insert({nPageID, iRequest}).first;
+  }
+  memcpy(_pArena->GetFrame(it->second.nFrameID), pData, PAGE_SIZE);
+  if (iCallback) it->second.iCallbackVec.push_back(iCallback);
+  _iWorkCond.notify_one();
+}
+
+// 尚未写出的内容总是比正在写出的内容新
+bool IOQueue::Read(PageID nPageID, uint8_t *pData) {
+  std::lock_guard<std::mutex> iGuard(_iMutex);
+  FrameID nFrameID = NULL_FRAME;
+  auto it = _iPendingMap.find(nPageID);
+  if (it != _iPendingMap.end()) {
+    nFrameID = it->second.nFrameID;
+  } else {
+    auto jt = _iFlightMap.find(nPageID);
+    if (jt == _iFlightMap.end()) return false;
+    nFrameID = jt->second.nFrameID;
+  }
+  memcpy(pData, _pArena->GetFrame(nFrameID), PAGE_SIZE);
+  return true;
+}
+
+void IOQueue::Cancel(PageID nPageID) {
+  std::vector<IOCallback> iCallbackVec;
+  {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    auto it = _iPendingMap.find(nPageID);
+    if (it == _iPendingMap.end()) return;
+    iCallbackVec.swap(it->second.iCallbackVec);
+    Release(it->second);
+    _iPendingMap.erase(it);
+  }
+  _iDoneCond.notify_all();
+  // 删除的页面不需要写出，视为写入成功
+  for (const auto &iCallback : iCallbackVec) iCallback(nPageID, true);
+}
+
+void IOQueue::Wait() {
+  std::unique_lock<std::mutex> iLock(_iMutex);
+  Size nTarget = _nSeq;
+  _iDoneCond.wait(iLock, [&]() {
+    return _bError || _iSeqSet.empty() || *_iSeqSet.begin() > nTarget;
+  });
+  if (!_bError) return;
+  _bError = false;
+  _iWorkCond.notify_all();
+  throw PageIOException(_nErrorID);
+}
+
+Size IOQueue::GetPendingSize() const {
+  std::lock_guard<std::mutex> iGuard(_iMutex);
+  return _iPendingMap.size() + _iFlightMap.size();
+}
+
+void IOQueue::WorkerLoop() {
+  std::unique_lock<std::mutex> iLock(_iMutex);
+  std::vector<PageID> iRunVec;
+  std::vector<uint8_t *> iDataVec;
+  while (true) {
+    iRunVec.clear();
+    // 出错后暂停写出，直到 Wait 报告错误
+    if (!_bError) NextRun(iRunVec);
+    if (iRunVec.empty()) {
+      if (_bStop) return;
+      _iWorkCond.wait(iLock);
+      continue;
+    }
+    iDataVec.clear();
+    for (const auto &nPageID : iRunVec)
+      iDataVec.push_back(_pArena->GetFrame(_iFlightMap[nPageID].nFrameID));
+    iLock.unlock();
+    bool bSuccess = true;
+    try {
+      _pFile->WriteRun(iRunVec[0], iDataVec.data(), iRunVec.size());
+    } catch (const OsException &e) {
+      bSuccess = false;
+    }
+    iLock.lock();
+    std::vector<std::pair<PageID, std::vector<IOCallback>>> iDoneVec;
+    for (const auto &nPageID : iRunVec) {
+      auto it = _iFlightMap.find(nPageID);
+      iDoneVec.push_back({nPageID, std::move(it->second.iCallbackVec)});
+      // 失败且没有更新的内容时放回队列，保证之后的读取仍然看到这次的内容
+      if (!bSuccess && _iPendingMap.find(nPageID) == _iPendingMap.end()) {
+        it->second.iCallbackVec.clear();
+        _iPendingMap.insert({nPageID, it->second});
+      } else {
+        Release(it->second);
+      }
+      _iFlightMap.erase(it);
+    }
+    if (!bSuccess) {
+      _bError = true;
+      _nErrorID = iRunVec[0];
+    }
+    _iDoneCond.notify_all();
+    // 正在写出的页面可能阻塞了队列中同一页面更新的内容
+    _iWorkCond.notify_all();
+    iLock.unlock();
+    for (const auto &iDone : iDoneVec)
+      for (const auto &iCallback : iDone.second)
+        iCallback(iDone.first, bSuccess);
+    iLock.lock();
+  }
+}
+
+// 电梯式扫描：从上次结束的位置继续，到末尾后回到开头
+void IOQueue::NextRun(std::vector<PageID> &iRunVec) {
+  if (_iPendingMap.empty()) return;
+  auto it = _iPendingMap.lower_bound(_nCursor);
+  bool bFound = false;
+  for (Size i = 0; i < _iPendingMap.size() && !bFound; ++i) {
+    if (it == _iPendingMap.end()) it = _iPendingMap.begin();
+    bFound = _iFlightMap.find(it->first) == _iFlightMap.end();
+    if (!bFound) ++it;
+  }
+  if (!bFound) return;
+  while (it != _iPendingMap.end() && iRunVec.size() < IO_BATCH_PAGES) {
+    PageID nPageID = it->first;
+    if (!iRunVec.empty() &&
+        (nPageID != iRunVec.back() + 1 ||
+         DataFile::GetSegment(nPageID) != DataFile::GetSegment(iRunVec[0]) ||
+         _iFlightMap.find(nPageID) != _iFlightMap.end()))
+      break;
+    iRunVec.push_back(nPageID);
+    _iFlightMap.insert({nPageID, it->second});
+    it = _iPendingMap.erase(it);
+  }
+  _nCursor = iRunVec.back() + 1;
+}
+
+void IOQueue::Release(const Request &iRequest) {
+  _pArena->Free(iRequest.nFrameID);
+  _iSeqSet.erase(iRequest.nSeq);
+}
+
+}  // namespace thdb
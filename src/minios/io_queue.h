@@ -0,0 +1,105 @@
+#ifndef THDB_IO_QUEUE_H_
+#define THDB_IO_QUEUE_H_
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "defines.h"
+#include "minios/data_file.h"
+#include "minios/frame_arena.h"
+
+namespace thdb {
+
+/**
+ * @brief 写操作完成时的回调，bSuccess 为 false 表示写入失败。
+ * 回调在 I/O 线程中执行，不能等待提交者持有的锁。
+ */
+typedef std::function<void(PageID nPageID, bool bSuccess)> IOCallback;
+
+/**
+ * @brief 异步写回队列。
+ * 提交时页面内容被复制到队列自己的缓冲帧中，调用者可以立即复用原来的内存。
+ * 专用的 I/O 线程按页面编号从小到大扫描队列，将同一段内连续的页面合并为
+ * 一次 pwritev。同一页面尚未写出时再次提交只保留最新的内容。
+ * 页面写出之前的读取直接由队列中的内容满足，因此数据文件中的旧内容不可见。
+ */
+class IOQueue {
+ public:
+  /**
+   * @param pFile 数据文件，由调用者负责释放
+   * @param nThreads I/O 线程数
+   * @param nCapacity 最多同时缓存的页面数，队列满时提交阻塞
+   */
+  IOQueue(DataFile *pFile, Size nThreads, Size nCapacity);
+  /**
+   * @brief 等待已提交的写操作完成后结束 I/O 线程
+   */
+  ~IOQueue();
+
+  /**
+   * @brief 提交一个页面的写操作
+   *
+   * @param pData 页面内容，函数返回后即可修改
+   * @param iCallback 写操作完成时的回调，可以为空
+   */
+  void Submit(PageID nPageID, const uint8_t *pData,
+              const IOCallback &iCallback = nullptr);
+  /**
+   * @brief 页面仍在队列中时从队列读取最新内容
+   *
+   * @return bool 页面是否在队列中，为 false 时需要从数据文件读取
+   */
+  bool Read(PageID nPageID, uint8_t *pData);
+  /**
+   * @brief 页面被删除时丢弃尚未开始写出的内容
+   */
+  void Cancel(PageID nPageID);
+  /**
+   * @brief 等待调用之前提交的所有写操作完成，有写操作失败时抛出 PageIOException，
+   * 失败的页面保留在队列中，下一次 Wait 时重试
+   */
+  void Wait();
+  Size GetPendingSize() const;
+
+ private:
+  struct Request {
+    FrameID nFrameID;
+    // 第一次提交时的序号，用于 Wait 判断提交的先后
+    Size nSeq;
+    std::vector<IOCallback> iCallbackVec;
+  };
+
+  void WorkerLoop();
+  /**
+   * @brief 从上次的位置开始取出一批同一段内连续且没有正在写出的页面
+   */
+  void NextRun(std::vector<PageID> &iRunVec);
+  void Release(const Request &iRequest);
+
+  DataFile *_pFile;
+  FrameArena *_pArena;
+  std::map<PageID, Request> _iPendingMap;
+  std::unordered_map<PageID, Request> _iFlightMap;
+  // 所有未完成请求的序号
+  std::set<Size> _iSeqSet;
+  Size _nSeq;
+  PageID _nCursor;
+  bool _bStop;
+  bool _bError;
+  PageID _nErrorID;
+
+  mutable std::mutex _iMutex;
+  std::condition_variable _iWorkCond;
+  std::condition_variable _iDoneCond;
+  std::vector<std::thread> _iThreadVec;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_IO_QUEUE_H_
@@ -0,0 +1,120 @@
+#include "minios/mmap_store.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+
+namespace thdb {
+
+// 段文件每次至少扩展 4MB，避免频繁 ftruncate
+const PageID MMAP_GROW_PAGES = 1024;
+const size_t SEGMENT_BYTES = (size_t)SEGMENT_PAGES * PAGE_SIZE;
+
+MmapStore::MmapStore(DataFile *pFile)
+    : _pFile(pFile),
+      _iSegmentVec(DB_PAGES / SEGMENT_PAGES, nullptr),
+      _nDirty(0) {}
+
+MmapStore::~MmapStore() {
+  Flush();
+  for (Size i = 0; i < _iSegmentVec.size(); ++i) {
+    Segment *pSegment = _iSegmentVec[i];
+    if (!pSegment) continue;
+    munmap(pSegment->pBase, SEGMENT_BYTES);
+    if (pSegment->nUsedSize < pSegment->nFileSize)
+      ftruncate(_pFile->GetFD(i), pSegment->nUsedSize);
+    delete pSegment;
+  }
+}
+
+uint8_t *MmapStore::Pin(PageID nPageID, bool bNew) {
+  if (nPageID >= DB_PAGES) throw PageNotInitException(nPageID);
+  std::lock_guard<std::mutex> iGuard(_iMutex);
+  Segment *pSegment = GetSegment(DataFile::GetSegment(nPageID));
+  off_t nOffset = DataFile::GetOffset(nPageID);
+  if (nOffset + PAGE_SIZE > pSegment->nFileSize) Grow(pSegment, nPageID);
+  if (nOffset + PAGE_SIZE > pSegment->nUsedSize)
+    pSegment->nUsedSize = nOffset + PAGE_SIZE;
+  uint8_t *pData = pSegment->pBase + nOffset;
+  if (bNew) memset(pData, 0, PAGE_SIZE);
+  return pData;
+}
+
+// 映射上的修改由内核跟踪脏页，这里只需要计数
+void MmapStore::Unpin(PageID nPageID, bool bDirty) {
+  if (bDirty) ++_nDirty;
+}
+
+void MmapStore::Drop(PageID nPageID) {}
+
+// msync 只写回内核记录的脏页面，耗时与修改量相关
+Size MmapStore::Flush() {
+  std::vector<std::pair<uint8_t *, off_t>> iRangeVec;
+  {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    for (const auto &pSegment : _iSegmentVec)
+      if (pSegment && pSegment->nFileSize > 0)
+        iRangeVec.push_back({pSegment->pBase, pSegment->nFileSize});
+  }
+  Size nDirty = _nDirty.exchange(0);
+  for (const auto &iRange : iRangeVec)
+    if (msync(iRange.first, iRange.second, MS_SYNC) != 0) throw OsException();
+  return nDirty;
+}
+
+Size MmapStore::GetDirtySize() const { return _nDirty; }
+
+Size MmapStore::Prefetch(const std::vector<PageID> &iPageVec) {
+  std::lock_guard<std::mutex> iGuard(_iMutex);
+  Size nPages = 0;
+  uint8_t *pBegin = nullptr, *pEnd = nullptr;
+  for (const auto &nPageID : iPageVec) {
+    Segment *pSegment = GetSegment(DataFile::GetSegment(nPageID));
+    off_t nOffset = DataFile::GetOffset(nPageID);
+    // 文件末尾之后的页面还没有内容
+    if (nOffset + PAGE_SIZE > pSegment->nFileSize) continue;
+    uint8_t *pData = pSegment->pBase + nOffset;
+    if (pData != pEnd) {
+      if (pBegin) madvise(pBegin, pEnd - pBegin, MADV_WILLNEED);
+      pBegin = pData;
+    }
+    pEnd = pData + PAGE_SIZE;
+    ++nPages;
+  }
+  if (pBegin) madvise(pBegin, pEnd - pBegin, MADV_WILLNEED);
+  return nPages;
+}
+
+MmapStore::Segment *MmapStore::GetSegment(Size nSegment) {
+  if (_iSegmentVec[nSegment]) return _iSegmentVec[nSegment];
+  int fd = _pFile->GetFD(nSegment);
+  struct stat iStat;
+  if (fstat(fd, &iStat) != 0) throw OsException();
+  // 只保留虚拟地址空间，不占用物理内存和交换空间
+  void *pBase = mmap(nullptr, SEGMENT_BYTES, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_NORESERVE, fd, 0);
+  if (pBase == MAP_FAILED) throw OsException();
+  Segment *pSegment = new Segment();
+  pSegment->pBase = (uint8_t *)pBase;
+  pSegment->nFileSize = iStat.st_size;
+  pSegment->nUsedSize = iStat.st_size;
+  _iSegmentVec[nSegment] = pSegment;
+  return pSegment;
+}
+
+void MmapStore::Grow(Segment *pSegment, PageID nPageID) {
+  PageID nPages =
+      (nPageID % SEGMENT_PAGES / MMAP_GROW_PAGES + 1) * MMAP_GROW_PAGES;
+  if (nPages > SEGMENT_PAGES) nPages = SEGMENT_PAGES;
+  off_t nFileSize = (off_t)nPages * PAGE_SIZE;
+  if (ftruncate(_pFile->GetFD(DataFile::GetSegment(nPageID)), nFileSize) != 0)
+    throw PageIOException(nPageID);
+  pSegment->nFileSize = nFileSize;
+}
+
+}  // namespace thdb
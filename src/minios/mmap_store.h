@@ -0,0 +1,71 @@
+#ifndef THDB_MMAP_STORE_H_
+#define THDB_MMAP_STORE_H_
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "defines.h"
+#include "minios/data_file.h"
+#include "minios/page_store.h"
+
+namespace thdb {
+
+/**
+ * @brief 基于 mmap 的页面访问方式。
+ * 每个段文件在第一次访问时建立一个覆盖整段的共享映射，页面在第一次访问时由内核按需换入，
+ * 因此启动耗时与数据库大小无关。修改直接作用在映射上，Flush 时 msync 落盘。
+ */
+class MmapStore : public PageStore {
+ public:
+  /**
+   * @brief 构建 mmap 访问方式
+   *
+   * @param pFile 数据文件，由调用者负责释放
+   */
+  MmapStore(DataFile *pFile);
+  ~MmapStore();
+
+  uint8_t *Pin(PageID nPageID, bool bNew = false) override;
+  void Unpin(PageID nPageID, bool bDirty) override;
+  void Drop(PageID nPageID) override;
+  /**
+   * @brief msync 所有段，返回值为上次 Flush 之后修改页面的次数
+   */
+  Size Flush() override;
+  Size GetDirtySize() const override;
+  /**
+   * @brief 对连续的页面合并调用 madvise(MADV_WILLNEED)，由内核异步读入
+   */
+  Size Prefetch(const std::vector<PageID> &iPageVec) override;
+
+ private:
+  struct Segment {
+    uint8_t *pBase;
+    off_t nFileSize;
+    /**
+     * @brief 实际访问过的文件长度，关闭时截掉预扩展但未使用的部分
+     */
+    off_t nUsedSize;
+  };
+
+  Segment *GetSegment(Size nSegment);
+  /**
+   * @brief 扩展段文件使其覆盖 nPageID，访问文件末尾之后的映射会触发 SIGBUS
+   */
+  void Grow(Segment *pSegment, PageID nPageID);
+
+  DataFile *_pFile;
+  std::vector<Segment *> _iSegmentVec;
+  /**
+   * @brief 脏页面由内核跟踪，这里只统计修改次数作为检查点的触发条件
+   */
+  std::atomic<Size> _nDirty;
+  std::mutex _iMutex;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_MMAP_STORE_H_
@@ -1,11 +1,20 @@
 #include "minios/os.h"
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <cstring>
 #include <fstream>
 
 #include "exception/exceptions.h"
 #include "macros.h"
-#include "minios/raw_page.h"
+#include "minios/buffer_pool.h"
+#include "minios/compressed_file.h"
+#include "minios/mmap_store.h"
 #include "settings.h"
 
 namespace thdb {
@@ -26,108 +35,315 @@ void MiniOS::WriteBack() {
   }
 }
 
-// 构造函数中读取，析构函数写出的方式来进行持久化操作
+// 输出一次批量读写的页面数、数据量与吞吐量
+static void ReportIO(const char *sAction, Size nPages,
+                     std::chrono::steady_clock::time_point iBegin) {
+  double fSeconds = std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - iBegin)
+                        .count();
+  double fMB = (double)nPages * PAGE_SIZE / (1 << 20);
+  fprintf(stderr, "[minios] %s %lu pages, %.1f MB in %.3f s (%.1f MB/s)\n",
+          sAction, (unsigned long)nPages, fMB, fSeconds,
+          fSeconds > 0 ? fMB / fSeconds : 0.0);
+}
+
+// 构造函数中只加载位图并打开数据文件，页面由缓冲池按需换入
 MiniOS::MiniOS() {
-  _pMemory = new RawPage *[MEM_PAGES]; // 指针的数组，每个指针指向一个 RawPage
-  _pUsed = new Bitmap(MEM_PAGES);
-  memset(_pMemory, 0, MEM_PAGES);
-  _nClock = 0;
+  _pUsed = new PageAllocator(DB_PAGES, SEGMENT_PAGES);
+  _pStore = nullptr;
+  _pFile = nullptr;
+  _bStop = false;
+  _pPrefetching = nullptr;
+  _bPrefetchStop = false;
+  _bPrefetchCancel = false;
+  _bStats = getenv("THDB_IO_STATS") != nullptr;
   LoadBitmap();
   LoadPages();
+  StartCheckpointer();
 }
 
 MiniOS::~MiniOS() {
-  StoreBitmap();
-  StorePages();
-  for (size_t i = 0; i < MEM_PAGES; ++i)
-    if (_pMemory[i]) delete _pMemory[i]; // 将已分配的页面空间释放（MiniOS对真实的OS释放）
-  delete[] _pMemory;
+  StopPrefetcher();
+  StopCheckpointer();
+  Checkpoint();
+  if (_bStats && !_pFile->GetStats().empty())
+    fprintf(stderr, "[minios] %s\n", _pFile->GetStats().c_str());
+  delete _pStore;
+  delete _pFile;
   delete _pUsed;
 }
 
 // 分配一个新的页面，返回页面编号
-PageID MiniOS::NewPage() {
-  Size tmp = _nClock;
-  // 从 _nClock 开始循环一圈，寻找第一个可以被分配的页面
-  do {
-    if (!_pUsed->Get(_nClock)) {
-      _pMemory[_nClock] = new RawPage();
-      _pUsed->Set(_nClock);
-      return _nClock;
-    } else {
-      _nClock += 1;
-      _nClock %= MEM_PAGES;
-    }
-  } while (_nClock != tmp);
-  throw NewPageException();
+PageID MiniOS::NewPage(PageID nHintID) {
+  std::lock_guard<std::mutex> iGuard(_iUsedMutex);
+  PageID nPageID = _pUsed->Allocate(nHintID);
+  if (nPageID == NULL_PAGE) throw NewPageException();
+  _pStore->Pin(nPageID, true);
+  _pStore->Unpin(nPageID, true);
+  return nPageID;
 }
 
 // 删除指定编号的页面, 不存在写回
 void MiniOS::DeletePage(PageID pid) {
+  std::lock_guard<std::mutex> iGuard(_iUsedMutex);
   if (!_pUsed->Get(pid)) throw PageNotInitException(pid);
-  delete _pMemory[pid];
-  _pMemory[pid] = 0; // set null
+  _pStore->Drop(pid);
   _pUsed->Unset(pid);
 }
 
 void MiniOS::ReadPage(PageID pid, uint8_t *dst, PageOffset nSize,
                       PageOffset nOffset) {
-  if (!_pUsed->Get(pid)) throw PageNotInitException(pid);
-  _pMemory[pid]->Read(dst, nSize, nOffset);
+  if ((nSize + nOffset) > PAGE_SIZE) throw PageOutOfSizeException();
+  memcpy(dst, PinPage(pid) + nOffset, nSize);
+  UnpinPage(pid, false);
 }
 
 void MiniOS::WritePage(PageID pid, const uint8_t *src, PageOffset nSize,
                        PageOffset nOffset) {
+  if ((nSize + nOffset) > PAGE_SIZE) throw PageOutOfSizeException();
+  memcpy(PinPage(pid) + nOffset, src, nSize);
+  UnpinPage(pid, true);
+}
+
+uint8_t *MiniOS::PinPage(PageID pid) {
   if (!_pUsed->Get(pid)) throw PageNotInitException(pid);
-  _pMemory[pid]->Write(src, nSize, nOffset);
+  return _pStore->Pin(pid);
 }
 
-void MiniOS::LoadBitmap() {
-  // bitmap序列化到磁盘文件，便于加载OS
-  std::ifstream fin("THDB_BITMAP", std::ios::binary);
-  if (!fin) return;
-  uint8_t pTemp[MEM_PAGES / 8];
-  fin.read((char *)pTemp, MEM_PAGES / 8);
-  fin.close();
-  _pUsed->Load(pTemp);
+void MiniOS::UnpinPage(PageID pid, bool bDirty) {
+  _pStore->Unpin(pid, bDirty);
+  // 脏页面数量达到阈值时提前唤醒检查点线程
+  if (bDirty && _nDirtyLimit > 0 && _pStore->GetDirtySize() >= _nDirtyLimit)
+    _iCond.notify_one();
 }
 
-void MiniOS::LoadPages() {
-  // 将Page从真实的磁盘中加载出来（之后利用内存模拟磁盘，只有析构的时候重新写入磁盘）
-  std::ifstream fin("THDB_PAGE", std::ios::binary);
-  if (!fin) return;
-  uint8_t pTemp[PAGE_SIZE];
-  for (uint32_t i = 0; i < MEM_PAGES; ++i) {
-    if (_pUsed->Get(i)) {
-      fin.read((char *)pTemp, PAGE_SIZE);
-      _pMemory[i] = new RawPage();
-      _pMemory[i]->Write(pTemp, PAGE_SIZE);
+Size MiniOS::PrefetchPages(const std::vector<PageID> &iPageVec) {
+  std::vector<PageID> iUsedVec;
+  for (const auto &pid : iPageVec)
+    if (_pUsed->Get(pid)) iUsedVec.push_back(pid);
+  if (iUsedVec.empty()) return 0;
+  return _pStore->Prefetch(iUsedVec);
+}
+
+// 预读线程在第一次提交任务时启动，直到 MiniOS 销毁
+void MiniOS::SubmitPrefetch(PrefetchTask *pTask) {
+  {
+    std::lock_guard<std::mutex> iGuard(_iPrefetchMutex);
+    if (!_iPrefetcher.joinable())
+      _iPrefetcher = std::thread(&MiniOS::PrefetchLoop, this);
+    _iPrefetchQueue.push_back(pTask);
+  }
+  _iPrefetchCond.notify_all();
+}
+
+void MiniOS::CancelPrefetch(PrefetchTask *pTask) {
+  std::unique_lock<std::mutex> iLock(_iPrefetchMutex);
+  _iPrefetchQueue.erase(
+      std::remove(_iPrefetchQueue.begin(), _iPrefetchQueue.end(), pTask),
+      _iPrefetchQueue.end());
+  if (_pPrefetching != pTask) return;
+  // 正在执行的任务结束后不再放回队列
+  _bPrefetchCancel = true;
+  _iPrefetchCond.wait(iLock, [&]() { return _pPrefetching != pTask; });
+}
+
+void MiniOS::StopPrefetcher() {
+  if (!_iPrefetcher.joinable()) return;
+  {
+    std::lock_guard<std::mutex> iGuard(_iPrefetchMutex);
+    _bPrefetchStop = true;
+  }
+  _iPrefetchCond.notify_all();
+  _iPrefetcher.join();
+}
+
+void MiniOS::PrefetchLoop() {
+  std::unique_lock<std::mutex> iLock(_iPrefetchMutex);
+  while (true) {
+    _iPrefetchCond.wait(
+        iLock, [&]() { return _bPrefetchStop || !_iPrefetchQueue.empty(); });
+    if (_bPrefetchStop) return;
+    PrefetchTask *pTask = _iPrefetchQueue.front();
+    _iPrefetchQueue.pop_front();
+    _pPrefetching = pTask;
+    iLock.unlock();
+    bool bMore = false;
+    try {
+      bMore = pTask->Step();
+    } catch (const std::exception &e) {
+      // 预读只是优化，出错的任务不再执行
     }
+    iLock.lock();
+    // 每个任务执行一批后排到队尾，多个扫描轮流预读
+    if (bMore && !_bPrefetchCancel) _iPrefetchQueue.push_back(pTask);
+    _bPrefetchCancel = false;
+    _pPrefetching = nullptr;
+    _iPrefetchCond.notify_all();
   }
-  fin.close();
 }
 
-void MiniOS::StoreBitmap() {
-  std::ofstream fout("THDB_BITMAP", std::ios::binary);
-  if (!fout) return;
-  uint8_t pTemp[MEM_PAGES / 8];
-  _pUsed->Store(pTemp);
-  fout.write((char *)pTemp, MEM_PAGES / 8);
-  fout.close();
+// 先取位图快照，再写回页面，最后写位图。快照中标记为已使用的页面都在写回开始之前分配，
+// 位图中标记为已使用的页面在数据文件中总是有效的；写回期间新分配的页面留给下一次检查点
+// 表和索引的目录页面在每次修改后立即更新，随其他脏页面一起写回
+void MiniOS::Checkpoint() {
+  std::lock_guard<std::mutex> iGuard(_iCheckpointMutex);
+  BitmapSnapshot iSnapshot = SnapshotBitmap();
+  StorePages();
+  _pFile->Sync();
+  StoreBitmap(iSnapshot);
 }
 
-// 将内存中的页面写入磁盘
-void MiniOS::StorePages() {
-  std::ofstream fout("THDB_PAGE", std::ios::binary);
-  if (!fout) return;
-  uint8_t pTemp[PAGE_SIZE];
-  for (uint32_t i = 0; i < MEM_PAGES; ++i) {
-    if (_pUsed->Get(i)) {
-      _pMemory[i]->Read(pTemp, PAGE_SIZE);
-      fout.write((char *)pTemp, PAGE_SIZE);
+void MiniOS::StartCheckpointer() {
+  _nIntervalMs = CHECKPOINT_INTERVAL_MS;
+  _nDirtyLimit = CHECKPOINT_DIRTY_PAGES;
+  const char *sInterval = getenv("THDB_CHECKPOINT_MS");
+  if (sInterval != nullptr) _nIntervalMs = atoi(sInterval);
+  // 间隔为0时不启动后台线程，只在退出时持久化
+  if (_nIntervalMs == 0) {
+    _nDirtyLimit = 0;
+    return;
+  }
+  _iCheckpointer = std::thread(&MiniOS::CheckpointLoop, this);
+}
+
+void MiniOS::StopCheckpointer() {
+  if (!_iCheckpointer.joinable()) return;
+  {
+    std::lock_guard<std::mutex> iGuard(_iCondMutex);
+    _bStop = true;
+  }
+  _iCond.notify_one();
+  _iCheckpointer.join();
+}
+
+void MiniOS::CheckpointLoop() {
+  std::unique_lock<std::mutex> iLock(_iCondMutex);
+  while (!_bStop) {
+    _iCond.wait_for(iLock, std::chrono::milliseconds(_nIntervalMs));
+    if (_bStop) break;
+    if (_pStore->GetDirtySize() == 0) continue;
+    iLock.unlock();
+    try {
+      Checkpoint();
+    } catch (const std::exception &e) {
+      // 写回失败的页面仍然是脏的，下一次检查点重试
     }
+    iLock.lock();
   }
-  fout.close();
+}
+
+void MiniOS::LoadBitmap() {
+  // 每段的位图序列化到一个磁盘文件，便于加载OS，不存在的段视为完全空闲
+  std::vector<uint8_t> iTemp(_pUsed->GetSegmentBytes());
+  for (Size i = 0; i < _pUsed->GetSegmentSize(); ++i) {
+    std::ifstream fin(SegmentName("THDB_BITMAP", i), std::ios::binary);
+    if (!fin) continue;
+    fin.read((char *)iTemp.data(), iTemp.size());
+    fin.close();
+    _pUsed->Load(i, iTemp.data());
+  }
+}
+
+void MiniOS::LoadPages() {
+  // 页面 pid 固定存放在第 pid / SEGMENT_PAGES 个段文件中，按需读取
+  // 数据文件的压缩方式由 thdb_init 写入 THDB_CODEC，不存在时不压缩
+  String sCodec = "none";
+  std::ifstream fin("THDB_CODEC");
+  if (fin) fin >> sCodec;
+  PageCodec *pCodec = NewPageCodec(sCodec);
+  // 设置环境变量 THDB_MMAP=1 时直接映射段文件，否则使用缓冲池
+  // 压缩的数据文件中页面位置不固定，只能使用缓冲池
+  const char *sMmap = getenv("THDB_MMAP");
+  bool bMmap = !pCodec && sMmap != nullptr && atoi(sMmap) != 0;
+  if (pCodec) {
+    _pFile = new CompressedFile(pCodec);
+  } else {
+    // O_DIRECT 只用于缓冲池，映射文件时总是经过页缓存
+    const char *sDirect = getenv("THDB_DIRECT_IO");
+    _pFile = new DataFile(!bMmap && sDirect != nullptr && atoi(sDirect) != 0);
+    struct stat iStat;
+    if (fstat(_pFile->GetFD(0), &iStat) == 0) RelayoutPages(iStat.st_size);
+  }
+  if (bMmap) {
+    _pStore = new MmapStore(_pFile);
+    return;
+  }
+  Size nFrames = BUFFER_FRAMES;
+  const char *sFrames = getenv("THDB_BUFFER_FRAMES");
+  if (sFrames != nullptr && atoi(sFrames) > 0) nFrames = atoi(sFrames);
+  _pStore = new BufferPool(_pFile, nFrames);
+  const char *sPrewarm = getenv("THDB_PREWARM");
+  if (sPrewarm != nullptr && atoi(sPrewarm) != 0) PrewarmPages();
+}
+
+// 按编号顺序收集已使用的页面直到填满缓冲池，由缓冲池合并为大块并行读入
+void MiniOS::PrewarmPages() {
+  auto iBegin = std::chrono::steady_clock::now();
+  BufferPool *pPool = static_cast<BufferPool *>(_pStore);
+  std::vector<PageID> iPageVec;
+  for (PageID nPageID = _pUsed->NextUsed(0);
+       nPageID != NULL_PAGE && iPageVec.size() < pPool->GetFrameSize();
+       nPageID = _pUsed->NextUsed(nPageID + 1))
+    iPageVec.push_back(nPageID);
+  Size nPages = pPool->Load(iPageVec);
+  if (_bStats) ReportIO("prewarm", nPages, iBegin);
+}
+
+// 旧版本的数据文件只按编号顺序紧凑存放已使用的页面，需要原地展开到各自的位置
+// 旧版本最多只有 MEM_PAGES 个页面，全部位于第0段
+void MiniOS::RelayoutPages(Size nFileSize) {
+  Size nUsed = _pUsed->GetUsed();
+  if (nUsed == 0 || nFileSize != nUsed * PAGE_SIZE) return;
+  for (Size i = 1; i < _pUsed->GetSegmentSize(); ++i)
+    if (_pUsed->HasSegment(i)) return;
+  int fd = _pFile->GetFD(0);
+  PageID nLast = MEM_PAGES - 1;
+  while (!_pUsed->Get(nLast)) --nLast;
+  // 使用的页面恰好是 [0, nUsed) 时两种布局相同
+  if (nLast + 1 == nUsed) return;
+  // 从后往前搬运，目标位置总是不小于源位置，不会覆盖尚未搬运的页面
+  alignas(PAGE_SIZE) uint8_t pTemp[PAGE_SIZE];
+  Size nRank = nUsed;
+  for (PageID i = nLast + 1; i > 0; --i) {
+    if (!_pUsed->Get(i - 1)) continue;
+    --nRank;
+    if (pread(fd, pTemp, PAGE_SIZE, (off_t)nRank * PAGE_SIZE) != PAGE_SIZE ||
+        pwrite(fd, pTemp, PAGE_SIZE, (off_t)(i - 1) * PAGE_SIZE) != PAGE_SIZE)
+      throw PageIOException(i - 1);
+  }
+}
+
+// 只复制修改过的段，复制后段被标记为干净，之后的修改由下一次检查点保存
+MiniOS::BitmapSnapshot MiniOS::SnapshotBitmap() {
+  BitmapSnapshot iSnapshot;
+  std::lock_guard<std::mutex> iGuard(_iUsedMutex);
+  for (Size i = 0; i < _pUsed->GetSegmentSize(); ++i) {
+    if (!_pUsed->IsSegmentDirty(i)) continue;
+    iSnapshot.emplace_back(i, std::vector<uint8_t>(_pUsed->GetSegmentBytes()));
+    _pUsed->Store(i, iSnapshot.back().second.data());
+  }
+  return iSnapshot;
+}
+
+// 先写入临时文件再重命名，检查点过程中崩溃不会损坏旧的位图
+void MiniOS::StoreBitmap(const BitmapSnapshot &iSnapshot) {
+  for (const auto &iPair : iSnapshot) {
+    String sName = SegmentName("THDB_BITMAP", iPair.first);
+    std::ofstream fout(sName + ".tmp", std::ios::binary);
+    if (!fout) return;
+    fout.write((const char *)iPair.second.data(), iPair.second.size());
+    fout.close();
+    if (!fout) return;
+    rename((sName + ".tmp").c_str(), sName.c_str());
+  }
+}
+
+// 将修改过的页面写入磁盘
+void MiniOS::StorePages() {
+  if (!_pStore) return;
+  auto iBegin = std::chrono::steady_clock::now();
+  Size nPages = _pStore->Flush();
+  if (_bStats && nPages > 0) ReportIO("flush", nPages, iBegin);
 }
 
 Size MiniOS::GetUsedSize() const {
@@ -1,26 +1,86 @@
 #ifndef THDB_OS_H_
 #define THDB_OS_H_
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include "defines.h"
-#include "minios/raw_page.h"
-#include "utils/bitmap.h"
+#include "macros.h"
+#include "minios/data_file.h"
+#include "minios/page_allocator.h"
+#include "minios/page_store.h"
 
 namespace thdb {
 
 class Page;
-class Bitmap;
+
+/**
+ * @brief 由 MiniOS 的后台预读线程执行的任务
+ */
+class PrefetchTask {
+ public:
+  virtual ~PrefetchTask() {}
+  /**
+   * @brief 预读一批页面，在预读线程中执行
+   *
+   * @return bool 是否需要排到队尾继续执行，为 false 时任务离开队列
+   */
+  virtual bool Step() = 0;
+};
 
 class MiniOS {
  public:
   static MiniOS *GetOS();
   static void WriteBack();
 
-  PageID NewPage();
+  /**
+   * @brief 分配一个新的页面
+   *
+   * @param nHintID 希望靠近的页面编号，通常为链表中的前一个页面
+   * @return PageID 页面编号
+   */
+  PageID NewPage(PageID nHintID = NULL_PAGE);
   void DeletePage(PageID pid);
   void ReadPage(PageID pid, uint8_t *dst, PageOffset nSize,
                 PageOffset nOffset = 0);
   void WritePage(PageID pid, const uint8_t *src, PageOffset nSize,
                  PageOffset nOffset = 0);
+  /**
+   * @brief 固定页面，返回页面内容的起始地址
+   * 每次 PinPage 都需要对应一次 UnpinPage，固定期间地址保持有效
+   */
+  uint8_t *PinPage(PageID pid);
+  /**
+   * @brief 解除页面的一次固定
+   *
+   * @param bDirty 固定期间是否修改了页面内容
+   */
+  void UnpinPage(PageID pid, bool bDirty);
+  /**
+   * @brief 提示即将访问这些页面，由缓冲池或内核提前换入，未使用的页面被忽略
+   *
+   * @return Size 实际提前换入的页面数量
+   */
+  Size PrefetchPages(const std::vector<PageID> &iPageVec);
+  /**
+   * @brief 把任务交给后台预读线程，队列中的任务轮流执行 Step。
+   * 同一任务离开队列之前不能重复提交
+   */
+  void SubmitPrefetch(PrefetchTask *pTask);
+  /**
+   * @brief 从队列中移除任务，并等待正在执行的 Step 结束，之后可以释放任务
+   */
+  void CancelPrefetch(PrefetchTask *pTask);
+  /**
+   * @brief 将所有修改过的页面和位图持久化，mmap 模式下为一次 msync。
+   * 位图在写回页面之前取快照，正被固定的页面留到下一次检查点写回。
+   * 后台检查点线程定期或在脏页面过多时调用，也可以手动调用。
+   */
+  void Checkpoint();
   Size GetUsedSize() const;
   bool Used(PageID pid) const;
 
@@ -30,13 +90,46 @@ class MiniOS {
 
   void LoadBitmap();
   void LoadPages();
+  void PrewarmPages();
+  void RelayoutPages(Size nFileSize);
 
-  void StoreBitmap();
+  typedef std::vector<std::pair<Size, std::vector<uint8_t>>> BitmapSnapshot;
+  BitmapSnapshot SnapshotBitmap();
+  void StoreBitmap(const BitmapSnapshot &iSnapshot);
   void StorePages();
 
-  RawPage **_pMemory;
-  Bitmap *_pUsed;
-  Size _nClock;
+  void StartCheckpointer();
+  void StopCheckpointer();
+  void CheckpointLoop();
+  void StopPrefetcher();
+  void PrefetchLoop();
+
+  PageStore *_pStore;
+  PageAllocator *_pUsed;
+  DataFile *_pFile;
+
+  // 保护位图，使检查点线程可以与页面分配并发执行
+  std::mutex _iUsedMutex;
+  // 同一时刻只进行一次检查点
+  std::mutex _iCheckpointMutex;
+  std::thread _iCheckpointer;
+  std::mutex _iCondMutex;
+  std::condition_variable _iCond;
+  bool _bStop;
+  bool _bStats;
+  Size _nIntervalMs;
+  Size _nDirtyLimit;
+
+  // 所有扫描共用一个预读线程，避免每次扫描创建线程
+  std::thread _iPrefetcher;
+  std::mutex _iPrefetchMutex;
+  std::condition_variable _iPrefetchCond;
+  std::deque<PrefetchTask *> _iPrefetchQueue;
+  // 正在执行 Step 的任务
+  PrefetchTask *_pPrefetching;
+  // 正在执行的任务已被取消
+  bool _bPrefetchCancel;
+  bool _bPrefetchStop;
 
   static MiniOS *os;
 };
@@ -0,0 +1,211 @@
+#include "minios/page_allocator.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace thdb {
+
+const uint64_t FULL_WORD = ~(uint64_t)0;
+
+PageAllocator::PageAllocator(PageID nPages, PageID nSegmentPages)
+    : _nPages(nPages),
+      _nSegmentPages(nSegmentPages),
+      _nSegmentWords(nSegmentPages / EXTENT_PAGES),
+      _nWords(nPages / EXTENT_PAGES),
+      _nUsed(0),
+      _iSegmentVec(nPages / nSegmentPages, nullptr),
+      _nCursor(0) {
+  assert(nSegmentPages % (EXTENT_PAGES * 64) == 0);
+  assert(nPages % nSegmentPages == 0);
+}
+
+PageAllocator::~PageAllocator() {
+  for (const auto &pSegment : _iSegmentVec) delete pSegment;
+}
+
+PageID PageAllocator::Allocate(PageID nHintID) {
+  if (nHintID != NULL_PAGE && nHintID < _nPages) {
+    // 1. 提示页面所在区段中，提示之后的空闲页面
+    Size nWord = nHintID / EXTENT_PAGES;
+    PageID nPageID = AllocateInWord(nWord, nHintID % EXTENT_PAGES);
+    if (nPageID != NULL_PAGE) {
+      Reserve(nWord);
+      return nPageID;
+    }
+    // 2. 提示之后的第一个完全空闲区段，保留给调用者
+    nWord = NextWord(nWord + 1, MaskType::EMPTY, false);
+    if (nWord == _nWords) nWord = NextWord(0, MaskType::EMPTY, false);
+    if (nWord != _nWords) {
+      Reserve(nWord);
+      return AllocateInWord(nWord, 0);
+    }
+  }
+  // 3. 无提示时从游标开始寻找未被保留的空闲页面，没有时再使用已保留的区段
+  Size nWord = NextWord(_nCursor, MaskType::FREE, true);
+  if (nWord == _nWords) nWord = NextWord(0, MaskType::FREE, true);
+  if (nWord == _nWords) nWord = NextWord(0, MaskType::FREE, false);
+  if (nWord == _nWords) return NULL_PAGE;
+  _nCursor = nWord;
+  return AllocateInWord(nWord, 0);
+}
+
+void PageAllocator::Set(PageID nPageID) {
+  Segment *pSegment = GetSegment(nPageID / _nSegmentPages);
+  Size nLocal = nPageID % _nSegmentPages / EXTENT_PAGES;
+  uint64_t nBit = (uint64_t)1 << (nPageID % EXTENT_PAGES);
+  if (pSegment->iWordVec[nLocal] & nBit) return;
+  pSegment->iWordVec[nLocal] |= nBit;
+  ++pSegment->nUsed;
+  ++_nUsed;
+  UpdateSummary(pSegment, nLocal);
+}
+
+void PageAllocator::Unset(PageID nPageID) {
+  Segment *pSegment = _iSegmentVec[nPageID / _nSegmentPages];
+  if (!pSegment) return;
+  Size nLocal = nPageID % _nSegmentPages / EXTENT_PAGES;
+  uint64_t nBit = (uint64_t)1 << (nPageID % EXTENT_PAGES);
+  if (!(pSegment->iWordVec[nLocal] & nBit)) return;
+  pSegment->iWordVec[nLocal] &= ~nBit;
+  --pSegment->nUsed;
+  --_nUsed;
+  UpdateSummary(pSegment, nLocal);
+}
+
+bool PageAllocator::Get(PageID nPageID) const {
+  if (nPageID >= _nPages) return false;
+  const Segment *pSegment = _iSegmentVec[nPageID / _nSegmentPages];
+  if (!pSegment) return false;
+  return pSegment->iWordVec[nPageID % _nSegmentPages / EXTENT_PAGES] >>
+             (nPageID % EXTENT_PAGES) &
+         1;
+}
+
+Size PageAllocator::GetSize() const { return _nPages; }
+
+Size PageAllocator::GetUsed() const { return _nUsed; }
+
+Size PageAllocator::GetSegmentSize() const { return _iSegmentVec.size(); }
+
+PageID PageAllocator::NextUsed(PageID nFrom) const {
+  while (nFrom < _nPages) {
+    const Segment *pSegment = _iSegmentVec[nFrom / _nSegmentPages];
+    if (!pSegment) {
+      nFrom = (nFrom / _nSegmentPages + 1) * _nSegmentPages;
+      continue;
+    }
+    // 屏蔽掉当前字中 nFrom 之前的位
+    uint64_t nWord = pSegment->iWordVec[nFrom % _nSegmentPages / EXTENT_PAGES] &
+                     (~0ULL << (nFrom % EXTENT_PAGES));
+    if (nWord)
+      return nFrom / EXTENT_PAGES * EXTENT_PAGES + __builtin_ctzll(nWord);
+    nFrom = (nFrom / EXTENT_PAGES + 1) * EXTENT_PAGES;
+  }
+  return NULL_PAGE;
+}
+
+bool PageAllocator::HasSegment(Size nSegment) const {
+  return _iSegmentVec[nSegment] != nullptr;
+}
+
+bool PageAllocator::IsSegmentDirty(Size nSegment) const {
+  return _iSegmentVec[nSegment] && _iSegmentVec[nSegment]->bDirty;
+}
+
+Size PageAllocator::GetSegmentBytes() const { return _nSegmentPages / 8; }
+
+// 小端序下64位字数组与 Bitmap 的字节数组布局一致
+void PageAllocator::Load(Size nSegment, const uint8_t *pBits) {
+  Segment *pSegment = GetSegment(nSegment);
+  memcpy(pSegment->iWordVec.data(), pBits, GetSegmentBytes());
+  _nUsed -= pSegment->nUsed;
+  pSegment->nUsed = 0;
+  for (Size i = 0; i < _nSegmentWords; ++i) {
+    pSegment->nUsed += __builtin_popcountll(pSegment->iWordVec[i]);
+    UpdateSummary(pSegment, i);
+  }
+  for (auto &nMask : pSegment->iReservedMask) nMask = 0;
+  _nUsed += pSegment->nUsed;
+  pSegment->bDirty = false;
+}
+
+void PageAllocator::Store(Size nSegment, uint8_t *pBits) {
+  Segment *pSegment = _iSegmentVec[nSegment];
+  if (!pSegment) {
+    memset(pBits, 0, GetSegmentBytes());
+    return;
+  }
+  memcpy(pBits, pSegment->iWordVec.data(), GetSegmentBytes());
+  pSegment->bDirty = false;
+}
+
+PageAllocator::Segment *PageAllocator::GetSegment(Size nSegment) {
+  if (_iSegmentVec[nSegment]) return _iSegmentVec[nSegment];
+  Segment *pSegment = new Segment();
+  Size nMasks = _nSegmentWords / 64;
+  pSegment->iWordVec.assign(_nSegmentWords, 0);
+  pSegment->iFreeMask.assign(nMasks, FULL_WORD);
+  pSegment->iEmptyMask.assign(nMasks, FULL_WORD);
+  pSegment->iReservedMask.assign(nMasks, 0);
+  pSegment->nUsed = 0;
+  pSegment->bDirty = true;
+  _iSegmentVec[nSegment] = pSegment;
+  return pSegment;
+}
+
+Size PageAllocator::NextWord(Size nFrom, MaskType iType,
+                             bool bSkipReserved) const {
+  while (nFrom < _nWords) {
+    const Segment *pSegment = _iSegmentVec[nFrom / _nSegmentWords];
+    // 未使用过的段中所有区段都完全空闲且未被保留
+    if (!pSegment) return nFrom;
+    const std::vector<uint64_t> &iMask =
+        (iType == MaskType::FREE) ? pSegment->iFreeMask : pSegment->iEmptyMask;
+    Size nLocal = nFrom % _nSegmentWords;
+    Size nBase = nFrom - nLocal;
+    for (Size i = nLocal / 64; i < iMask.size(); ++i) {
+      uint64_t nBits = iMask[i];
+      if (bSkipReserved) nBits &= ~pSegment->iReservedMask[i];
+      if (i == nLocal / 64) nBits &= FULL_WORD << (nLocal % 64);
+      if (nBits) return nBase + i * 64 + __builtin_ctzll(nBits);
+    }
+    nFrom = nBase + _nSegmentWords;
+  }
+  return _nWords;
+}
+
+void PageAllocator::Reserve(Size nWord) {
+  Segment *pSegment = GetSegment(nWord / _nSegmentWords);
+  Size nLocal = nWord % _nSegmentWords;
+  pSegment->iReservedMask[nLocal / 64] |= (uint64_t)1 << (nLocal % 64);
+}
+
+void PageAllocator::UpdateSummary(Segment *pSegment, Size nLocal) {
+  uint64_t nBit = (uint64_t)1 << (nLocal % 64);
+  uint64_t nWord = pSegment->iWordVec[nLocal];
+  if (nWord != FULL_WORD)
+    pSegment->iFreeMask[nLocal / 64] |= nBit;
+  else
+    pSegment->iFreeMask[nLocal / 64] &= ~nBit;
+  if (nWord == 0) {
+    pSegment->iEmptyMask[nLocal / 64] |= nBit;
+    // 区段全部释放后不再属于任何链表
+    pSegment->iReservedMask[nLocal / 64] &= ~nBit;
+  } else {
+    pSegment->iEmptyMask[nLocal / 64] &= ~nBit;
+  }
+  pSegment->bDirty = true;
+}
+
+// 在区段 nWord 中分配第 nFrom 位及之后的第一个空闲页面
+PageID PageAllocator::AllocateInWord(Size nWord, PageID nFrom) {
+  Segment *pSegment = GetSegment(nWord / _nSegmentWords);
+  uint64_t nFree =
+      ~pSegment->iWordVec[nWord % _nSegmentWords] & (FULL_WORD << nFrom);
+  if (nFree == 0) return NULL_PAGE;
+  PageID nPageID = nWord * EXTENT_PAGES + __builtin_ctzll(nFree);
+  Set(nPageID);
+  return nPageID;
+}
+
+}  // namespace thdb
@@ -0,0 +1,106 @@
+#ifndef THDB_PAGE_ALLOCATOR_H_
+#define THDB_PAGE_ALLOCATOR_H_
+
+#include <vector>
+
+#include "defines.h"
+#include "macros.h"
+
+namespace thdb {
+
+/**
+ * @brief 一个区段(extent)包含的页面数量，与位图的一个64位字对应
+ */
+const PageID EXTENT_PAGES = 64;
+
+/**
+ * @brief 以64位字为单位管理页面占用状况的分配器。
+ * 每个字对应一个区段，另外用两张摘要位图记录"有空闲页面的区段"和"完全空闲的区段"，
+ * 查找时按字跳过已满或已保留的区段，字内用 ctz 定位空闲页面。
+ * 带提示的分配优先使用提示页面所在区段，区段满后为调用者保留一个新的空闲区段，
+ * 使同一张表或同一个索引的页面在数据文件中尽量连续。
+ * 表和索引的页面随数据增长逐个分配，无法预知最终大小，因此只提供带提示的单页分配，
+ * 不一次性分配连续的多个页面：保留的区段已经使链表页面连续，又不会为小表浪费空间。
+ * 地址空间按段稀疏存储，从未使用过的段不占用内存，每段的序列化格式与 Bitmap 相同。
+ */
+class PageAllocator {
+ public:
+  /**
+   * @param nPages 地址空间包含的页面数量
+   * @param nSegmentPages 每段的页面数量，需要整除 nPages 且为 4096 的倍数
+   */
+  PageAllocator(PageID nPages, PageID nSegmentPages);
+  ~PageAllocator();
+
+  /**
+   * @brief 分配一个页面
+   *
+   * @param nHintID 希望靠近的页面编号，NULL_PAGE 表示没有要求
+   * @return PageID 分配的页面编号，空间已满时返回 NULL_PAGE
+   */
+  PageID Allocate(PageID nHintID = NULL_PAGE);
+
+  void Set(PageID nPageID);
+  void Unset(PageID nPageID);
+  bool Get(PageID nPageID) const;
+  /**
+   * @brief 返回不小于 nFrom 的第一个已使用页面，不存在时返回 NULL_PAGE
+   */
+  PageID NextUsed(PageID nFrom) const;
+  Size GetSize() const;
+  Size GetUsed() const;
+
+  /**
+   * @brief 段的数量，以及第 nSegment 段是否被使用过
+   */
+  Size GetSegmentSize() const;
+  bool HasSegment(Size nSegment) const;
+  /**
+   * @brief 第 nSegment 段上次 Store 之后是否被修改过
+   */
+  bool IsSegmentDirty(Size nSegment) const;
+  /**
+   * @brief 单个段序列化后的字节数
+   */
+  Size GetSegmentBytes() const;
+
+  void Load(Size nSegment, const uint8_t *pBits);
+  void Store(Size nSegment, uint8_t *pBits);
+
+ private:
+  struct Segment {
+    std::vector<uint64_t> iWordVec;
+    // 摘要位图：区段中存在空闲页面
+    std::vector<uint64_t> iFreeMask;
+    // 摘要位图：区段完全空闲
+    std::vector<uint64_t> iEmptyMask;
+    // 摘要位图：区段已被某条链表保留，无提示的分配尽量避开，只在内存中维护
+    std::vector<uint64_t> iReservedMask;
+    Size nUsed;
+    bool bDirty;
+  };
+
+  enum class MaskType { FREE, EMPTY };
+
+  Segment *GetSegment(Size nSegment);
+  /**
+   * @brief 查找从全局区段编号 nFrom 开始第一个满足条件的区段，未使用过的段视为完全空闲
+   * @return Size 区段编号，不存在时返回区段总数
+   */
+  Size NextWord(Size nFrom, MaskType iType, bool bSkipReserved) const;
+  void Reserve(Size nWord);
+  void UpdateSummary(Segment *pSegment, Size nLocal);
+  PageID AllocateInWord(Size nWord, PageID nFrom);
+
+  PageID _nPages;
+  PageID _nSegmentPages;
+  Size _nSegmentWords;
+  Size _nWords;
+  Size _nUsed;
+  std::vector<Segment *> _iSegmentVec;
+  Size _nCursor;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_PAGE_ALLOCATOR_H_
@@ -0,0 +1,164 @@
+#include "minios/page_codec.h"
+
+#include <cstring>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+
+namespace thdb {
+
+// 哈希表大小的位数以及最短匹配长度
+const Size LZ_HASH_BITS = 12;
+const Size LZ_MIN_MATCH = 4;
+
+PageOffset PageCodec::Encode(const uint8_t *pPage, uint8_t *pOut) const {
+  if (pPage[0] == 0 && memcmp(pPage, pPage + 1, PAGE_SIZE - 1) == 0) return 0;
+  PageOffset nLength = Compress(pPage, pOut);
+  if (nLength < PAGE_SIZE) return nLength;
+  memcpy(pOut, pPage, PAGE_SIZE);
+  return PAGE_SIZE;
+}
+
+void PageCodec::Decode(PageID nPageID, const uint8_t *pIn, PageOffset nLength,
+                       uint8_t *pPage) const {
+  if (nLength == 0)
+    memset(pPage, 0, PAGE_SIZE);
+  else if (nLength == PAGE_SIZE)
+    memcpy(pPage, pIn, PAGE_SIZE);
+  else
+    Decompress(nPageID, pIn, nLength, pPage);
+}
+
+String ZeroCodec::GetName() const { return "zero"; }
+
+PageOffset ZeroCodec::Compress(const uint8_t *pPage, uint8_t *pOut) const {
+  return PAGE_SIZE;
+}
+
+void ZeroCodec::Decompress(PageID nPageID, const uint8_t *pIn,
+                           PageOffset nLength, uint8_t *pPage) const {
+  throw PageIOException(nPageID);
+}
+
+static uint32_t LZHash(const uint8_t *pData) {
+  uint32_t nValue;
+  memcpy(&nValue, pData, sizeof(uint32_t));
+  return (nValue * 2654435761U) >> (32 - LZ_HASH_BITS);
+}
+
+// 写入以255为单位的扩展长度，空间不足时返回 false
+static bool PutLength(uint8_t *&pOut, const uint8_t *pEnd, Size nLength) {
+  for (; nLength >= 255; nLength -= 255) {
+    if (pOut >= pEnd) return false;
+    *pOut++ = 255;
+  }
+  if (pOut >= pEnd) return false;
+  *pOut++ = nLength;
+  return true;
+}
+
+static bool GetLength(const uint8_t *&pIn, const uint8_t *pEnd,
+                      Size &nLength) {
+  while (pIn < pEnd) {
+    uint8_t nByte = *pIn++;
+    nLength += nByte;
+    if (nByte != 255) return true;
+  }
+  return false;
+}
+
+// 写入一个序列，nMatch 为0时表示最后一个只有字面量的序列
+static bool PutSequence(uint8_t *&pOut, const uint8_t *pEnd,
+                        const uint8_t *pLiteral, Size nLiteral, Size nDistance,
+                        Size nMatch) {
+  if (pOut >= pEnd) return false;
+  uint8_t *pToken = pOut++;
+  uint8_t nToken = (nLiteral < 15 ? nLiteral : 15) << 4;
+  if (nLiteral >= 15 && !PutLength(pOut, pEnd, nLiteral - 15)) return false;
+  if ((Size)(pEnd - pOut) < nLiteral) return false;
+  memcpy(pOut, pLiteral, nLiteral);
+  pOut += nLiteral;
+  if (nMatch > 0) {
+    if (pEnd - pOut < 2) return false;
+    *pOut++ = nDistance & 0xFF;
+    *pOut++ = nDistance >> 8;
+    Size nExtra = nMatch - LZ_MIN_MATCH;
+    nToken |= nExtra < 15 ? nExtra : 15;
+    if (nExtra >= 15 && !PutLength(pOut, pEnd, nExtra - 15)) return false;
+  }
+  *pToken = nToken;
+  return true;
+}
+
+String LZCodec::GetName() const { return "lz"; }
+
+PageOffset LZCodec::Compress(const uint8_t *pPage, uint8_t *pOut) const {
+  // 哈希表保存位置加1，0表示空
+  uint16_t iTable[1 << LZ_HASH_BITS];
+  memset(iTable, 0, sizeof(iTable));
+  uint8_t *pCur = pOut;
+  const uint8_t *pEnd = pOut + PAGE_SIZE;
+  Size nAnchor = 0, nPos = 0;
+  while (nPos + LZ_MIN_MATCH <= PAGE_SIZE) {
+    uint32_t nHash = LZHash(pPage + nPos);
+    Size nCandidate = iTable[nHash];
+    iTable[nHash] = nPos + 1;
+    if (nCandidate == 0 ||
+        memcmp(pPage + nCandidate - 1, pPage + nPos, LZ_MIN_MATCH) != 0) {
+      ++nPos;
+      continue;
+    }
+    Size nRef = nCandidate - 1, nMatch = LZ_MIN_MATCH;
+    while (nPos + nMatch < PAGE_SIZE &&
+           pPage[nRef + nMatch] == pPage[nPos + nMatch])
+      ++nMatch;
+    if (!PutSequence(pCur, pEnd, pPage + nAnchor, nPos - nAnchor, nPos - nRef,
+                     nMatch))
+      return PAGE_SIZE;
+    nPos += nMatch;
+    nAnchor = nPos;
+  }
+  if (!PutSequence(pCur, pEnd, pPage + nAnchor, PAGE_SIZE - nAnchor, 0, 0))
+    return PAGE_SIZE;
+  return pCur - pOut;
+}
+
+void LZCodec::Decompress(PageID nPageID, const uint8_t *pIn,
+                         PageOffset nLength, uint8_t *pPage) const {
+  const uint8_t *pEnd = pIn + nLength;
+  Size nPos = 0;
+  while (pIn < pEnd) {
+    uint8_t nToken = *pIn++;
+    Size nLiteral = nToken >> 4;
+    if (nLiteral == 15 && !GetLength(pIn, pEnd, nLiteral))
+      throw PageIOException(nPageID);
+    if ((Size)(pEnd - pIn) < nLiteral || PAGE_SIZE - nPos < nLiteral)
+      throw PageIOException(nPageID);
+    memcpy(pPage + nPos, pIn, nLiteral);
+    pIn += nLiteral;
+    nPos += nLiteral;
+    if (pIn == pEnd) break;
+    if (pEnd - pIn < 2) throw PageIOException(nPageID);
+    Size nDistance = pIn[0] | (pIn[1] << 8);
+    pIn += 2;
+    Size nMatch = nToken & 15;
+    if (nMatch == 15 && !GetLength(pIn, pEnd, nMatch))
+      throw PageIOException(nPageID);
+    nMatch += LZ_MIN_MATCH;
+    if (nDistance == 0 || nDistance > nPos || PAGE_SIZE - nPos < nMatch)
+      throw PageIOException(nPageID);
+    // 匹配可能与输出重叠，需要逐字节复制
+    for (Size i = 0; i < nMatch; ++i, ++nPos)
+      pPage[nPos] = pPage[nPos - nDistance];
+  }
+  if (nPos != PAGE_SIZE) throw PageIOException(nPageID);
+}
+
+PageCodec *NewPageCodec(const String &sName) {
+  if (sName == "none") return nullptr;
+  if (sName == "zero") return new ZeroCodec();
+  if (sName == "lz") return new LZCodec();
+  throw PageCodecException(sName);
+}
+
+}  // namespace thdb
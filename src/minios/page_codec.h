@@ -0,0 +1,78 @@
+#ifndef THDB_PAGE_CODEC_H_
+#define THDB_PAGE_CODEC_H_
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief 页面编码器，在写入数据文件前压缩页面，读入后解压。
+ * 编码结果长度为0表示全0页面，长度为 PAGE_SIZE 表示原样存储。
+ */
+class PageCodec {
+ public:
+  virtual ~PageCodec() = default;
+
+  /**
+   * @brief 编码一个页面
+   *
+   * @param pPage 页面内容，长度为 PAGE_SIZE
+   * @param pOut 输出缓冲区，长度至少为 PAGE_SIZE
+   * @return PageOffset 编码后的长度
+   */
+  virtual PageOffset Encode(const uint8_t *pPage, uint8_t *pOut) const;
+  /**
+   * @brief 解码一个页面，输入损坏时抛出 PageIOException
+   *
+   * @param nPageID 页面编号，只用于报告错误
+   */
+  virtual void Decode(PageID nPageID, const uint8_t *pIn, PageOffset nLength,
+                      uint8_t *pPage) const;
+  virtual String GetName() const = 0;
+
+ protected:
+  /**
+   * @brief 压缩不是全0的页面，返回值不小于 PAGE_SIZE 时表示不值得压缩
+   */
+  virtual PageOffset Compress(const uint8_t *pPage, uint8_t *pOut) const = 0;
+  virtual void Decompress(PageID nPageID, const uint8_t *pIn,
+                          PageOffset nLength, uint8_t *pPage) const = 0;
+};
+
+/**
+ * @brief 只省略全0页面，其余页面原样存储
+ */
+class ZeroCodec : public PageCodec {
+ public:
+  String GetName() const override;
+
+ protected:
+  PageOffset Compress(const uint8_t *pPage, uint8_t *pOut) const override;
+  void Decompress(PageID nPageID, const uint8_t *pIn, PageOffset nLength,
+                  uint8_t *pPage) const override;
+};
+
+/**
+ * @brief 省略全0页面，并用 LZ77 压缩其余页面。
+ * 格式与 LZ4 块格式类似：每个序列由一个标记字节开始，高4位为字面量长度，
+ * 低4位为匹配长度减4，取值15时后续以255为单位扩展；随后是字面量、
+ * 2字节小端的匹配距离和匹配长度的扩展。最后一个序列只有字面量。
+ */
+class LZCodec : public PageCodec {
+ public:
+  String GetName() const override;
+
+ protected:
+  PageOffset Compress(const uint8_t *pPage, uint8_t *pOut) const override;
+  void Decompress(PageID nPageID, const uint8_t *pIn, PageOffset nLength,
+                  uint8_t *pPage) const override;
+};
+
+/**
+ * @brief 按名称创建编码器，"none" 返回 nullptr，表示数据文件不压缩
+ */
+PageCodec *NewPageCodec(const String &sName);
+
+}  // namespace thdb
+
+#endif  // THDB_PAGE_CODEC_H_
@@ -0,0 +1,58 @@
+#ifndef THDB_PAGE_STORE_H_
+#define THDB_PAGE_STORE_H_
+
+#include <vector>
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief MiniOS 访问数据文件中页面的统一接口。
+ * 页面 nPageID 固定对应数据文件的 nPageID * PAGE_SIZE 处。
+ * 实现需要保证 Flush 可以由检查点线程与其他接口并发调用。
+ */
+class PageStore {
+ public:
+  virtual ~PageStore() = default;
+
+  /**
+   * @brief 固定一个页面，返回其内容在内存中的起始地址
+   *
+   * @param nPageID 页面编号
+   * @param bNew 是否为新分配的页面，新页面内容直接清零
+   * @return uint8_t* 页面内容的起始地址，在对应的 Unpin 之前保持有效
+   */
+  virtual uint8_t *Pin(PageID nPageID, bool bNew = false) = 0;
+  /**
+   * @brief 解除一次固定
+   *
+   * @param nPageID 页面编号
+   * @param bDirty 固定期间是否修改了页面内容
+   */
+  virtual void Unpin(PageID nPageID, bool bDirty) = 0;
+  /**
+   * @brief 页面被删除时调用，丢弃其内容且不写回
+   */
+  virtual void Drop(PageID nPageID) = 0;
+  /**
+   * @brief 将所有修改过的页面持久化到数据文件
+   *
+   * @return Size 写回的页面数量
+   */
+  virtual Size Flush() = 0;
+  /**
+   * @brief 上次 Flush 之后修改过的页面数量，用于触发检查点
+   */
+  virtual Size GetDirtySize() const = 0;
+  /**
+   * @brief 提示即将按顺序访问这些页面，实现可以提前换入，默认不做任何事
+   *
+   * @return Size 实际提前换入的页面数量
+   */
+  virtual Size Prefetch(const std::vector<PageID> &iPageVec) { return 0; }
+};
+
+}  // namespace thdb
+
+#endif  // THDB_PAGE_STORE_H_
@@ -7,12 +7,7 @@
 
 namespace thdb {
 
-RawPage::RawPage() {
-  _pData = new uint8_t[PAGE_SIZE]; // PAGE_SIZE == 4096 Byte
-  memset(_pData, 0, PAGE_SIZE); // 内存中的页面，初始化全0
-}
-
-RawPage::~RawPage() { delete[] _pData; }
+RawPage::RawPage(uint8_t* pData) : _pData(pData) {}
 
 // 将page中数据读取到dst
 void RawPage::Read(uint8_t* dst, PageOffset nSize, PageOffset nOffset) {
@@ -26,4 +21,11 @@ void RawPage::Write(const uint8_t* src, PageOffset nSize, PageOffset nOffset) {
   memcpy(_pData + nOffset, src, nSize);
 }
 
+// 帧数据的起始地址，供缓冲池直接读写数据文件
+uint8_t* RawPage::GetData() { return _pData; }
+
+const uint8_t* RawPage::GetData() const { return _pData; }
+
+void RawPage::Clear() { memset(_pData, 0, PAGE_SIZE); }
+
 }  // namespace thdb
@@ -5,16 +5,23 @@
 
 namespace thdb {
 
+/**
+ * @brief 内存中的一个页面帧，内容位于 FrameArena 中，RawPage 本身不持有内存
+ */
 class RawPage {
  public:
-  RawPage();
-  ~RawPage();
+  RawPage(uint8_t* pData);
+  ~RawPage() = default;
 
   void Read(uint8_t* dst, PageOffset nSize, PageOffset nOffset = 0);
   void Write(const uint8_t* src, PageOffset nSize, PageOffset nOffset = 0);
 
+  uint8_t* GetData();
+  const uint8_t* GetData() const;
+  void Clear();
+
  private:
-  uint8_t* _pData; // 内存中的页
+  uint8_t* _pData; // 内存中的页，由 FrameArena 分配
 };
 
 }  // namespace thdb
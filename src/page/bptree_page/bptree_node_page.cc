@@ -1,7 +1,9 @@
 
 #include "bptree_node_page.h"
 #include "bptree_overflow_page.h"
+#include "page/page_guard.h"
 #include <cassert>
+#include <cstring>
 #include <vector>
 #include <algorithm>
 
@@ -14,10 +16,23 @@ const PageOffset NODE_SIZE_OFFSET = 16;
 const PageOffset NODE_NEXT_OFFSET = 20;
 const PageOffset NODE_PARENT_OFFSET = 24;
 const PageOffset NODE_DATA_OFFSET = 28;
+const Size NODE_DATA_CAP = PAGE_SIZE - NODE_DATA_OFFSET;
 
-BPTreeNode::BPTreeNode(Size nKeySize, FieldType iKeyType, NodeType iNodeType): 
-    Page(), _bModified(true), _iNodeType(iNodeType), _iKeyType(iKeyType),
-    _nKeySize(nKeySize) {
+// 两个字符串的公共前缀长度
+static Size CommonPrefix(const String &sA, const String &sB) {
+    Size n = std::min(sA.size(), sB.size());
+    Size i = 0;
+    while (i < n && sA[i] == sB[i]) ++i;
+    return i;
+}
+
+static const String &KeyString(const Field *pKey) {
+    return ((const StringField*)pKey)->GetString();
+}
+
+BPTreeNode::BPTreeNode(Size nKeySize, FieldType iKeyType, NodeType iNodeType, PageID nHintID):
+    Page(nHintID, true), _bModified(true), _iNodeType(iNodeType), _iKeyType(iKeyType),
+    _nKeySize(nKeySize), _pCmp(&GetComparator(iKeyType)) {
     if (_iNodeType == NodeType::INNER_NODE_TYPE) {
         _nCap = (PAGE_SIZE - NODE_DATA_OFFSET) / (_nKeySize + 4);
     } else {
@@ -40,14 +55,77 @@ FieldType BPTreeNode::GetKeyType() const { return _iKeyType; }
 Size BPTreeNode::GetCap() const { return _nCap; }
 Size BPTreeNode::GetSize() const { return _iKeyVec.size(); }
 bool BPTreeNode::Empty() const { return _iKeyVec.empty(); }
-bool BPTreeNode::Full() const { return _iKeyVec.size() >= _nCap; }
-bool BPTreeNode::needSplit() const { return _iKeyVec.size() > _nCap; }
-bool BPTreeNode::needMerge() const { return _iKeyVec.size() < (_nCap + 1) / 2; }
-bool BPTreeNode::canBeBorrow() const { return _iKeyVec.size() > (_nCap + 1) / 2; }
+bool BPTreeNode::Full() const {
+    if (isVariable()) return UsedBytes() >= NODE_DATA_CAP;
+    return _iKeyVec.size() >= _nCap;
+}
+bool BPTreeNode::needSplit() const {
+    if (isVariable()) return UsedBytes() > NODE_DATA_CAP;
+    return _iKeyVec.size() > _nCap;
+}
+bool BPTreeNode::needMerge() const {
+    if (isVariable()) return RawBytes() < NODE_DATA_CAP / 2;
+    return _iKeyVec.size() < (_nCap + 1) / 2;
+}
+bool BPTreeNode::canBeBorrow() const {
+    if (isVariable()) return RawBytes() > NODE_DATA_CAP / 2;
+    return _iKeyVec.size() > (_nCap + 1) / 2;
+}
 bool BPTreeNode::isLeaf() const { return _iNodeType == NodeType::LEAF_NODE_TYPE; }
 PageID BPTreeNode::GetParentID() const { return _nParentID; }
 void BPTreeNode::SetParentID(PageID nPageID) { _nParentID = nPageID; _bModified = true; }
 
+bool BPTreeNode::isVariable() const { return _iKeyType == FieldType::STRING_TYPE; }
+
+// 变长格式中每一项的定长部分：后缀长度 + 子节点页面(内部节点) / 记录位置和溢出页面(叶子节点)
+Size BPTreeNode::EntrySize() const { return isLeaf() ? 2 + 4 + 2 + 4 : 2 + 4; }
+
+Size BPTreeNode::PrefixSize() const {
+    if (_iKeyVec.empty()) return 0;
+    // 键有序，首尾两个键的公共前缀就是所有键的公共前缀
+    return CommonPrefix(KeyString(_iKeyVec.front()), KeyString(_iKeyVec.back()));
+}
+
+Size BPTreeNode::UsedBytes() const {
+    Size prefix = PrefixSize();
+    Size used = 2 + prefix;
+    for (const auto& pKey : _iKeyVec) {
+        used += EntrySize() + KeyString(pKey).size() - prefix;
+    }
+    return used;
+}
+
+Size BPTreeNode::RawBytes() const {
+    Size used = 2;
+    for (const auto& pKey : _iKeyVec) {
+        used += EntrySize() + KeyString(pKey).size();
+    }
+    return used;
+}
+
+Size BPTreeNode::SplitRank() const {
+    if (!isVariable()) return _nCap / 2;
+    Size size = _iKeyVec.size();
+    assert(size >= 2);
+    // 拆出的节点的前缀不会短于当前前缀，按当前前缀估计的大小是上界
+    Size prefix = PrefixSize();
+    std::vector<Size> entryBytes(size);
+    Size total = 0;
+    for (Size i = 0; i < size; ++i) {
+        entryBytes[i] = EntrySize() + KeyString(_iKeyVec[i]).size() - prefix;
+        total += entryBytes[i];
+    }
+    // 左右两部分字节数尽量平均
+    Size rank = 0, left = entryBytes[0];
+    while (rank + 2 < size && left * 2 < total) left += entryBytes[++rank];
+    // 右侧部分必须放得下，当前节点放不下的部分由调用方继续分裂
+    Size right = total - left;
+    while (rank + 2 < size && 2 + prefix + right > NODE_DATA_CAP) {
+        right -= entryBytes[++rank];
+    }
+    return rank;
+}
+
 PageID BPTreeNode::GetNextLeafID() const {
     assert(isLeaf());
     return _nNextID;
@@ -134,7 +212,7 @@ bool BPTreeNode::DeleteInLeaf(Size rank, const PageSlotID &iPair) {
 void BPTreeNode::InsertInLeaf(Field* pKey, const PageSlotID &iPair) {
     assert(isLeaf());
     Rank rank = LowerBound(pKey);
-    if (rank >= int(_iKeyVec.size()) || !Equal(_iKeyVec[rank], pKey, _iKeyType)) {
+    if (rank >= int(_iKeyVec.size()) || !_pCmp->Equal(_iKeyVec[rank], pKey)) {
         _iKeyVec.insert(_iKeyVec.begin() + rank, pKey->Copy());
         _iChildVec.insert(_iChildVec.begin() + rank, iPair);
         _iOverflowVec.insert(_iOverflowVec.begin() + rank, NULL_PAGE);
@@ -170,7 +248,7 @@ void BPTreeNode::InsertInLeaf(Field* pKey, const PageSlotID &iPair) {
 bool BPTreeNode::UpdateInLeaf(Field* pKey, const PageSlotID &iOld, const PageSlotID& iNew) {
     bool exist = false;
     Rank rank = LowerBound(pKey);
-    if (rank >= int(_iKeyVec.size()) || !Equal(_iKeyVec[rank], pKey, _iKeyType)) {
+    if (rank >= int(_iKeyVec.size()) || !_pCmp->Equal(_iKeyVec[rank], pKey)) {
         exist = false;
     } else {
         if (_iChildVec[rank] == iOld) {
@@ -195,15 +273,16 @@ bool BPTreeNode::UpdateInLeaf(Field* pKey, const PageSlotID &iOld, const PageSlo
     return exist;
 }
 
+// 固定页面后直接从帧中解析，键值不经过中间缓冲区
 void BPTreeNode::Load() {
-    MiniOS* minios = MiniOS::GetOS(); // 单例模式，不必销毁
-    minios->ReadPage(_nPageID, (uint8_t *)&_iNodeType, 4, NODE_TYPE_OFFSET);
-    minios->ReadPage(_nPageID, (uint8_t *)&_iKeyType, 4, NODE_KEY_TYPE_OFFSET);
-    minios->ReadPage(_nPageID, (uint8_t *)&_nKeySize, 4, NODE_KEY_SIZE_OFFSET);
-    Size size;
-    minios->ReadPage(_nPageID, (uint8_t *)&size, 4, NODE_SIZE_OFFSET);
-    minios->ReadPage(_nPageID, (uint8_t *)&_nNextID, 4, NODE_NEXT_OFFSET);
-    minios->ReadPage(_nPageID, (uint8_t *)&_nParentID, 4, NODE_PARENT_OFFSET);
+    PageGuard iGuard(_nPageID);
+    _iNodeType = iGuard.Get<NodeType>(NODE_TYPE_OFFSET);
+    _iKeyType = iGuard.Get<FieldType>(NODE_KEY_TYPE_OFFSET);
+    _pCmp = &GetComparator(_iKeyType);
+    _nKeySize = iGuard.Get<Size>(NODE_KEY_SIZE_OFFSET);
+    Size size = iGuard.Get<Size>(NODE_SIZE_OFFSET);
+    _nNextID = iGuard.Get<PageID>(NODE_NEXT_OFFSET);
+    _nParentID = iGuard.Get<PageID>(NODE_PARENT_OFFSET);
     if (_iNodeType == NodeType::INNER_NODE_TYPE) {
         _nCap = (PAGE_SIZE - NODE_DATA_OFFSET) / (_nKeySize + 4);
     } else {
@@ -212,121 +291,135 @@ void BPTreeNode::Load() {
     // assert(size <= _nCap);
     PageOffset valueBegin = NODE_DATA_OFFSET + _nCap * _nKeySize;
     PageOffset overflowBegin = valueBegin + _nCap * 8;
-    uint8_t* dst = new uint8_t[_nKeySize];
-    if (_iNodeType == NodeType::INNER_NODE_TYPE) {
+    if (!IsIntegerType(_iKeyType) && _iKeyType != FieldType::FLOAT_TYPE &&
+        _iKeyType != FieldType::STRING_TYPE) {
+        throw IndexTypeException();
+    }
+    _iKeyVec.reserve(size);
+    _iChildVec.reserve(size);
+    if (isVariable()) {
+        // 公共前缀 | 每一项的后缀长度和值 | 所有后缀
+        PageOffset offset = NODE_DATA_OFFSET;
+        Size prefix = iGuard.Get<uint16_t>(offset);
+        String sPrefix((const char*)iGuard.GetPtr(offset + 2), prefix);
+        offset += 2 + prefix;
+        PageOffset suffixBegin = offset + size * EntrySize();
+        if (isLeaf()) _iOverflowVec.reserve(size);
         for (Size i = 0; i < size; ++i) {
-            PageSlotID value;
-            Field* _field;
-            minios->ReadPage(_nPageID, dst, _nKeySize, NODE_DATA_OFFSET + i * _nKeySize);
-            minios->ReadPage(_nPageID, (uint8_t *)&(value.first), 4, valueBegin + i * 4);
-            if (_iKeyType == FieldType::INT_TYPE) {
-                _field = new IntField(dst, _nKeySize);
-            } else if (_iKeyType == FieldType::FLOAT_TYPE) {
-                _field = new FloatField(dst, _nKeySize);
+            Size suffix = iGuard.Get<uint16_t>(offset);
+            _iKeyVec.push_back(new StringField(
+                sPrefix + String((const char*)iGuard.GetPtr(suffixBegin), suffix)));
+            suffixBegin += suffix;
+            if (isLeaf()) {
+                _iChildVec.push_back({iGuard.Get<PageID>(offset + 2),
+                                      iGuard.Get<SlotID>(offset + 6)});
+                _iOverflowVec.push_back(iGuard.Get<PageID>(offset + 8));
             } else {
-                throw IndexTypeException();
+                _iChildVec.push_back({iGuard.Get<PageID>(offset + 2), 0});
             }
-            _iKeyVec.push_back(_field);
-            _iChildVec.push_back(value);
+            offset += EntrySize();
+        }
+        return;
+    }
+    for (Size i = 0; i < size; ++i) {
+        const uint8_t* src = iGuard.GetPtr(NODE_DATA_OFFSET + i * _nKeySize);
+        if (IsIntType(_iKeyType)) {
+            _iKeyVec.push_back(new IntField(src, _nKeySize));
+        } else if (_iKeyType == FieldType::BIGINT_TYPE) {
+            _iKeyVec.push_back(new BigIntField(src, _nKeySize));
+        } else {
+            _iKeyVec.push_back(new FloatField(src, _nKeySize));
+        }
+    }
+    if (_iNodeType == NodeType::INNER_NODE_TYPE) {
+        for (Size i = 0; i < size; ++i) {
+            _iChildVec.push_back({iGuard.Get<PageID>(valueBegin + i * 4), 0});
         }
     } else {
+        _iOverflowVec.reserve(size);
         for (Size i = 0; i < size; ++i) {
-            PageSlotID value;
-            PageID page;
-            Field* _field;
-            minios->ReadPage(_nPageID, dst, _nKeySize, NODE_DATA_OFFSET + i * _nKeySize);
-            minios->ReadPage(_nPageID, (uint8_t *)&(value.first), 4, valueBegin + i * 8);
-            minios->ReadPage(_nPageID, (uint8_t *)&(value.second), 4, valueBegin + i * 8 + 4);
-            minios->ReadPage(_nPageID, (uint8_t *)&page, 4, overflowBegin + i * 4);
-            if (_iKeyType == FieldType::INT_TYPE) {
-                _field = new IntField(dst, _nKeySize);
-            } else if (_iKeyType == FieldType::FLOAT_TYPE) {
-                _field = new FloatField(dst, _nKeySize);
-            } else {
-                throw IndexTypeException();
-            }
-            _iKeyVec.push_back(_field);
-            _iChildVec.push_back(value);
-            _iOverflowVec.push_back(page);
+            _iChildVec.push_back({iGuard.Get<PageID>(valueBegin + i * 8),
+                                  iGuard.Get<SlotID>(valueBegin + i * 8 + 4)});
+            _iOverflowVec.push_back(iGuard.Get<PageID>(overflowBegin + i * 4));
         }
     }
-    delete[] dst;
 }
 
 void BPTreeNode::Store() {
-    MiniOS* minios = MiniOS::GetOS(); // 单例模式，不必销毁
-    minios->WritePage(_nPageID, (uint8_t *)&_iNodeType, 4, NODE_TYPE_OFFSET);
-    minios->WritePage(_nPageID, (uint8_t *)&_iKeyType, 4, NODE_KEY_TYPE_OFFSET);
-    minios->WritePage(_nPageID, (uint8_t *)&_nKeySize, 4, NODE_KEY_SIZE_OFFSET);
+    PageGuard iGuard(_nPageID);
+    iGuard.Set<NodeType>(NODE_TYPE_OFFSET, _iNodeType);
+    iGuard.Set<FieldType>(NODE_KEY_TYPE_OFFSET, _iKeyType);
+    iGuard.Set<Size>(NODE_KEY_SIZE_OFFSET, _nKeySize);
     Size size = _iKeyVec.size();
+    iGuard.Set<Size>(NODE_SIZE_OFFSET, size);
+    iGuard.Set<PageID>(NODE_NEXT_OFFSET, _nNextID);
+    iGuard.Set<PageID>(NODE_PARENT_OFFSET, _nParentID);
+    if (isVariable()) {
+        assert(!needSplit());
+        PageOffset offset = NODE_DATA_OFFSET;
+        Size prefix = PrefixSize();
+        iGuard.Set<uint16_t>(offset, prefix);
+        if (prefix > 0) {
+            memcpy(iGuard.GetMutablePtr(offset + 2), KeyString(_iKeyVec[0]).data(), prefix);
+        }
+        offset += 2 + prefix;
+        PageOffset suffixBegin = offset + size * EntrySize();
+        for (Size i = 0; i < size; ++i) {
+            const String& sKey = KeyString(_iKeyVec[i]);
+            Size suffix = sKey.size() - prefix;
+            iGuard.Set<uint16_t>(offset, suffix);
+            iGuard.Set<PageID>(offset + 2, _iChildVec[i].first);
+            if (isLeaf()) {
+                iGuard.Set<SlotID>(offset + 6, _iChildVec[i].second);
+                iGuard.Set<PageID>(offset + 8, _iOverflowVec[i]);
+            }
+            memcpy(iGuard.GetMutablePtr(suffixBegin), sKey.data() + prefix, suffix);
+            suffixBegin += suffix;
+            offset += EntrySize();
+        }
+        return;
+    }
     assert(size <= _nCap);
-    minios->WritePage(_nPageID, (uint8_t *)&size, 4, NODE_SIZE_OFFSET);
-    minios->WritePage(_nPageID, (uint8_t *)&_nNextID, 4, NODE_NEXT_OFFSET);
-    minios->WritePage(_nPageID, (uint8_t *)&_nParentID, 4, NODE_PARENT_OFFSET);
     PageOffset valueBegin = NODE_DATA_OFFSET + _nCap * _nKeySize;
     PageOffset overflowBegin = valueBegin + _nCap * 8;
-    uint8_t* dst = new uint8_t[_nKeySize];
+    for (Size i = 0; i < size; ++i) {
+        _iKeyVec[i]->GetData(iGuard.GetMutablePtr(NODE_DATA_OFFSET + i * _nKeySize), _nKeySize);
+    }
     if (_iNodeType == NodeType::INNER_NODE_TYPE) {
         for (Size i = 0; i < size; ++i) {
-            _iKeyVec[i]->GetData(dst, _nKeySize);
-            minios->WritePage(_nPageID, dst, _nKeySize, NODE_DATA_OFFSET + i * _nKeySize);
-            minios->WritePage(_nPageID, (uint8_t *)&(_iChildVec[i].first), 4, valueBegin + i * 4);
+            iGuard.Set<PageID>(valueBegin + i * 4, _iChildVec[i].first);
         }
     } else {
         for (Size i = 0; i < size; ++i) {
-            _iKeyVec[i]->GetData(dst, _nKeySize);
-            minios->WritePage(_nPageID, dst, _nKeySize, NODE_DATA_OFFSET + i * _nKeySize);
-            minios->WritePage(_nPageID, (uint8_t *)&(_iChildVec[i].first), 4, valueBegin + i * 8);
-            minios->WritePage(_nPageID, (uint8_t *)&(_iChildVec[i].second), 4, valueBegin + i * 8 + 4);
-            minios->WritePage(_nPageID, (uint8_t *)&(_iOverflowVec[i]), 4, overflowBegin + i * 4);
+            iGuard.Set<PageID>(valueBegin + i * 8, _iChildVec[i].first);
+            iGuard.Set<Size>(valueBegin + i * 8 + 4, _iChildVec[i].second);
+            iGuard.Set<PageID>(overflowBegin + i * 4, _iOverflowVec[i]);
         }
     }
-    delete[] dst;
 }
 
 // >= pKey的第一个Key在KeyVec中的位置
+// 二分查找在比较器中按键类型展开，循环内直接比较键的值
 Rank BPTreeNode::LowerBound(Field *pKey) {
-    // 二分查找找下界，此处给出实现
-    // 边界的理解非常重要，可以自行重新测试一下
-    Rank nBegin = 0, nEnd = _iKeyVec.size();
-    while (nBegin < nEnd) {
-        Rank nMid = (nBegin + nEnd) / 2;
-        if (!Less(_iKeyVec[nMid], pKey, _iKeyType)) {
-            nEnd = nMid;
-        } else {
-            nBegin = nMid + 1;
-        }
-    }
-    return nBegin;
+    return _pCmp->LowerBound(_iKeyVec, pKey);
 }
 
 // > pKey的第一个Key在KeyVec中的位置
 Rank BPTreeNode::UpperBound(Field *pKey) {
-    // 二分查找找上界，此处给出实现
-    // 边界的理解非常重要，可以自行重新测试一下
-    Rank nBegin = 0, nEnd = _iKeyVec.size();
-    while (nBegin < nEnd) {
-        Rank nMid = (nBegin + nEnd) / 2;
-        if (Greater(_iKeyVec[nMid], pKey, _iKeyType)) {
-            nEnd = nMid;
-        } else {
-            nBegin = nMid + 1;
-        }
-    }
-    return nBegin;
+    return _pCmp->UpperBound(_iKeyVec, pKey);
 }
 
 // <= pKey 的最后一个Key在KeyVec中的位置
 Rank BPTreeNode::LessOrEqualBound(Field *pKey) {
     if (Empty()) return -1;
-    if (Less(pKey, _iKeyVec[0], _iKeyType)) return -1;
+    if (_pCmp->Less(pKey, _iKeyVec[0])) return -1;
     return UpperBound(pKey) - 1;
 }
 
 // < pKey 的最后一个Key在KeyVec中的位置
 Rank BPTreeNode::LessBound(Field* pKey) {
     if (Empty()) return -1;
-    if (Less(pKey, _iKeyVec[0], _iKeyType)) return -1;
+    if (_pCmp->Less(pKey, _iKeyVec[0])) return -1;
     return LowerBound(pKey) - 1;
 }
 
@@ -15,6 +15,9 @@ enum class NodeType {
     LEAF_NODE_TYPE = 1,
 };
 
+// 字符串键的最大长度，保证一个节点至少能放下两个键
+const Size BPTREE_MAX_KEY_SIZE = 1024;
+
 class Index;
 
 // B+Tree节点，内部节点或叶子节点
@@ -26,6 +29,8 @@ class BPTreeNode: public Page {
     // key的类型和大小
     FieldType _iKeyType;
     Size _nKeySize;
+    // 按键类型选择一次的比较器
+    const FieldComparator* _pCmp;
     Size _nCap;
     PageID _nNextID;
     PageID _nParentID;
@@ -34,8 +39,17 @@ class BPTreeNode: public Page {
     std::vector<PageSlotID> _iChildVec;
     std::vector<PageID> _iOverflowVec;
 
+    // 字符串键变长存储，节点内所有键共享的前缀只存一次
+    bool isVariable() const;
+    Size EntrySize() const;
+    Size PrefixSize() const;
+    // 前缀压缩后占用的字节数
+    Size UsedBytes() const;
+    // 不压缩前缀时占用的字节数，合并与借用按这个大小判断，保证合并后一定放得下
+    Size RawBytes() const;
+
 public:
-    BPTreeNode(Size nKeySize, FieldType iKeyType, NodeType iNodeType);
+    BPTreeNode(Size nKeySize, FieldType iKeyType, NodeType iNodeType, PageID nHintID = NULL_PAGE);
     BPTreeNode(PageID nPageID);
     ~BPTreeNode();
     Size GetKeySize() const;
@@ -47,6 +61,8 @@ public:
     bool needSplit() const;
     bool needMerge() const;
     bool canBeBorrow() const;
+    // 分裂时保留在当前节点的最后一个键的位置，右侧部分保证能放进一个节点
+    Size SplitRank() const;
     bool isLeaf() const;
     PageID GetNextLeafID() const;
     PageID GetParentID() const;
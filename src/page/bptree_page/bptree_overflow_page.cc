@@ -1,5 +1,6 @@
 
 #include "bptree_overflow_page.h"
+#include "page/page_guard.h"
 #include <cassert>
 #include <vector>
 #include <algorithm>
@@ -24,27 +25,25 @@ BPTreeOverflowNode::~BPTreeOverflowNode() {
 }
 
 void BPTreeOverflowNode::Load() {
-    MiniOS* minios = MiniOS::GetOS(); // 单例模式，不必销毁
-    minios->ReadPage(_nPageID, (uint8_t *)&_nNextID, 4, OVERFLOW_NODE_NEXT_OFFSET);
-    Size size;
-    minios->ReadPage(_nPageID, (uint8_t *)&size, 4, OVERFLOW_NODE_SIZE_OFFSET);
+    PageGuard iGuard(_nPageID);
+    _nNextID = iGuard.Get<PageID>(OVERFLOW_NODE_NEXT_OFFSET);
+    Size size = iGuard.Get<Size>(OVERFLOW_NODE_SIZE_OFFSET);
     assert(size <= OVERFLOW_NODE_CAP);
+    _iValueVec.reserve(size);
     for (Size i = 0; i < size; ++i) {
-        PageSlotID value;
-        minios->ReadPage(_nPageID, (uint8_t *)&(value.first), 4, OVERFLOW_NODE_DATA_OFFSET + i * 8);
-        minios->ReadPage(_nPageID, (uint8_t *)&(value.second), 4, OVERFLOW_NODE_DATA_OFFSET + i * 8 + 4);
-        _iValueVec.push_back(value);
+        _iValueVec.push_back({iGuard.Get<PageID>(OVERFLOW_NODE_DATA_OFFSET + i * 8),
+                              iGuard.Get<SlotID>(OVERFLOW_NODE_DATA_OFFSET + i * 8 + 4)});
     }
 }
 
 void BPTreeOverflowNode::Store() {
-    MiniOS* minios = MiniOS::GetOS(); // 单例模式，不必销毁
-    minios->WritePage(_nPageID, (uint8_t *)&_nNextID, 4, OVERFLOW_NODE_NEXT_OFFSET);
+    PageGuard iGuard(_nPageID);
+    iGuard.Set<PageID>(OVERFLOW_NODE_NEXT_OFFSET, _nNextID);
     Size size = _iValueVec.size();
-    minios->WritePage(_nPageID, (uint8_t *)&size, 4, OVERFLOW_NODE_SIZE_OFFSET);
+    iGuard.Set<Size>(OVERFLOW_NODE_SIZE_OFFSET, size);
     for (Size i = 0; i < size; ++i) {
-        minios->WritePage(_nPageID, (uint8_t *)&(_iValueVec[i].first), 4, OVERFLOW_NODE_DATA_OFFSET + i * 8);
-        minios->WritePage(_nPageID, (uint8_t *)&(_iValueVec[i].second), 4, OVERFLOW_NODE_DATA_OFFSET + i * 8 + 4);
+        iGuard.Set<PageID>(OVERFLOW_NODE_DATA_OFFSET + i * 8, _iValueVec[i].first);
+        iGuard.Set<Size>(OVERFLOW_NODE_DATA_OFFSET + i * 8 + 4, _iValueVec[i].second);
     }
 }
 
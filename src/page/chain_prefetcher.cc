@@ -0,0 +1,90 @@
+#include "page/chain_prefetcher.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "macros.h"
+#include "page/linked_page.h"
+#include "settings.h"
+
+namespace thdb {
+
+ChainPrefetcher::ChainPrefetcher()
+    : _nFrontID(NULL_PAGE),
+      _nFetched(0),
+      _nConsumed(0),
+      _nWindow(PREFETCH_MIN_PAGES),
+      _nAhead(0),
+      _bQueued(false),
+      _bSubmitted(false) {
+  const char *sPrefetch = getenv("THDB_PREFETCH");
+  _bEnabled = sPrefetch == nullptr || atoi(sPrefetch) != 0;
+}
+
+ChainPrefetcher::~ChainPrefetcher() {
+  if (_bSubmitted) MiniOS::GetOS()->CancelPrefetch(this);
+}
+
+void ChainPrefetcher::Advance(PageID nPageID) {
+  if (!_bEnabled) return;
+  {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    ++_nConsumed;
+    if (_nConsumed == 1) {
+      // 只有一个页面的链表不需要预读
+      _nFrontID = LinkedPage(nPageID).GetNextID();
+      _nFetched = 1;
+    } else if (_nConsumed > _nFetched && _nFrontID != NULL_PAGE) {
+      _nWindow = std::min(_nWindow * 2, PREFETCH_MAX_PAGES);
+      _nAhead = 0;
+    } else if (++_nAhead >= _nWindow) {
+      _nWindow = std::max(_nWindow / 2, PREFETCH_MIN_PAGES);
+      _nAhead = 0;
+    }
+    if (_bQueued || !NeedFetch()) return;
+    _bQueued = true;
+    _bSubmitted = true;
+  }
+  MiniOS::GetOS()->SubmitPrefetch(this);
+}
+
+bool ChainPrefetcher::Step() {
+  PageID nFrontID;
+  Size nBatch;
+  {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    if (!NeedFetch()) {
+      _bQueued = false;
+      return false;
+    }
+    nFrontID = _nFrontID;
+    nBatch = _nConsumed + _nWindow - _nFetched;
+  }
+  Size nWalked = 0;
+  PageID nCur = nFrontID;
+  try {
+    std::vector<PageID> iPageVec;
+    for (Size i = 0; i < nBatch && nFrontID + i < DB_PAGES; ++i)
+      iPageVec.push_back(nFrontID + i);
+    MiniOS::GetOS()->PrefetchPages(iPageVec);
+    // 沿链表确认，离开这一批的范围时从实际的下一个页面重新开始
+    do {
+      nCur = LinkedPage(nCur).GetNextID();
+      ++nWalked;
+    } while (nCur != NULL_PAGE && nWalked < nBatch && nCur >= nFrontID &&
+             nCur < nFrontID + nBatch);
+  } catch (const std::exception &e) {
+    // 预读只是优化，出错时停止预读，由扫描自己报告错误
+    nCur = NULL_PAGE;
+  }
+  std::lock_guard<std::mutex> iGuard(_iMutex);
+  _nFrontID = nCur;
+  _nFetched += nWalked;
+  return true;
+}
+
+bool ChainPrefetcher::NeedFetch() const {
+  return _nFrontID != NULL_PAGE && _nFetched <= _nConsumed + _nWindow / 2;
+}
+
+}  // namespace thdb
@@ -0,0 +1,57 @@
+#ifndef THDB_CHAIN_PREFETCHER_H_
+#define THDB_CHAIN_PREFETCHER_H_
+
+#include <mutex>
+
+#include "defines.h"
+#include "minios/os.h"
+
+namespace thdb {
+
+/**
+ * @brief 沿 LinkedPage 链表的预读器。
+ * 由 MiniOS 的预读线程在扫描位置之前维持一个预读窗口：由于链表中的页面按分配提示
+ * 尽量相邻，先假设后续页面连续并整批交给 MiniOS::PrefetchPages 合并读入，再沿
+ * GetNextID 确认实际的链表顺序。扫描追上预读位置时窗口加倍，直到
+ * PREFETCH_MAX_PAGES；连续扫描一整个窗口都没有追上时窗口减半，直到
+ * PREFETCH_MIN_PAGES，减少预读占用的缓冲帧。
+ */
+class ChainPrefetcher : public PrefetchTask {
+ public:
+  ChainPrefetcher();
+  /**
+   * @brief 从预读线程的队列中移除，等待正在进行的预读结束
+   */
+  ~ChainPrefetcher();
+
+  /**
+   * @brief 扫描即将访问页面 nPageID 时调用，预读落后时把自己交给预读线程
+   */
+  void Advance(PageID nPageID);
+  bool Step() override;
+
+ private:
+  /**
+   * @brief 预读位置落后于窗口的一半时补满窗口，每批至少半个窗口
+   */
+  bool NeedFetch() const;
+
+  // 下一个尚未预读的链表页面
+  PageID _nFrontID;
+  // 已预读和已扫描的链表页面数量
+  Size _nFetched;
+  Size _nConsumed;
+  Size _nWindow;
+  // 上次调整窗口之后没有追上预读位置的扫描页面数
+  Size _nAhead;
+  bool _bEnabled;
+  // 是否在预读线程的队列中
+  bool _bQueued;
+  bool _bSubmitted;
+
+  std::mutex _iMutex;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_CHAIN_PREFETCHER_H_
@@ -0,0 +1,165 @@
+#include "page/free_space_map.h"
+
+#include <algorithm>
+
+#include "macros.h"
+#include "minios/os.h"
+#include "page/linked_page.h"
+#include "page/page_guard.h"
+
+namespace thdb {
+
+const PageOffset ENTRY_NUM_OFFSET = 12;
+// 每项占用一个页面编号和一个字节的等级，页面编号在前，等级在后
+const Size LEAF_ENTRIES = DATA_SIZE / (sizeof(PageID) + 1);
+const PageOffset LEAF_LEVEL_OFFSET = LEAF_ENTRIES * sizeof(PageID);
+
+// NOTE: 本构造对象 会 向OS请求新的页面
+FreeSpaceMap::FreeSpaceMap(PageID nHintID, bool) {
+  LinkedPage *pPage = new LinkedPage(nHintID, true);
+  _nRootID = pPage->GetPageID();
+  delete pPage;
+  PageGuard iGuard(_nRootID);
+  iGuard.Set<uint16_t>(ENTRY_NUM_OFFSET, 0);
+  _iLeafVec.push_back({_nRootID, 0});
+}
+
+// NOTE: 本构造对象 并不会 向OS请求新的页面
+FreeSpaceMap::FreeSpaceMap(PageID nRootID) : _nRootID(nRootID) { Load(); }
+
+PageID FreeSpaceMap::GetRootID() const { return _nRootID; }
+
+void FreeSpaceMap::Load() {
+  PageID nLeafID = _nRootID;
+  while (nLeafID != NULL_PAGE) {
+    LinkedPage *pPage = new LinkedPage(nLeafID);
+    PageID nNextID = pPage->GetNextID();
+    delete pPage;
+    PageGuard iGuard(nLeafID);
+    Size nEntries = iGuard.Get<uint16_t>(ENTRY_NUM_OFFSET);
+    uint8_t nMax = 0;
+    for (Size i = 0; i < nEntries && i < LEAF_ENTRIES; ++i) {
+      PageID nPageID =
+          iGuard.Get<PageID>(HEADER_SIZE + i * sizeof(PageID));
+      uint8_t nFree = iGuard.Get<uint8_t>(HEADER_SIZE + LEAF_LEVEL_OFFSET + i);
+      _iPosMap[nPageID] = _iPageVec.size();
+      _iPageVec.push_back(nPageID);
+      _iFreeVec.push_back(nFree);
+      nMax = std::max(nMax, nFree);
+    }
+    _iLeafVec.push_back({nLeafID, nMax});
+    nLeafID = nNextID;
+  }
+}
+
+void FreeSpaceMap::Store(Size nPos, bool bNew) {
+  Size nLeaf = nPos / LEAF_ENTRIES, nIndex = nPos % LEAF_ENTRIES;
+  PageGuard iGuard(_iLeafVec[nLeaf].nPageID);
+  iGuard.Set<uint8_t>(HEADER_SIZE + LEAF_LEVEL_OFFSET + nIndex,
+                      _iFreeVec[nPos]);
+  if (!bNew) return;
+  iGuard.Set<PageID>(HEADER_SIZE + nIndex * sizeof(PageID), _iPageVec[nPos]);
+  // 新增项总是追加在最后一个映射页面的末尾
+  if (nPos + 1 == _iPageVec.size())
+    iGuard.Set<uint16_t>(ENTRY_NUM_OFFSET, nIndex + 1);
+}
+
+void FreeSpaceMap::UpdateMax(Size nLeaf) {
+  Size nBegin = nLeaf * LEAF_ENTRIES;
+  Size nEnd = std::min(nBegin + LEAF_ENTRIES, (Size)_iFreeVec.size());
+  uint8_t nMax = 0;
+  for (Size i = nBegin; i < nEnd; ++i) nMax = std::max(nMax, _iFreeVec[i]);
+  _iLeafVec[nLeaf].nMax = nMax;
+}
+
+void FreeSpaceMap::Update(PageID nPageID, uint8_t nFree) {
+  auto it = _iPosMap.find(nPageID);
+  if (it != _iPosMap.end()) {
+    Size nPos = it->second;
+    uint8_t nOld = _iFreeVec[nPos];
+    if (nOld == nFree) return;
+    _iFreeVec[nPos] = nFree;
+    Store(nPos, false);
+    Size nLeaf = nPos / LEAF_ENTRIES;
+    // 只有原来的最大值变小时才需要重新计算
+    if (nFree > _iLeafVec[nLeaf].nMax)
+      _iLeafVec[nLeaf].nMax = nFree;
+    else if (nOld == _iLeafVec[nLeaf].nMax)
+      UpdateMax(nLeaf);
+    return;
+  }
+  Size nPos = _iPageVec.size();
+  // 最后一个映射页面已满时在链表结尾添加新的映射页面
+  if (nPos == _iLeafVec.size() * LEAF_ENTRIES) {
+    PageID nLastID = _iLeafVec.back().nPageID;
+    LinkedPage *pPage = new LinkedPage(nLastID, true);
+    LinkedPage *pLast = new LinkedPage(nLastID);
+    pLast->PushBack(pPage);
+    _iLeafVec.push_back({pPage->GetPageID(), 0});
+    delete pLast;
+    delete pPage;
+  }
+  _iPosMap[nPageID] = nPos;
+  _iPageVec.push_back(nPageID);
+  _iFreeVec.push_back(nFree);
+  Store(nPos, true);
+  Leaf &iLeaf = _iLeafVec[nPos / LEAF_ENTRIES];
+  iLeaf.nMax = std::max(iLeaf.nMax, nFree);
+}
+
+void FreeSpaceMap::Remove(PageID nPageID) {
+  auto it = _iPosMap.find(nPageID);
+  if (it == _iPosMap.end()) return;
+  Size nPos = it->second, nLast = _iPageVec.size() - 1;
+  _iPosMap.erase(it);
+  if (nPos != nLast) {
+    _iPageVec[nPos] = _iPageVec[nLast];
+    _iFreeVec[nPos] = _iFreeVec[nLast];
+    _iPosMap[_iPageVec[nPos]] = nPos;
+    Store(nPos, true);
+  }
+  _iPageVec.pop_back();
+  _iFreeVec.pop_back();
+  Size nLeaf = nLast / LEAF_ENTRIES;
+  if (nLast % LEAF_ENTRIES == 0 && nLeaf > 0) {
+    // 最后一个映射页面已空，从链表中释放
+    LinkedPage *pPrev = new LinkedPage(_iLeafVec[nLeaf - 1].nPageID);
+    pPrev->PopBack();
+    delete pPrev;
+    _iLeafVec.pop_back();
+  } else {
+    PageGuard iGuard(_iLeafVec[nLeaf].nPageID);
+    iGuard.Set<uint16_t>(ENTRY_NUM_OFFSET, nLast % LEAF_ENTRIES);
+    UpdateMax(nLeaf);
+  }
+  if (nPos / LEAF_ENTRIES != nLeaf) UpdateMax(nPos / LEAF_ENTRIES);
+}
+
+uint8_t FreeSpaceMap::Get(PageID nPageID) const {
+  auto it = _iPosMap.find(nPageID);
+  if (it == _iPosMap.end()) return 0;
+  return _iFreeVec[it->second];
+}
+
+PageID FreeSpaceMap::Find(uint8_t nNeed) const {
+  for (Size nLeaf = 0; nLeaf < _iLeafVec.size(); ++nLeaf) {
+    if (_iLeafVec[nLeaf].nMax < nNeed) continue;
+    Size nBegin = nLeaf * LEAF_ENTRIES;
+    Size nEnd = std::min(nBegin + LEAF_ENTRIES, (Size)_iFreeVec.size());
+    for (Size i = nBegin; i < nEnd; ++i)
+      if (_iFreeVec[i] >= nNeed) return _iPageVec[i];
+  }
+  return NULL_PAGE;
+}
+
+void FreeSpaceMap::Clear() {
+  for (const auto &iLeaf : _iLeafVec)
+    MiniOS::GetOS()->DeletePage(iLeaf.nPageID);
+  _iLeafVec.clear();
+  _iPageVec.clear();
+  _iFreeVec.clear();
+  _iPosMap.clear();
+  _nRootID = NULL_PAGE;
+}
+
+}  // namespace thdb
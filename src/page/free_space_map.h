@@ -0,0 +1,80 @@
+#ifndef THDB_FREE_SPACE_MAP_H_
+#define THDB_FREE_SPACE_MAP_H_
+
+#include <unordered_map>
+#include <vector>
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief 表的空闲空间映射。
+ * 为表中的每个记录页面保存一个1字节的空闲等级，等级的含义由调用者决定，
+ * 等级越大表示剩余空间越多。等级保存在一条 LinkedPage 链表中，每个映射页面
+ * 按追加顺序存放若干 (页面编号, 等级) 项，修改时直接写入对应的映射页面。
+ * 打开时一次性读入内存，并为每个映射页面维护其中的最大等级，
+ * 查找时先跳过最大等级不足的映射页面，再在页面内查找，与表的页面数量基本无关。
+ * 映射只是提示，调用者需要在实际插入失败时更新对应页面的等级。
+ */
+class FreeSpaceMap {
+ public:
+  /**
+   * @brief 新建一个空的映射，bool参数只是为了重载
+   * @param nHintID 希望靠近的页面编号，通常为表的元数据页面
+   */
+  FreeSpaceMap(PageID nHintID, bool);
+  /**
+   * @brief 从映射的第一个页面导入映射
+   */
+  FreeSpaceMap(PageID nRootID);
+  ~FreeSpaceMap() = default;
+
+  PageID GetRootID() const;
+  /**
+   * @brief 设置页面的空闲等级，页面不在映射中时添加
+   */
+  void Update(PageID nPageID, uint8_t nFree);
+  /**
+   * @brief 从映射中移除页面，最后一项移动到空出的位置
+   */
+  void Remove(PageID nPageID);
+  /**
+   * @brief 页面的空闲等级，不在映射中时返回0
+   */
+  uint8_t Get(PageID nPageID) const;
+  /**
+   * @brief 查找一个空闲等级不小于 nNeed 的页面，按添加的顺序优先
+   *
+   * @return PageID 不存在时返回 NULL_PAGE
+   */
+  PageID Find(uint8_t nNeed) const;
+  /**
+   * @brief 释放映射占用的所有页面
+   */
+  void Clear();
+
+ private:
+  struct Leaf {
+    PageID nPageID;
+    uint8_t nMax;
+  };
+
+  void Load();
+  /**
+   * @brief 写入第 nPos 项的等级，bNew 为 true 时同时写入页面编号，
+   * 是最后一项时还会写入所在映射页面的项数
+   */
+  void Store(Size nPos, bool bNew);
+  void UpdateMax(Size nLeaf);
+
+  PageID _nRootID;
+  std::vector<Leaf> _iLeafVec;
+  std::vector<PageID> _iPageVec;
+  std::vector<uint8_t> _iFreeVec;
+  std::unordered_map<PageID, Size> _iPosMap;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_FREE_SPACE_MAP_H_
@@ -2,6 +2,7 @@
 
 #include "macros.h"
 #include "minios/os.h"
+#include "page/page_guard.h"
 
 namespace thdb {
 
@@ -15,23 +16,34 @@ LinkedPage::LinkedPage() : Page() {
   this->_nPrevID = NULL_PAGE;
 }
 
+// NOTE: 本构造对象 会 向OS请求新的页面
+LinkedPage::LinkedPage(PageID nHintID, bool) : Page(nHintID, true) {
+  this->_bModified = true;
+  this->_nNextID = NULL_PAGE;
+  this->_nPrevID = NULL_PAGE;
+}
+
 // NOTE: 本构造对象 并不会 向OS请求新的页面
 // 初始化对象的时候，读出页面的header元数据
 // _nNextID 放在页面header中 offset = 4 处
 // _nPrevID 放在页面header中 offset = 8 处
 LinkedPage::LinkedPage(PageID nPageID) : Page(nPageID) {
   this->_bModified = false;
-  GetHeader((uint8_t *)&_nNextID, 4, NEXT_PAGE_OFFSET);  // 32bit, 解析为一个PageID(uint32_t)
-  GetHeader((uint8_t *)&_nPrevID, 4, PREV_PAGE_OFFSET);
+  PageGuard iGuard(nPageID);
+  _nNextID = iGuard.Get<PageID>(NEXT_PAGE_OFFSET);  // 32bit, 解析为一个PageID(uint32_t)
+  _nPrevID = iGuard.Get<PageID>(PREV_PAGE_OFFSET);
 }
 
-LinkedPage::~LinkedPage() {
-  if (_bModified) {
-    // Dirty Page Condition
-    // RAII: 对象析构的时候写回dirty页面，保证正确性
-    SetHeader((uint8_t *)&_nNextID, 4, NEXT_PAGE_OFFSET);
-    SetHeader((uint8_t *)&_nPrevID, 4, PREV_PAGE_OFFSET);
-  }
+// RAII: 对象析构的时候写回dirty页面，保证正确性
+LinkedPage::~LinkedPage() { LinkedPage::Store(); }
+
+void LinkedPage::Store() {
+  if (!_bModified) return;
+  // Dirty Page Condition
+  PageGuard iGuard(_nPageID);
+  iGuard.Set<PageID>(NEXT_PAGE_OFFSET, _nNextID);
+  iGuard.Set<PageID>(PREV_PAGE_OFFSET, _nPrevID);
+  _bModified = false;
 }
 
 uint32_t LinkedPage::GetNextID() const { return _nNextID; }
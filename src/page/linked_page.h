@@ -14,6 +14,10 @@ class LinkedPage : public Page {
  public:
   LinkedPage();
   LinkedPage(PageID nPageID);
+  /**
+   * @brief 请求一个尽量靠近 nHintID 的新页面，bool参数只是为了重载
+   */
+  LinkedPage(PageID nHintID, bool);
   virtual ~LinkedPage();
 
   /**
@@ -36,6 +40,10 @@ class LinkedPage : public Page {
 
   void SetNextID(PageID nNextID);
   void SetPrevID(PageID nPrevID);
+  /**
+   * @brief 立即写回修改过的元数据，之后对象可以继续使用，析构时也会调用
+   */
+  virtual void Store();
 
  protected:
   PageID _nNextID;
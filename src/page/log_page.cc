@@ -7,17 +7,19 @@ namespace thdb {
 const PageOffset FIXED_SIZE_OFFSET = 12;
 const PageOffset NEXT_LOGLINE_OFFSET = 14;
 const PageOffset DATA_BEGIN_OFFSET = 0;
+const PageOffset LOGLINE_COUNT_OFFSET = 20;
 
 LogPage::LogPage(): LinkedPage() {
-    // only support INSERT. (txnid, op_type, record)
-    _nFixed = 8 + 4 + 4 + 4; // location size + txnid size(4 bytes) + logOp size(4 bytes) + table id
-    _nCap = (PAGE_SIZE - DATA_BEGIN_OFFSET) / _nFixed;
+    // only support INSERT. (txnid, op_type, record, count)
+    _nFixed = 8 + 4 + 4 + 4 + 4; // location size + txnid size(4 bytes) + logOp size(4 bytes) + table id + count
+    _nCap = (DATA_SIZE - DATA_BEGIN_OFFSET) / _nFixed;
     _nextLogLineID = 0;
 }
 
 LogPage::LogPage(PageID nPageID): LinkedPage(nPageID) {
     GetHeader((uint8_t *)&_nFixed, 2, FIXED_SIZE_OFFSET);
     GetHeader((uint8_t *)&_nextLogLineID, 2, NEXT_LOGLINE_OFFSET);
+    _nCap = (DATA_SIZE - DATA_BEGIN_OFFSET) / _nFixed;
 }
 
 LogPage::~LogPage() {
@@ -33,6 +35,8 @@ void LogPage::log(LogLine logline) {
     SetData((uint8_t *)&(logline._logOp), 4, DATA_BEGIN_OFFSET + _nextLogLineID * _nFixed + 8);
     SetData((uint8_t *)&(logline._location.first), 4, DATA_BEGIN_OFFSET + _nextLogLineID * _nFixed + 12);
     SetData((uint8_t *)&(logline._location.second), 4, DATA_BEGIN_OFFSET + _nextLogLineID * _nFixed + 16);
+    if (_nFixed >= LOGLINE_COUNT_OFFSET + 4)
+        SetData((uint8_t *)&(logline._count), 4, DATA_BEGIN_OFFSET + _nextLogLineID * _nFixed + LOGLINE_COUNT_OFFSET);
     _nextLogLineID ++;
 }
 
@@ -45,13 +49,20 @@ std::vector<LogLine> LogPage::getLogs() const {
         GetData((uint8_t *)&(logline._logOp), 4, DATA_BEGIN_OFFSET + i * _nFixed + 8);
         GetData((uint8_t *)&(logline._location.first), 4, DATA_BEGIN_OFFSET + i * _nFixed + 12);
         GetData((uint8_t *)&(logline._location.second), 4, DATA_BEGIN_OFFSET + i * _nFixed + 16);
+        if (_nFixed >= LOGLINE_COUNT_OFFSET + 4)
+            GetData((uint8_t *)&(logline._count), 4, DATA_BEGIN_OFFSET + i * _nFixed + LOGLINE_COUNT_OFFSET);
         logs.push_back(logline);
     }
     return logs;
 }
 
 bool LogPage::Full() const { 
-    return _nextLogLineID >= _nFixed; 
+    return _nextLogLineID >= _nCap; 
+}
+
+bool LogPage::CanLog(const LogLine &logline) const {
+    if (Full()) return false;
+    return logline._count == 1 || _nFixed >= LOGLINE_COUNT_OFFSET + 4;
 }
 
 } // namespace thdb
@@ -13,17 +13,21 @@ public:
         _txnID = 0;
         _logOp = LogOperation::UNDEFINED;
         _location = {0, 0};
+        _count = 1;
     }
-    LogLine(PageID tableID, TxnID txnID, LogOperation logOp, PageSlotID location) {
+    LogLine(PageID tableID, TxnID txnID, LogOperation logOp, PageSlotID location, Size count = 1) {
         _tableID = tableID;
         _txnID = txnID;
         _logOp = logOp;
         _location = location;
+        _count = count;
     }
     PageID _tableID;
     TxnID _txnID;
     LogOperation _logOp;
     PageSlotID _location;
+    // 同一页面上从 _location 开始的连续槽数量，批量插入时一条日志记录一段连续的槽
+    Size _count;
 };
 
 
@@ -35,6 +39,10 @@ public:
     void log(LogLine logline);
     std::vector<LogLine> getLogs() const;
     bool Full() const;
+    /**
+     * @brief 页面能否记录这条日志。旧版本的日志页面没有槽数量字段，只能记录单个槽
+     */
+    bool CanLog(const LogLine &logline) const;
 
 private:
     Size _nCap;
@@ -13,6 +13,12 @@ Page::Page() {
   this->_nPageID = MiniOS::GetOS()->NewPage();
 }
 
+// NOTE: 本构造对象 会 向OS请求新的页面，同一链表中的页面在文件中尽量相邻
+Page::Page(PageID nHintID, bool) {
+  this->_bModified = true;
+  this->_nPageID = MiniOS::GetOS()->NewPage(nHintID);
+}
+
 // NOTE: 本构造对象 并不会 向OS请求新的页面
 Page::Page(PageID nPageID) {
   this->_bModified = false;
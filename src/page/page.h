@@ -17,6 +17,10 @@ class Page {
  public:
   Page();
   Page(PageID nPageID);
+  /**
+   * @brief 请求一个尽量靠近 nHintID 的新页面，bool参数只是为了重载
+   */
+  Page(PageID nHintID, bool);
   virtual ~Page();
 
   PageID GetPageID() const;
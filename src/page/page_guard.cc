@@ -0,0 +1,23 @@
+#include "page/page_guard.h"
+
+#include "minios/os.h"
+
+namespace thdb {
+
+PageGuard::PageGuard(PageID nPageID)
+    : _nPageID(nPageID),
+      _pData(MiniOS::GetOS()->PinPage(nPageID)),
+      _bDirty(false) {}
+
+PageGuard::PageGuard(PageGuard &&iGuard)
+    : _nPageID(iGuard._nPageID),
+      _pData(iGuard._pData),
+      _bDirty(iGuard._bDirty) {
+  iGuard._pData = nullptr;
+}
+
+PageGuard::~PageGuard() {
+  if (_pData) MiniOS::GetOS()->UnpinPage(_nPageID, _bDirty);
+}
+
+}  // namespace thdb
@@ -0,0 +1,78 @@
+#ifndef THDB_PAGE_GUARD_H_
+#define THDB_PAGE_GUARD_H_
+
+#include <cassert>
+#include <cstring>
+
+#include "defines.h"
+#include "macros.h"
+
+namespace thdb {
+
+/**
+ * @brief 页面固定守卫。
+ * 构造时通过 MiniOS::PinPage 固定页面，析构时解除固定，
+ * 存续期间可以直接读写页面内容而不需要逐字段复制，也不需要每次访问都检查页面编号。
+ * 偏移量均相对于页面起始位置，数据部分从 HEADER_SIZE 开始。
+ */
+class PageGuard {
+ public:
+  /**
+   * @brief 固定一个已分配的页面
+   *
+   * @param nPageID 页面编号
+   */
+  explicit PageGuard(PageID nPageID);
+  PageGuard(PageGuard &&iGuard);
+  ~PageGuard();
+
+  PageGuard(const PageGuard &) = delete;
+  PageGuard &operator=(const PageGuard &) = delete;
+
+  PageID GetPageID() const { return _nPageID; }
+
+  /**
+   * @brief 只读访问，返回页面内 nOffset 处的地址
+   */
+  const uint8_t *GetPtr(PageOffset nOffset = 0) const {
+    assert(nOffset <= PAGE_SIZE);
+    return _pData + nOffset;
+  }
+  /**
+   * @brief 可写访问，返回页面内 nOffset 处的地址，并将页面标记为已修改
+   */
+  uint8_t *GetMutablePtr(PageOffset nOffset = 0) {
+    assert(nOffset <= PAGE_SIZE);
+    _bDirty = true;
+    return _pData + nOffset;
+  }
+
+  /**
+   * @brief 读出页面内 nOffset 处的定长字段，不要求对齐
+   */
+  template <typename T>
+  T Get(PageOffset nOffset) const {
+    assert(nOffset + sizeof(T) <= PAGE_SIZE);
+    T iValue;
+    memcpy(&iValue, _pData + nOffset, sizeof(T));
+    return iValue;
+  }
+  /**
+   * @brief 写入页面内 nOffset 处的定长字段，不要求对齐
+   */
+  template <typename T>
+  void Set(PageOffset nOffset, const T &iValue) {
+    assert(nOffset + sizeof(T) <= PAGE_SIZE);
+    memcpy(_pData + nOffset, &iValue, sizeof(T));
+    _bDirty = true;
+  }
+
+ private:
+  PageID _nPageID;
+  uint8_t *_pData;
+  bool _bDirty;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_PAGE_GUARD_H_
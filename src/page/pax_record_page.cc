@@ -0,0 +1,74 @@
+#include "page/pax_record_page.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace thdb {
+
+static PageOffset TotalSize(const std::vector<Size> &iSizeVec) {
+  Size nTotal = 0;
+  for (const auto &nSize : iSizeVec) nTotal += nSize;
+  return nTotal;
+}
+
+PaxRecordPage::PaxRecordPage(const std::vector<Size> &iSizeVec, bool,
+                             PageID nHintID)
+    : RecordPage(TotalSize(iSizeVec), true, nHintID) {
+  InitColumns(iSizeVec);
+}
+
+PaxRecordPage::PaxRecordPage(PageID nPageID, const std::vector<Size> &iSizeVec)
+    : RecordPage(nPageID) {
+  assert(TotalSize(iSizeVec) == _nFixed);
+  InitColumns(iSizeVec);
+}
+
+void PaxRecordPage::InitColumns(const std::vector<Size> &iSizeVec) {
+  _iSizeVec = iSizeVec;
+  Size nOffset = 0;
+  for (const auto &nSize : iSizeVec) {
+    _iOffsetVec.push_back(nOffset);
+    nOffset += nSize;
+  }
+}
+
+Size PaxRecordPage::GetColumnSize(FieldID nPos) const {
+  return _iSizeVec[nPos];
+}
+
+void PaxRecordPage::GetColumn(FieldID nPos, uint8_t *dst) const {
+  GetData(dst, _nCap * _iSizeVec[nPos],
+          GetSlotsOffset() + _nCap * _iOffsetVec[nPos]);
+}
+
+void PaxRecordPage::ReadSlots(uint8_t *dst) const {
+  std::vector<uint8_t> iColumn;
+  for (FieldID i = 0; i < _iSizeVec.size(); ++i) {
+    if (_iSizeVec[i] == 0) continue;
+    iColumn.resize(_nCap * _iSizeVec[i]);
+    GetColumn(i, iColumn.data());
+    for (SlotID j = 0; j < _nCap; ++j)
+      memcpy(dst + j * _nFixed + _iOffsetVec[i],
+             iColumn.data() + j * _iSizeVec[i], _iSizeVec[i]);
+  }
+}
+
+void PaxRecordPage::ReadSlot(SlotID nSlotID, uint8_t *dst) const {
+  for (FieldID i = 0; i < _iSizeVec.size(); ++i) {
+    if (_iSizeVec[i] == 0) continue;
+    GetData(dst + _iOffsetVec[i], _iSizeVec[i],
+            GetSlotsOffset() + _nCap * _iOffsetVec[i] +
+                nSlotID * _iSizeVec[i]);
+  }
+}
+
+void PaxRecordPage::WriteSlot(SlotID nSlotID, const uint8_t *src) {
+  for (FieldID i = 0; i < _iSizeVec.size(); ++i) {
+    if (_iSizeVec[i] == 0) continue;
+    SetData(src + _iOffsetVec[i], _iSizeVec[i],
+            GetSlotsOffset() + _nCap * _iOffsetVec[i] +
+                nSlotID * _iSizeVec[i]);
+  }
+}
+
+}  // namespace thdb
@@ -0,0 +1,62 @@
+#ifndef THDB_PAX_RECORD_PAGE_H_
+#define THDB_PAX_RECORD_PAGE_H_
+
+#include "macros.h"
+#include "page/record_page.h"
+
+namespace thdb {
+
+/**
+ * @brief 列存(PAX)定长记录页面。
+ *   槽的分配、位图和容量与 RecordPage 相同，只是数据部分按列划分为小页：
+ * 第 i 列的小页连续存放所有槽中第 i 个字段的值。
+ * 插入和读取整条记录时在行格式和列格式之间转换，只检查部分列时只需要读取对应的小页。
+ * 列的长度不保存在页面中，由表提供。
+ */
+class PaxRecordPage : public RecordPage {
+ public:
+  /**
+   * @brief 构建一个新的列存页面，bool参数只是为了重载
+   * @param iSizeVec 各列的长度
+   * @param nHintID 希望靠近的页面编号，通常为表的尾页面
+   */
+  PaxRecordPage(const std::vector<Size> &iSizeVec, bool,
+                PageID nHintID = NULL_PAGE);
+  /**
+   * @brief 从MiniOS中重新导入一个列存页面
+   * @param nPageID 页面编号
+   * @param iSizeVec 各列的长度
+   */
+  PaxRecordPage(PageID nPageID, const std::vector<Size> &iSizeVec);
+  ~PaxRecordPage() = default;
+
+  /**
+   * @brief 读出一列的小页，包括空槽位置上的内容
+   *
+   * @param nPos 列的位置
+   * @param dst 长度至少为 GetCap() * GetColumnSize(nPos)
+   */
+  void GetColumn(FieldID nPos, uint8_t *dst) const;
+  Size GetColumnSize(FieldID nPos) const;
+  /**
+   * @brief 按列读出所有小页并转置为行格式
+   */
+  void ReadSlots(uint8_t *dst) const override;
+
+ protected:
+  void ReadSlot(SlotID nSlotID, uint8_t *dst) const override;
+  void WriteSlot(SlotID nSlotID, const uint8_t *src) override;
+
+ private:
+  void InitColumns(const std::vector<Size> &iSizeVec);
+
+  std::vector<Size> _iSizeVec;
+  /**
+   * @brief 各列在行格式中的偏移，第 i 列的小页从 GetSlotsOffset() + _nCap * _iOffsetVec[i] 开始
+   */
+  std::vector<Size> _iOffsetVec;
+};
+
+}  // namespace thdb
+
+#endif
@@ -1,10 +1,12 @@
 #include "record_page.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
 #include "exception/exceptions.h"
 #include "macros.h"
+#include "page/page_guard.h"
 
 namespace thdb {
 
@@ -13,40 +15,51 @@ const PageOffset BITMAP_OFFSET = 0;
 const PageOffset BITMAP_SIZE = 128; // bitmap 占 128 * 8 = 1024 bit, 可以表示1024个slot
 // BITMAP_SIZE 之后才是 _nCap 个 _nFixed 大小的 slot
 
+// 页面能容纳的记录数量，很窄的记录也不能超过位图能表示的 slot 数
+static Size SlotCap(PageOffset nFixed) {
+  return std::min<Size>((DATA_SIZE - BITMAP_SIZE) / nFixed, BITMAP_SIZE * 8);
+}
+
 // 先调用父类 LinkedPage 构造函数，向页面header写入链表中 下一个 和 上一个
 // 的PageID。然后向header中写入_nFixed数据，表示 表示支持的定长记录长度
 // bool参数只是为了重载
-RecordPage::RecordPage(PageOffset nFixed, bool) : LinkedPage() {
+RecordPage::RecordPage(PageOffset nFixed, bool, PageID nHintID)
+    : LinkedPage(nHintID, true) {
   _nFixed = nFixed;
-  _pUsed = new Bitmap((DATA_SIZE - BITMAP_SIZE) / nFixed);
-  _nCap = (DATA_SIZE - BITMAP_SIZE) / _nFixed;  // 表示页面能容纳的记录数量
+  _nCap = SlotCap(_nFixed);  // 表示页面能容纳的记录数量
+  _pUsed = new Bitmap(_nCap);
   SetHeader((uint8_t *)&_nFixed, 2, FIXED_SIZE_OFFSET);
 }
 
 RecordPage::RecordPage(PageID nPageID) : LinkedPage(nPageID) {
-  GetHeader((uint8_t *)&_nFixed, 2, FIXED_SIZE_OFFSET);
-  _pUsed = new Bitmap((DATA_SIZE - BITMAP_SIZE) / _nFixed);
-  _nCap = (DATA_SIZE - BITMAP_SIZE) / _nFixed; // 注意bitmap不维护其自身的占用状态
+  _nFixed = PageGuard(nPageID).Get<PageOffset>(FIXED_SIZE_OFFSET);
+  _nCap = SlotCap(_nFixed); // 注意bitmap不维护其自身的占用状态
+  _pUsed = new Bitmap(_nCap);
   LoadBitmap();
 }
 
-// 之后会调用父类析构函数，保存header元数据
-RecordPage::~RecordPage() { StoreBitmap(); }
+RecordPage::~RecordPage() {
+  RecordPage::Store();
+  delete _pUsed;
+}
+
+// 位图没有修改时不写回，只读访问不会弄脏页面
+void RecordPage::Store() {
+  if (_pUsed->IsDirty()) StoreBitmap();
+  LinkedPage::Store();
+}
 
 void RecordPage::LoadBitmap() {
-  uint8_t pTemp[BITMAP_SIZE];
-  memset(pTemp, 0, BITMAP_SIZE);
   // Bitmap序列化后的内容，存在Page的data段，data段内偏移为0（也就是起始）
-  GetData(pTemp, BITMAP_SIZE, BITMAP_OFFSET);
-  _pUsed->Load(pTemp); // 反序列化
+  PageGuard iGuard(_nPageID);
+  _pUsed->Load(iGuard.GetPtr(HEADER_SIZE + BITMAP_OFFSET)); // 直接从页面反序列化
 }
 
 void RecordPage::StoreBitmap() {
-  uint8_t pTemp[BITMAP_SIZE];
-  memset(pTemp, 0, BITMAP_SIZE);
-  _pUsed->Store(pTemp);  // 序列化到uint8_t*
-  SetData(pTemp, BITMAP_SIZE, BITMAP_OFFSET); // 写入页面的data段
-  delete _pUsed;
+  PageGuard iGuard(_nPageID);
+  uint8_t *pDst = iGuard.GetMutablePtr(HEADER_SIZE + BITMAP_OFFSET);
+  memset(pDst, 0, BITMAP_SIZE);
+  _pUsed->Store(pDst);  // 直接序列化到页面的data段
 }
 
 // 表示页面能容纳的记录数量
@@ -59,8 +72,12 @@ bool RecordPage::Full() const { return _pUsed->Full(); }
 PageOffset RecordPage::GetFixedSize() const { return _nFixed; }
 
 void RecordPage::Clear() {
-  for (SlotID i = 0; i < _nCap; ++i)
-    if (HasRecord(i)) DeleteRecord(i);
+  for (SlotID i = NextRecord(0); i < _nCap; i = NextRecord(i + 1))
+    DeleteRecord(i);
+}
+
+SlotID RecordPage::NextRecord(SlotID nSlotID) const {
+  return _pUsed->NextSet(nSlotID);
 }
 
 SlotID RecordPage::InsertRecord(const uint8_t *src) {
@@ -69,19 +86,12 @@ SlotID RecordPage::InsertRecord(const uint8_t *src) {
   // TIPS: 合理抛出异常的方式可以帮助DEBUG工作
   // TIPS: 利用_pUsed位图判断槽位是否使用，插入后需要更新_pUsed
   // TIPS: 使用SetData实现写数据
-  // 寻找空的槽位
-  SlotID nSlotID = -1;
-  for (SlotID i = 0; i < _nCap; ++i) {
-    if (!HasRecord(i)) {
-      nSlotID = i;
-      break;
-    }
-  }
+  // 寻找空的槽位，按64位字跳过已满的部分
+  SlotID nSlotID = _pUsed->NextClear(0);
+  if (nSlotID >= _nCap) return NULL_SLOT;
   // 找到了一个空槽位
-  if (nSlotID < _nCap) {
-    SetData(src, _nFixed, BITMAP_OFFSET + BITMAP_SIZE + nSlotID * _nFixed);
-    _pUsed->Set(nSlotID);
-  }
+  WriteSlot(nSlotID, src);
+  _pUsed->Set(nSlotID);
   return nSlotID;
   // LAB1 END
 }
@@ -94,11 +104,16 @@ uint8_t *RecordPage::GetRecord(SlotID nSlotID) {
   // 判断是否已经有page
   if (!_pUsed->Get(nSlotID)) throw RecordPageException(nSlotID);
   uint8_t* dst = new uint8_t[_nFixed];
-  GetData(dst, _nFixed, BITMAP_OFFSET + BITMAP_SIZE + nSlotID * _nFixed);
+  ReadSlot(nSlotID, dst);
   return dst;
   // LAB1 END
 }
 
+void RecordPage::ReadRecord(SlotID nSlotID, uint8_t *dst) const {
+  if (!_pUsed->Get(nSlotID)) throw RecordPageException(nSlotID);
+  ReadSlot(nSlotID, dst);
+}
+
 bool RecordPage::HasRecord(SlotID nSlotID) { return _pUsed->Get(nSlotID); }
 
 void RecordPage::DeleteRecord(SlotID nSlotID) {
@@ -113,7 +128,22 @@ void RecordPage::DeleteRecord(SlotID nSlotID) {
 
 void RecordPage::UpdateRecord(SlotID nSlotID, const uint8_t *src) {
   if (!_pUsed->Get(nSlotID)) throw RecordPageException(nSlotID);
-  SetData(src, _nFixed, BITMAP_OFFSET + BITMAP_SIZE + nSlotID * _nFixed);
+  WriteSlot(nSlotID, src);
 }
 
+// 行存格式，槽中连续存放一条记录
+void RecordPage::ReadSlots(uint8_t *dst) const {
+  GetData(dst, _nCap * _nFixed, GetSlotsOffset());
+}
+
+void RecordPage::ReadSlot(SlotID nSlotID, uint8_t *dst) const {
+  GetData(dst, _nFixed, GetSlotsOffset() + nSlotID * _nFixed);
+}
+
+void RecordPage::WriteSlot(SlotID nSlotID, const uint8_t *src) {
+  SetData(src, _nFixed, GetSlotsOffset() + nSlotID * _nFixed);
+}
+
+PageOffset RecordPage::GetSlotsOffset() { return BITMAP_OFFSET + BITMAP_SIZE; }
+
 }  // namespace thdb
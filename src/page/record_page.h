@@ -1,6 +1,7 @@
 #ifndef THDB_RECORD_PAGE_H_
 #define THDB_RECORD_PAGE_H_
 
+#include "macros.h"
 #include "page/linked_page.h"
 #include "utils/bitmap.h"
 
@@ -9,15 +10,16 @@ namespace thdb {
 /**
  * @brief 定长记录页面。
  *   一个slot中存放一个序列化的Record, 用Bitmap维护占用情况。插入使用 最先匹配
- *
+ *   位图只在被修改过时写回页面
  */
 class RecordPage : public LinkedPage {
  public:
   /**
    * @brief 构建一个新的定长记录页面
    * @param nFixed 定长记录长度
+   * @param nHintID 希望靠近的页面编号，通常为表的尾页面
    */
-  RecordPage(PageOffset nFixed, bool);
+  RecordPage(PageOffset nFixed, bool, PageID nHintID = NULL_PAGE);
   /**
    * @brief 从MiniOS中重新导入一个定长记录页面
    * @param nPageID 页面编号
@@ -25,11 +27,16 @@ class RecordPage : public LinkedPage {
   RecordPage(PageID nPageID);
   ~RecordPage();
 
+  /**
+   * @brief 立即写回修改过的位图和链表元数据，对象可以继续使用
+   */
+  void Store() override;
+
   /**
    * @brief 插入一条定长记录
    *
    * @param src 记录定长格式化后的内容
-   * @return SlotID 插入位置的槽编号
+   * @return SlotID 插入位置的槽编号，页面已满时返回 NULL_SLOT
    */
   SlotID InsertRecord(const uint8_t *src);
   /**
@@ -39,6 +46,20 @@ class RecordPage : public LinkedPage {
    * @return uint8_t* 记录定长格式化的内容
    */
   uint8_t *GetRecord(SlotID nSlotID);
+  /**
+   * @brief 把指定位置的记录的内容复制到调用者提供的空间，不分配内存
+   *
+   * @param nSlotID 槽编号
+   * @param dst 长度至少为 GetFixedSize()
+   */
+  void ReadRecord(SlotID nSlotID, uint8_t *dst) const;
+  /**
+   * @brief 一次复制页面中所有槽的定长格式内容，槽 i 从 dst + i * GetFixedSize() 开始，
+   * 空槽的内容没有意义
+   *
+   * @param dst 长度至少为 GetCap() * GetFixedSize()
+   */
+  virtual void ReadSlots(uint8_t *dst) const;
   /**
    * @brief 判断某一个槽是否存在记录
    *
@@ -47,6 +68,13 @@ class RecordPage : public LinkedPage {
    * @return false 不存在记录
    */
   bool HasRecord(SlotID nSlotID);
+  /**
+   * @brief 返回不小于 nSlotID 的第一个存在记录的槽，按位图的64位字跳过空槽
+   *
+   * @param nSlotID 起始槽编号
+   * @return SlotID 槽编号，不存在时返回 GetCap()
+   */
+  SlotID NextRecord(SlotID nSlotID) const;
   /**
    * @brief 删除指定位置的记录
    *
@@ -67,9 +95,19 @@ class RecordPage : public LinkedPage {
   bool Full() const;
   void Clear();
 
- private:
-  void StoreBitmap();
-  void LoadBitmap();
+ protected:
+  /**
+   * @brief 读出一个槽中记录定长格式化的内容，不检查槽是否被占用
+   */
+  virtual void ReadSlot(SlotID nSlotID, uint8_t *dst) const;
+  /**
+   * @brief 写入一个槽中记录定长格式化的内容
+   */
+  virtual void WriteSlot(SlotID nSlotID, const uint8_t *src);
+  /**
+   * @brief 槽在数据部分中的起始位置，位图之后
+   */
+  static PageOffset GetSlotsOffset();
 
   /**
    * @brief 表示支持的定长记录长度
@@ -79,6 +117,11 @@ class RecordPage : public LinkedPage {
    * @brief 表示页面能容纳的记录数量
    */
   Size _nCap;
+
+ private:
+  void StoreBitmap();
+  void LoadBitmap();
+
   /**
    * @brief 表示槽占用状况的位图，最多1024个槽
    */
@@ -0,0 +1,51 @@
+#include "page/record_page_cache.h"
+
+#include "page/pax_record_page.h"
+
+namespace thdb {
+
+RecordPageCache::RecordPageCache(Size nCapacity,
+                                 const std::vector<Size> &iPaxSizeVec)
+    : _nCapacity(nCapacity), _iPaxSizeVec(iPaxSizeVec) {
+  if (_nCapacity == 0) _nCapacity = 1;
+}
+
+RecordPageCache::~RecordPageCache() { Clear(); }
+
+RecordPage *RecordPageCache::Get(PageID nPageID) {
+  auto it = _iPageMap.find(nPageID);
+  if (it != _iPageMap.end()) {
+    _iPageList.splice(_iPageList.begin(), _iPageList, it->second);
+    return *it->second;
+  }
+  if (_iPageList.size() >= _nCapacity) {
+    RecordPage *pVictim = _iPageList.back();
+    _iPageMap.erase(pVictim->GetPageID());
+    _iPageList.pop_back();
+    delete pVictim;
+  }
+  RecordPage *pPage = nullptr;
+  if (_iPaxSizeVec.empty())
+    pPage = new RecordPage(nPageID);
+  else
+    pPage = new PaxRecordPage(nPageID, _iPaxSizeVec);
+  _iPageList.push_front(pPage);
+  _iPageMap[nPageID] = _iPageList.begin();
+  return pPage;
+}
+
+void RecordPageCache::Invalidate(PageID nPageID) {
+  auto it = _iPageMap.find(nPageID);
+  if (it == _iPageMap.end()) return;
+  delete *it->second;
+  _iPageList.erase(it->second);
+  _iPageMap.erase(it);
+}
+
+void RecordPageCache::Clear() {
+  for (const auto &pPage : _iPageList) delete pPage;
+  _iPageList.clear();
+  _iPageMap.clear();
+}
+
+}  // namespace thdb
@@ -0,0 +1,57 @@
+#ifndef THDB_RECORD_PAGE_CACHE_H_
+#define THDB_RECORD_PAGE_CACHE_H_
+
+#include <list>
+#include <unordered_map>
+
+#include "defines.h"
+#include "page/record_page.h"
+
+namespace thdb {
+
+/**
+ * @brief 已解析的定长记录页面缓存。
+ * 按页面编号缓存 RecordPage 对象，其中保存了槽位图、定长记录长度、容量和链表指针，
+ * 命中时不需要重新解析页面头和位图。容量固定，超出时淘汰最久未使用的页面。
+ * 缓存中的对象与页面内容保持一致：通过缓存修改页面后需要立即调用 RecordPage::Store，
+ * 不经过缓存修改页面元数据前需要先调用 Invalidate。
+ */
+class RecordPageCache {
+ public:
+  /**
+   * @brief 构建缓存
+   *
+   * @param nCapacity 最多缓存的页面数量
+   * @param iPaxSizeVec 列存表各列的长度，非空时未命中的页面解析为 PaxRecordPage
+   */
+  explicit RecordPageCache(Size nCapacity,
+                           const std::vector<Size> &iPaxSizeVec = {});
+  ~RecordPageCache();
+
+  /**
+   * @brief 获取页面对应的 RecordPage，未命中时从页面解析
+   *
+   * @return RecordPage* 由缓存管理，下一次 Get 之后可能被淘汰，调用者不能释放
+   */
+  RecordPage *Get(PageID nPageID);
+  /**
+   * @brief 丢弃页面的缓存对象，不存在时忽略
+   */
+  void Invalidate(PageID nPageID);
+  void Clear();
+
+ private:
+  typedef std::list<RecordPage *> PageList;
+
+  Size _nCapacity;
+  std::vector<Size> _iPaxSizeVec;
+  /**
+   * @brief 按最近使用的顺序排列，表头为最近使用的页面
+   */
+  PageList _iPageList;
+  std::unordered_map<PageID, PageList::iterator> _iPageMap;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_RECORD_PAGE_CACHE_H_
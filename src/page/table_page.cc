@@ -3,9 +3,13 @@
 #include <assert.h>
 
 #include <algorithm>
+#include <cstring>
 
 #include "exception/exceptions.h"
+#include "page/page_guard.h"
+#include "page/pax_record_page.h"
 #include "page/record_page.h"
+#include "page/var_record_page.h"
 
 namespace thdb {
 
@@ -13,6 +17,12 @@ const PageOffset COLUMN_LEN_OFFSET = 16;
 const PageOffset COLUMN_NAME_LEN_OFFSET = 20;
 const PageOffset HEAD_PAGE_OFFSET = 24;
 const PageOffset TAIL_PAGE_OFFSET = 28;
+// 早期版本没有写入记录格式，读出0表示定长格式
+const PageOffset RECORD_FORMAT_OFFSET = 32;
+// 早期版本的定长记录没有空值位图，读出0表示没有
+const PageOffset NULL_BITMAP_OFFSET = 33;
+// 早期版本没有空闲空间映射，读出0表示需要重新建立
+const PageOffset FREE_MAP_OFFSET = 36;
 
 const PageOffset COLUMN_TYPE_OFFSET = 0;
 const PageOffset COLUMN_SIZE_OFFSET = 64;
@@ -27,8 +37,18 @@ TablePage::TablePage(const Schema &iSchema) : Page() {
     _iSizeVec.push_back(iCol.GetSize());
   }
   assert(_iColMap.size() == _iTypeVec.size());
-  RecordPage *pPage = new RecordPage(GetTotalSize(), true);
+  _iFormat = iSchema.GetFormat();
+  // 变长表的记录自带空值位图，这里的位图用于转换成的定长格式
+  _bNullBitmap = true;
+  LinkedPage *pPage = nullptr;
+  if (_iFormat == RecordFormat::VAR_FORMAT)
+    pPage = new VarRecordPage(_nPageID, true);
+  else if (_iFormat == RecordFormat::PAX_FORMAT)
+    pPage = new PaxRecordPage(GetSlotSizeVec(), true, _nPageID);
+  else
+    pPage = new RecordPage(GetTotalSize(), true, _nPageID);
   _nHeadID = _nTailID = pPage->GetPageID();
+  _nFreeMapID = NULL_PAGE;
   delete pPage; // 向OS写回元数据信息
   _bModified = true;
 }
@@ -54,12 +74,23 @@ std::vector<FieldType> TablePage::GetTypeVec() const { return _iTypeVec; }
 
 std::vector<Size> TablePage::GetSizeVec() const { return _iSizeVec; }
 
+bool TablePage::HasNullBitmap() const { return _bNullBitmap; }
+
+std::vector<Size> TablePage::GetSlotSizeVec() const {
+  if (!_bNullBitmap) return _iSizeVec;
+  std::vector<Size> iSlotSizeVec(1, (_iSizeVec.size() + 7) / 8);
+  iSlotSizeVec.insert(iSlotSizeVec.end(), _iSizeVec.begin(), _iSizeVec.end());
+  return iSlotSizeVec;
+}
+
 Size TablePage::GetTotalSize() const {
-  Size nTotal = 0;
+  Size nTotal = _bNullBitmap ? (_iSizeVec.size() + 7) / 8 : 0;
   for (const auto &nSize : _iSizeVec) nTotal += nSize;
   return nTotal;
 }
 
+RecordFormat TablePage::GetFormat() const { return _iFormat; }
+
 PageID TablePage::GetHeadID() const { return _nHeadID; }
 
 PageID TablePage::GetTailID() const { return _nTailID; }
@@ -74,6 +105,13 @@ void TablePage::SetTailID(PageID nTailID) {
   _bModified = true;
 }
 
+PageID TablePage::GetFreeMapID() const { return _nFreeMapID; }
+
+void TablePage::SetFreeMapID(PageID nFreeMapID) {
+  _nFreeMapID = nFreeMapID;
+  _bModified = true;
+}
+
 bool CmpByValue(const std::pair<String, FieldID> &a,
                 const std::pair<String, FieldID> &b) {
   return a.second < b.second;
@@ -108,48 +146,53 @@ std::map<String, FieldID> LoadColumnsString(const String &sName) {
   return iColMap;
 }
 
+// 固定页面后原地读写各字段，不再逐字段调用 SetHeader/SetData
 void TablePage::Store() {
-  SetHeader((uint8_t *)&_nHeadID, 4, HEAD_PAGE_OFFSET);
-  SetHeader((uint8_t *)&_nTailID, 4, TAIL_PAGE_OFFSET);
-  FieldID iFieldSize = _iSizeVec.size();
-  SetHeader((uint8_t *)&iFieldSize, 4, COLUMN_LEN_OFFSET);
-  for (Size i = 0; i < iFieldSize; ++i) {
-    int nType = (int)_iTypeVec[i];
-    SetData((uint8_t *)&nType, 1, COLUMN_TYPE_OFFSET + i);
-  }
-  for (Size i = 0; i < iFieldSize; ++i) {
-    Size nSize = _iSizeVec[i];
-    SetData((uint8_t *)&nSize, 2, COLUMN_SIZE_OFFSET + 2 * i);
-  }
+  PageGuard iGuard(_nPageID);
+  iGuard.Set<PageID>(HEAD_PAGE_OFFSET, _nHeadID);
+  iGuard.Set<PageID>(TAIL_PAGE_OFFSET, _nTailID);
+  iGuard.Set<uint8_t>(RECORD_FORMAT_OFFSET, (uint8_t)_iFormat);
+  iGuard.Set<uint8_t>(NULL_BITMAP_OFFSET, _bNullBitmap ? 1 : 0);
+  iGuard.Set<PageID>(FREE_MAP_OFFSET,
+                     _nFreeMapID == NULL_PAGE ? 0 : _nFreeMapID);
+  Size iFieldSize = _iSizeVec.size();
+  iGuard.Set<Size>(COLUMN_LEN_OFFSET, iFieldSize);
+  for (Size i = 0; i < iFieldSize; ++i)
+    iGuard.Set<uint8_t>(HEADER_SIZE + COLUMN_TYPE_OFFSET + i,
+                        (uint8_t)_iTypeVec[i]);
+  for (Size i = 0; i < iFieldSize; ++i)
+    iGuard.Set<uint16_t>(HEADER_SIZE + COLUMN_SIZE_OFFSET + 2 * i,
+                         (uint16_t)_iSizeVec[i]);
   String sColumnsName = BuildColumnsString(_iColMap);
   Size sColNameLen = sColumnsName.size();
-  SetHeader((uint8_t *)&sColNameLen, 4, COLUMN_NAME_LEN_OFFSET);
-  SetData((uint8_t *)sColumnsName.c_str(), sColNameLen, COLUMN_NAME_OFFSET);
+  iGuard.Set<Size>(COLUMN_NAME_LEN_OFFSET, sColNameLen);
+  memcpy(iGuard.GetMutablePtr(HEADER_SIZE + COLUMN_NAME_OFFSET),
+         sColumnsName.c_str(), sColNameLen);
 }
 
 void TablePage::Load() {
-  GetHeader((uint8_t *)&_nHeadID, 4, HEAD_PAGE_OFFSET);
-  GetHeader((uint8_t *)&_nTailID, 4, TAIL_PAGE_OFFSET);
-  FieldID iFieldSize = 0;
-  GetHeader((uint8_t *)&iFieldSize, 4, COLUMN_LEN_OFFSET);
-  for (Size i = 0; i < iFieldSize; ++i) {
-    int nType = 0;
-    GetData((uint8_t *)&nType, 1, COLUMN_TYPE_OFFSET + i);
-    _iTypeVec.push_back(FieldType(nType));
-  }
-  for (Size i = 0; i < iFieldSize; ++i) {
-    Size nSize = 0;
-    GetData((uint8_t *)&nSize, 2, COLUMN_SIZE_OFFSET + 2 * i);
-    _iSizeVec.push_back(nSize);
-  }
-  Size sColNameLen = 0;
-  GetHeader((uint8_t *)&sColNameLen, 4, COLUMN_NAME_LEN_OFFSET);
-  char *pTemp = new char[sColNameLen + 1];
-  pTemp[sColNameLen] = '\0';
-  GetData((uint8_t *)pTemp, sColNameLen, COLUMN_NAME_OFFSET);
-  String sName{pTemp};
+  PageGuard iGuard(_nPageID);
+  _nHeadID = iGuard.Get<PageID>(HEAD_PAGE_OFFSET);
+  _nTailID = iGuard.Get<PageID>(TAIL_PAGE_OFFSET);
+  _iFormat = RecordFormat(iGuard.Get<uint8_t>(RECORD_FORMAT_OFFSET));
+  _bNullBitmap = iGuard.Get<uint8_t>(NULL_BITMAP_OFFSET) != 0;
+  _nFreeMapID = iGuard.Get<PageID>(FREE_MAP_OFFSET);
+  if (_nFreeMapID == 0) _nFreeMapID = NULL_PAGE;
+  // 早期版本只写入了低2字节
+  Size iFieldSize = iGuard.Get<FieldID>(COLUMN_LEN_OFFSET);
+  for (Size i = 0; i < iFieldSize; ++i)
+    _iTypeVec.push_back(
+        FieldType(iGuard.Get<uint8_t>(HEADER_SIZE + COLUMN_TYPE_OFFSET + i)));
+  for (Size i = 0; i < iFieldSize; ++i)
+    _iSizeVec.push_back(
+        iGuard.Get<uint16_t>(HEADER_SIZE + COLUMN_SIZE_OFFSET + 2 * i));
+  Size sColNameLen = iGuard.Get<Size>(COLUMN_NAME_LEN_OFFSET);
+  if (HEADER_SIZE + COLUMN_NAME_OFFSET + sColNameLen > PAGE_SIZE)
+    throw PageOutOfSizeException();
+  String sName(
+      (const char *)iGuard.GetPtr(HEADER_SIZE + COLUMN_NAME_OFFSET),
+      sColNameLen);
   _iColMap = LoadColumnsString(sName);
-  delete[] pTemp;
 }
 
 FieldID TablePage::GetPos(const String &sCol) { return _iColMap[sCol]; }
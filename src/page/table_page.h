@@ -21,12 +21,29 @@ class TablePage : public Page {
   FieldID GetFieldID(const String &sColName) const;
   std::vector<FieldType> GetTypeVec() const;
   std::vector<Size> GetSizeVec() const;
+  /**
+   * @brief 定长格式的记录是否以空值位图开头
+   */
+  bool HasNullBitmap() const;
+  /**
+   * @brief 列存页面中各个小页的单元长度，有空值位图时位图是第一个小页
+   */
+  std::vector<Size> GetSlotSizeVec() const;
+  /**
+   * @brief 定长格式的记录长度，包括空值位图
+   */
   Size GetTotalSize() const;
+  RecordFormat GetFormat() const;
 
   PageID GetHeadID() const;
   PageID GetTailID() const;
   void SetHeadID(PageID nHeadID);
   void SetTailID(PageID nTailID);
+  /**
+   * @brief 空闲空间映射的第一个页面，不存在时返回 NULL_PAGE
+   */
+  PageID GetFreeMapID() const;
+  void SetFreeMapID(PageID nFreeMapID);
 
   FieldID GetPos(const String &sCol);
   FieldType GetType(const String &sCol);
@@ -39,7 +56,10 @@ class TablePage : public Page {
   std::map<String, FieldID> _iColMap;
   std::vector<FieldType> _iTypeVec;
   std::vector<Size> _iSizeVec;
+  RecordFormat _iFormat;
+  bool _bNullBitmap;
   PageID _nHeadID, _nTailID;
+  PageID _nFreeMapID;
   bool _bModified = false;
 
   friend class Table;
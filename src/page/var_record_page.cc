@@ -0,0 +1,184 @@
+#include "page/var_record_page.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+#include "page/page_guard.h"
+
+namespace thdb {
+
+const PageOffset SLOT_NUM_OFFSET = 12;
+const PageOffset FREE_OFFSET = 14;
+const PageOffset LIVE_SIZE_OFFSET = 16;
+const PageOffset RECORD_NUM_OFFSET = 18;
+// 槽目录项为 (偏移, 长度)，偏移为0表示空槽，记录内容不会从数据段起始位置开始
+const PageOffset SLOT_SIZE = 4;
+
+// NOTE: 本构造对象 会 向OS请求新的页面
+VarRecordPage::VarRecordPage(PageID nHintID, bool)
+    : LinkedPage(nHintID, true), _nFree(DATA_SIZE), _nLive(0), _nRecords(0) {}
+
+// NOTE: 本构造对象 并不会 向OS请求新的页面
+VarRecordPage::VarRecordPage(PageID nPageID) : LinkedPage(nPageID) {
+  PageGuard iGuard(nPageID);
+  SlotID nSlots = iGuard.Get<SlotID>(SLOT_NUM_OFFSET);
+  _nFree = iGuard.Get<PageOffset>(FREE_OFFSET);
+  _nLive = iGuard.Get<PageOffset>(LIVE_SIZE_OFFSET);
+  _nRecords = iGuard.Get<SlotID>(RECORD_NUM_OFFSET);
+  if (nSlots * SLOT_SIZE > _nFree || _nFree > DATA_SIZE)
+    throw PageOutOfSizeException();
+  _iSlotVec.resize(nSlots);
+  if (nSlots > 0)
+    memcpy(_iSlotVec.data(), iGuard.GetPtr(HEADER_SIZE), nSlots * SLOT_SIZE);
+}
+
+VarRecordPage::~VarRecordPage() { VarRecordPage::Store(); }
+
+void VarRecordPage::Store() {
+  if (!_bModified) return;
+  PageGuard iGuard(_nPageID);
+  iGuard.Set<SlotID>(SLOT_NUM_OFFSET, _iSlotVec.size());
+  iGuard.Set<PageOffset>(FREE_OFFSET, _nFree);
+  iGuard.Set<PageOffset>(LIVE_SIZE_OFFSET, _nLive);
+  iGuard.Set<SlotID>(RECORD_NUM_OFFSET, _nRecords);
+  if (!_iSlotVec.empty())
+    memcpy(iGuard.GetMutablePtr(HEADER_SIZE), _iSlotVec.data(),
+           _iSlotVec.size() * SLOT_SIZE);
+  LinkedPage::Store();
+}
+
+Size VarRecordPage::GetSlots() const { return _iSlotVec.size(); }
+
+Size VarRecordPage::GetUsed() const { return _nRecords; }
+
+Size VarRecordPage::GetFreeSize() const {
+  return DATA_SIZE - _iSlotVec.size() * SLOT_SIZE - _nLive;
+}
+
+// 没有空槽时还需要为新的槽目录项留出空间
+bool VarRecordPage::CanInsert(PageOffset nSize) const {
+  Size nNeed = nSize + (_nRecords < _iSlotVec.size() ? 0 : SLOT_SIZE);
+  return GetFreeSize() >= nNeed;
+}
+
+Size VarRecordPage::GetInsertSize() const {
+  Size nFree = GetFreeSize();
+  if (_nRecords < _iSlotVec.size()) return nFree;
+  return nFree > SLOT_SIZE ? nFree - SLOT_SIZE : 0;
+}
+
+Size VarRecordPage::GetMaxRecordSize() { return DATA_SIZE - SLOT_SIZE; }
+
+void VarRecordPage::Clear() {
+  for (SlotID i = 0; i < _iSlotVec.size(); ++i)
+    if (HasRecord(i)) DeleteRecord(i);
+}
+
+SlotID VarRecordPage::InsertRecord(const uint8_t *src, PageOffset nSize) {
+  if (!CanInsert(nSize)) return NULL_SLOT;
+  SlotID nSlotID = _iSlotVec.size();
+  if (_nRecords < _iSlotVec.size())
+    for (SlotID i = 0; i < _iSlotVec.size(); ++i)
+      if (!HasRecord(i)) {
+        nSlotID = i;
+        break;
+      }
+  PageGuard iGuard(_nPageID);
+  Size nNeed = nSize + (nSlotID == _iSlotVec.size() ? SLOT_SIZE : 0);
+  if (_nFree - _iSlotVec.size() * SLOT_SIZE < nNeed) Compact(iGuard);
+  if (nSlotID == _iSlotVec.size()) _iSlotVec.push_back({0, 0});
+  _nFree -= nSize;
+  memcpy(iGuard.GetMutablePtr(HEADER_SIZE + _nFree), src, nSize);
+  _iSlotVec[nSlotID] = {_nFree, nSize};
+  _nLive += nSize;
+  ++_nRecords;
+  _bModified = true;
+  return nSlotID;
+}
+
+uint8_t *VarRecordPage::GetRecord(SlotID nSlotID) {
+  if (!HasRecord(nSlotID)) throw RecordPageException(nSlotID);
+  const Slot &iSlot = _iSlotVec[nSlotID];
+  uint8_t *dst = new uint8_t[iSlot.nLength];
+  GetData(dst, iSlot.nLength, iSlot.nOffset);
+  return dst;
+}
+
+PageOffset VarRecordPage::GetRecordSize(SlotID nSlotID) const {
+  if (!HasRecord(nSlotID)) throw RecordPageException(nSlotID);
+  return _iSlotVec[nSlotID].nLength;
+}
+
+bool VarRecordPage::HasRecord(SlotID nSlotID) const {
+  return nSlotID < _iSlotVec.size() && _iSlotVec[nSlotID].nOffset != 0;
+}
+
+void VarRecordPage::DeleteRecord(SlotID nSlotID) {
+  if (!HasRecord(nSlotID)) throw RecordPageException(nSlotID);
+  Slot &iSlot = _iSlotVec[nSlotID];
+  // 最前面的记录被删除时直接移动空闲空间指针，其余情况留下空洞
+  if (iSlot.nOffset == _nFree) _nFree += iSlot.nLength;
+  _nLive -= iSlot.nLength;
+  --_nRecords;
+  iSlot = {0, 0};
+  // 末尾的空槽不再占用目录空间
+  while (!_iSlotVec.empty() && _iSlotVec.back().nOffset == 0)
+    _iSlotVec.pop_back();
+  _bModified = true;
+}
+
+bool VarRecordPage::UpdateRecord(SlotID nSlotID, const uint8_t *src,
+                                 PageOffset nSize) {
+  if (!HasRecord(nSlotID)) throw RecordPageException(nSlotID);
+  Slot &iSlot = _iSlotVec[nSlotID];
+  PageGuard iGuard(_nPageID);
+  if (nSize <= iSlot.nLength) {
+    memcpy(iGuard.GetMutablePtr(HEADER_SIZE + iSlot.nOffset), src, nSize);
+    _nLive -= iSlot.nLength - nSize;
+    iSlot.nLength = nSize;
+    _bModified = true;
+    return true;
+  }
+  if (GetFreeSize() + iSlot.nLength < nSize) return false;
+  // 先释放原来的空间，整理时不会移动这条记录
+  if (iSlot.nOffset == _nFree) _nFree += iSlot.nLength;
+  _nLive -= iSlot.nLength;
+  iSlot = {0, 0};
+  if (_nFree - _iSlotVec.size() * SLOT_SIZE < nSize) Compact(iGuard);
+  _nFree -= nSize;
+  memcpy(iGuard.GetMutablePtr(HEADER_SIZE + _nFree), src, nSize);
+  _iSlotVec[nSlotID] = {_nFree, nSize};
+  _nLive += nSize;
+  _bModified = true;
+  return true;
+}
+
+void VarRecordPage::Compact() {
+  PageGuard iGuard(_nPageID);
+  Compact(iGuard);
+}
+
+// 按偏移从大到小依次移动到数据段末尾，目标位置不会覆盖尚未移动的记录
+void VarRecordPage::Compact(PageGuard &iGuard) {
+  std::vector<SlotID> iOrderVec;
+  for (SlotID i = 0; i < _iSlotVec.size(); ++i)
+    if (HasRecord(i)) iOrderVec.push_back(i);
+  std::sort(iOrderVec.begin(), iOrderVec.end(), [&](SlotID a, SlotID b) {
+    return _iSlotVec[a].nOffset > _iSlotVec[b].nOffset;
+  });
+  uint8_t *pData = iGuard.GetMutablePtr(HEADER_SIZE);
+  PageOffset nCursor = DATA_SIZE;
+  for (const auto &nSlotID : iOrderVec) {
+    Slot &iSlot = _iSlotVec[nSlotID];
+    nCursor -= iSlot.nLength;
+    if (nCursor != iSlot.nOffset)
+      memmove(pData + nCursor, pData + iSlot.nOffset, iSlot.nLength);
+    iSlot.nOffset = nCursor;
+  }
+  _nFree = nCursor;
+  _bModified = true;
+}
+
+}  // namespace thdb
@@ -0,0 +1,133 @@
+#ifndef THDB_VAR_RECORD_PAGE_H_
+#define THDB_VAR_RECORD_PAGE_H_
+
+#include "macros.h"
+#include "page/linked_page.h"
+
+namespace thdb {
+
+class PageGuard;
+
+/**
+ * @brief 变长记录页面。
+ *   数据段开头是槽目录，每个槽记录一条记录在数据段中的偏移和长度；
+ * 记录内容从数据段末尾向前存放，空闲空间指针指向最前面一条记录的起始位置。
+ * 删除或缩短记录留下的空洞在剩余连续空间不足时通过页内整理回收，
+ * 整理只移动记录内容，槽编号保持不变。
+ */
+class VarRecordPage : public LinkedPage {
+ public:
+  /**
+   * @brief 构建一个新的变长记录页面，bool参数只是为了重载
+   * @param nHintID 希望靠近的页面编号，通常为表的尾页面
+   */
+  VarRecordPage(PageID nHintID, bool);
+  /**
+   * @brief 从MiniOS中重新导入一个变长记录页面
+   * @param nPageID 页面编号
+   */
+  VarRecordPage(PageID nPageID);
+  ~VarRecordPage();
+
+  /**
+   * @brief 写回槽目录和链表元数据
+   */
+  void Store() override;
+
+  /**
+   * @brief 插入一条变长记录，优先复用空槽，连续空间不足时先整理页面
+   *
+   * @param src 记录序列化后的内容
+   * @param nSize 记录长度
+   * @return SlotID 插入位置的槽编号，页面空间不足时返回 NULL_SLOT
+   */
+  SlotID InsertRecord(const uint8_t *src, PageOffset nSize);
+  /**
+   * @brief 获取指定位置的记录的内容
+   *
+   * @param nSlotID 槽编号
+   * @return uint8_t* 记录序列化的内容，长度为 GetRecordSize(nSlotID)
+   */
+  uint8_t *GetRecord(SlotID nSlotID);
+  PageOffset GetRecordSize(SlotID nSlotID) const;
+  /**
+   * @brief 判断某一个槽是否存在记录
+   *
+   * @param nSlotID 槽编号
+   * @return true 存在记录
+   * @return false 不存在记录
+   */
+  bool HasRecord(SlotID nSlotID) const;
+  /**
+   * @brief 删除指定位置的记录
+   *
+   * @param nSlotID 槽编号
+   */
+  void DeleteRecord(SlotID nSlotID);
+  /**
+   * @brief 更新一条记录的内容，槽编号不变
+   *
+   * @param nSlotID 槽编号
+   * @param src 新的记录内容
+   * @param nSize 新的记录长度
+   * @return false 页面空间不足，原记录保持不变
+   */
+  bool UpdateRecord(SlotID nSlotID, const uint8_t *src, PageOffset nSize);
+  /**
+   * @brief 页内整理，将所有记录移动到数据段末尾，回收中间的空洞
+   */
+  void Compact();
+
+  /**
+   * @brief 槽目录的长度，槽编号均小于该值
+   */
+  Size GetSlots() const;
+  Size GetUsed() const;
+  /**
+   * @brief 整理后可用于记录内容的空间，不包括新增槽需要的目录空间
+   */
+  Size GetFreeSize() const;
+  /**
+   * @brief 判断能否插入一条长度为 nSize 的记录
+   */
+  bool CanInsert(PageOffset nSize) const;
+  /**
+   * @brief 当前能插入的最长记录，已经扣除新增槽需要的目录空间
+   */
+  Size GetInsertSize() const;
+  void Clear();
+
+  /**
+   * @brief 空页面能容纳的最长记录
+   */
+  static Size GetMaxRecordSize();
+
+ private:
+  struct Slot {
+    PageOffset nOffset;
+    PageOffset nLength;
+  };
+
+  void Compact(PageGuard &iGuard);
+
+  /**
+   * @brief 槽目录，构造时从页面导入，析构时写回
+   */
+  std::vector<Slot> _iSlotVec;
+  /**
+   * @brief 空闲空间指针，记录内容占用 [_nFree, DATA_SIZE)
+   */
+  PageOffset _nFree;
+  /**
+   * @brief 有效记录的总长度，不包括空洞
+   */
+  PageOffset _nLive;
+  /**
+   * @brief 有效记录数量
+   */
+  Size _nRecords;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_VAR_RECORD_PAGE_H_
@@ -39,12 +39,14 @@ db_statement
     ;
 
 table_statement
-    : 'CREATE' 'TABLE' Identifier '(' field_list ')'                    # create_table
+    : 'CREATE' 'TABLE' Identifier '(' field_list ')' table_layout?      # create_table
     | 'DROP' 'TABLE' Identifier                                         # drop_table
     | 'DESC' Identifier                                                 # describe_table
     | 'INSERT' 'INTO' Identifier 'VALUES' value_lists                   # insert_into_table
     | 'DELETE' 'FROM' Identifier 'WHERE' where_and_clause               # delete_from_table
     | 'UPDATE' Identifier 'SET' set_clause 'WHERE' where_and_clause     # update_table
+    | 'COPY' Identifier 'FROM' String ('DELIMITER' String)?             # copy_from_table
+    | 'VACUUM' Identifier                                               # vacuum_table
     | select_table                                                      # select_table_
     ;
 
@@ -69,6 +71,13 @@ type_
     : 'INT'
     | 'VARCHAR' '(' Integer ')'
     | 'FLOAT'
+    | 'TINYINT'
+    | 'SMALLINT'
+    | 'BIGINT'
+    ;
+
+table_layout
+    : 'WITH' 'LAYOUT' EqualOrAssign Identifier
     ;
 
 value_lists
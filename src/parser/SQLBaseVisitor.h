@@ -55,6 +55,14 @@ public:
     return visitChildren(ctx);
   }
 
+  virtual antlrcpp::Any visitCopy_from_table(SQLParser::Copy_from_tableContext *ctx) override {
+    return visitChildren(ctx);
+  }
+
+  virtual antlrcpp::Any visitVacuum_table(SQLParser::Vacuum_tableContext *ctx) override {
+    return visitChildren(ctx);
+  }
+
   virtual antlrcpp::Any visitSelect_table_(SQLParser::Select_table_Context *ctx) override {
     return visitChildren(ctx);
   }
@@ -83,6 +91,10 @@ public:
     return visitChildren(ctx);
   }
 
+  virtual antlrcpp::Any visitTable_layout(SQLParser::Table_layoutContext *ctx) override {
+    return visitChildren(ctx);
+  }
+
   virtual antlrcpp::Any visitValue_lists(SQLParser::Value_listsContext *ctx) override {
     return visitChildren(ctx);
   }
@@ -17,10 +17,11 @@ public:
     T__14 = 15, T__15 = 16, T__16 = 17, T__17 = 18, T__18 = 19, T__19 = 20, 
     T__20 = 21, T__21 = 22, T__22 = 23, T__23 = 24, T__24 = 25, T__25 = 26, 
     T__26 = 27, T__27 = 28, T__28 = 29, T__29 = 30, T__30 = 31, T__31 = 32, 
-    T__32 = 33, EqualOrAssign = 34, Less = 35, LessEqual = 36, Greater = 37, 
-    GreaterEqual = 38, NotEqual = 39, Count = 40, Average = 41, Max = 42, 
-    Min = 43, Sum = 44, Null = 45, Identifier = 46, Integer = 47, String = 48, 
-    Float = 49, Whitespace = 50, Annotation = 51
+    T__32 = 33, T__33 = 34, T__34 = 35, T__35 = 36, T__36 = 37, T__37 = 38, 
+    T__38 = 39, T__39 = 40, T__40 = 41, EqualOrAssign = 42, Less = 43, LessEqual = 44, 
+    Greater = 45, GreaterEqual = 46, NotEqual = 47, Count = 48, Average = 49, 
+    Max = 50, Min = 51, Sum = 52, Null = 53, Identifier = 54, Integer = 55, 
+    String = 56, Float = 57, Whitespace = 58, Annotation = 59
   };
 
   SQLLexer(antlr4::CharStream *input);
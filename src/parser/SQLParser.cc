@@ -71,7 +71,7 @@ SQLParser::ProgramContext* SQLParser::program() {
   });
   try {
     enterOuterAlt(_localctx, 1);
-    setState(47);
+    setState(49);
     _errHandler->sync(this);
     _la = _input->LA(1);
     while ((((_la & ~ 0x3fULL) == 0) &&
@@ -83,16 +83,18 @@ SQLParser::ProgramContext* SQLParser::program() {
       | (1ULL << SQLParser::T__13)
       | (1ULL << SQLParser::T__16)
       | (1ULL << SQLParser::T__18)
-      | (1ULL << SQLParser::T__23)
+      | (1ULL << SQLParser::T__20)
+      | (1ULL << SQLParser::T__21)
+      | (1ULL << SQLParser::T__26)
       | (1ULL << SQLParser::Null)
       | (1ULL << SQLParser::Annotation))) != 0)) {
-      setState(44);
+      setState(46);
       statement();
-      setState(49);
+      setState(51);
       _errHandler->sync(this);
       _la = _input->LA(1);
     }
-    setState(50);
+    setState(52);
     match(SQLParser::EOF);
    
   }
@@ -151,14 +153,14 @@ SQLParser::StatementContext* SQLParser::statement() {
     exitRule();
   });
   try {
-    setState(65);
+    setState(67);
     _errHandler->sync(this);
     switch (_input->LA(1)) {
       case SQLParser::T__1: {
         enterOuterAlt(_localctx, 1);
-        setState(52);
+        setState(54);
         db_statement();
-        setState(53);
+        setState(55);
         match(SQLParser::T__0);
         break;
       }
@@ -169,38 +171,40 @@ SQLParser::StatementContext* SQLParser::statement() {
       case SQLParser::T__10:
       case SQLParser::T__13:
       case SQLParser::T__16:
-      case SQLParser::T__18: {
+      case SQLParser::T__18:
+      case SQLParser::T__20:
+      case SQLParser::T__21: {
         enterOuterAlt(_localctx, 2);
-        setState(55);
+        setState(57);
         table_statement();
-        setState(56);
+        setState(58);
         match(SQLParser::T__0);
         break;
       }
 
-      case SQLParser::T__23: {
+      case SQLParser::T__26: {
         enterOuterAlt(_localctx, 3);
-        setState(58);
+        setState(60);
         index_statement();
-        setState(59);
+        setState(61);
         match(SQLParser::T__0);
         break;
       }
 
       case SQLParser::Annotation: {
         enterOuterAlt(_localctx, 4);
-        setState(61);
+        setState(63);
         match(SQLParser::Annotation);
-        setState(62);
+        setState(64);
         match(SQLParser::T__0);
         break;
       }
 
       case SQLParser::Null: {
         enterOuterAlt(_localctx, 5);
-        setState(63);
+        setState(65);
         match(SQLParser::Null);
-        setState(64);
+        setState(66);
         match(SQLParser::T__0);
         break;
       }
@@ -262,15 +266,15 @@ SQLParser::Db_statementContext* SQLParser::db_statement() {
     exitRule();
   });
   try {
-    setState(71);
+    setState(73);
     _errHandler->sync(this);
     switch (getInterpreter<atn::ParserATNSimulator>()->adaptivePredict(_input, 2, _ctx)) {
     case 1: {
       _localctx = dynamic_cast<Db_statementContext *>(_tracker.createInstance<SQLParser::Show_tablesContext>(_localctx));
       enterOuterAlt(_localctx, 1);
-      setState(67);
+      setState(69);
       match(SQLParser::T__1);
-      setState(68);
+      setState(70);
       match(SQLParser::T__2);
       break;
     }
@@ -278,9 +282,9 @@ SQLParser::Db_statementContext* SQLParser::db_statement() {
     case 2: {
       _localctx = dynamic_cast<Db_statementContext *>(_tracker.createInstance<SQLParser::Show_indexesContext>(_localctx));
       enterOuterAlt(_localctx, 2);
-      setState(69);
+      setState(71);
       match(SQLParser::T__1);
-      setState(70);
+      setState(72);
       match(SQLParser::T__3);
       break;
     }
@@ -312,6 +316,20 @@ void SQLParser::Table_statementContext::copyFrom(Table_statementContext *ctx) {
   ParserRuleContext::copyFrom(ctx);
 }
 
+//----------------- Vacuum_tableContext ------------------------------------------------------------------
+
+tree::TerminalNode* SQLParser::Vacuum_tableContext::Identifier() {
+  return getToken(SQLParser::Identifier, 0);
+}
+
+SQLParser::Vacuum_tableContext::Vacuum_tableContext(Table_statementContext *ctx) { copyFrom(ctx); }
+
+antlrcpp::Any SQLParser::Vacuum_tableContext::accept(tree::ParseTreeVisitor *visitor) {
+  if (auto parserVisitor = dynamic_cast<SQLVisitor*>(visitor))
+    return parserVisitor->visitVacuum_table(this);
+  else
+    return visitor->visitChildren(this);
+}
 //----------------- Delete_from_tableContext ------------------------------------------------------------------
 
 tree::TerminalNode* SQLParser::Delete_from_tableContext::Identifier() {
@@ -358,6 +376,10 @@ SQLParser::Field_listContext* SQLParser::Create_tableContext::field_list() {
   return getRuleContext<SQLParser::Field_listContext>(0);
 }
 
+SQLParser::Table_layoutContext* SQLParser::Create_tableContext::table_layout() {
+  return getRuleContext<SQLParser::Table_layoutContext>(0);
+}
+
 SQLParser::Create_tableContext::Create_tableContext(Table_statementContext *ctx) { copyFrom(ctx); }
 
 antlrcpp::Any SQLParser::Create_tableContext::accept(tree::ParseTreeVisitor *visitor) {
@@ -408,6 +430,28 @@ antlrcpp::Any SQLParser::Drop_tableContext::accept(tree::ParseTreeVisitor *visit
   else
     return visitor->visitChildren(this);
 }
+//----------------- Copy_from_tableContext ------------------------------------------------------------------
+
+tree::TerminalNode* SQLParser::Copy_from_tableContext::Identifier() {
+  return getToken(SQLParser::Identifier, 0);
+}
+
+std::vector<tree::TerminalNode *> SQLParser::Copy_from_tableContext::String() {
+  return getTokens(SQLParser::String);
+}
+
+tree::TerminalNode* SQLParser::Copy_from_tableContext::String(size_t i) {
+  return getToken(SQLParser::String, i);
+}
+
+SQLParser::Copy_from_tableContext::Copy_from_tableContext(Table_statementContext *ctx) { copyFrom(ctx); }
+
+antlrcpp::Any SQLParser::Copy_from_tableContext::accept(tree::ParseTreeVisitor *visitor) {
+  if (auto parserVisitor = dynamic_cast<SQLVisitor*>(visitor))
+    return parserVisitor->visitCopy_from_table(this);
+  else
+    return visitor->visitChildren(this);
+}
 //----------------- Update_tableContext ------------------------------------------------------------------
 
 tree::TerminalNode* SQLParser::Update_tableContext::Identifier() {
@@ -433,40 +477,49 @@ antlrcpp::Any SQLParser::Update_tableContext::accept(tree::ParseTreeVisitor *vis
 SQLParser::Table_statementContext* SQLParser::table_statement() {
   Table_statementContext *_localctx = _tracker.createInstance<Table_statementContext>(_ctx, getState());
   enterRule(_localctx, 6, SQLParser::RuleTable_statement);
+  size_t _la = 0;
 
   auto onExit = finally([=] {
     exitRule();
   });
   try {
-    setState(103);
+    setState(117);
     _errHandler->sync(this);
     switch (_input->LA(1)) {
       case SQLParser::T__4: {
         _localctx = dynamic_cast<Table_statementContext *>(_tracker.createInstance<SQLParser::Create_tableContext>(_localctx));
         enterOuterAlt(_localctx, 1);
-        setState(73);
+        setState(75);
         match(SQLParser::T__4);
-        setState(74);
+        setState(76);
         match(SQLParser::T__5);
-        setState(75);
+        setState(77);
         match(SQLParser::Identifier);
-        setState(76);
+        setState(78);
         match(SQLParser::T__6);
-        setState(77);
+        setState(79);
         field_list();
-        setState(78);
+        setState(80);
         match(SQLParser::T__7);
+        setState(82);
+        _errHandler->sync(this);
+
+        _la = _input->LA(1);
+        if (_la == SQLParser::T__36) {
+          setState(81);
+          table_layout();
+        }
         break;
       }
 
       case SQLParser::T__8: {
         _localctx = dynamic_cast<Table_statementContext *>(_tracker.createInstance<SQLParser::Drop_tableContext>(_localctx));
         enterOuterAlt(_localctx, 2);
-        setState(80);
+        setState(84);
         match(SQLParser::T__8);
-        setState(81);
+        setState(85);
         match(SQLParser::T__5);
-        setState(82);
+        setState(86);
         match(SQLParser::Identifier);
         break;
       }
@@ -474,9 +527,9 @@ SQLParser::Table_statementContext* SQLParser::table_statement() {
       case SQLParser::T__9: {
         _localctx = dynamic_cast<Table_statementContext *>(_tracker.createInstance<SQLParser::Describe_tableContext>(_localctx));
         enterOuterAlt(_localctx, 3);
-        setState(83);
+        setState(87);
         match(SQLParser::T__9);
-        setState(84);
+        setState(88);
         match(SQLParser::Identifier);
         break;
       }
@@ -484,15 +537,15 @@ SQLParser::Table_statementContext* SQLParser::table_statement() {
       case SQLParser::T__10: {
         _localctx = dynamic_cast<Table_statementContext *>(_tracker.createInstance<SQLParser::Insert_into_tableContext>(_localctx));
         enterOuterAlt(_localctx, 4);
-        setState(85);
+        setState(89);
         match(SQLParser::T__10);
-        setState(86);
+        setState(90);
         match(SQLParser::T__11);
-        setState(87);
+        setState(91);
         match(SQLParser::Identifier);
-        setState(88);
+        setState(92);
         match(SQLParser::T__12);
-        setState(89);
+        setState(93);
         value_lists();
         break;
       }
@@ -500,15 +553,15 @@ SQLParser::Table_statementContext* SQLParser::table_statement() {
       case SQLParser::T__13: {
         _localctx = dynamic_cast<Table_statementContext *>(_tracker.createInstance<SQLParser::Delete_from_tableContext>(_localctx));
         enterOuterAlt(_localctx, 5);
-        setState(90);
+        setState(94);
         match(SQLParser::T__13);
-        setState(91);
+        setState(95);
         match(SQLParser::T__14);
-        setState(92);
+        setState(96);
         match(SQLParser::Identifier);
-        setState(93);
+        setState(97);
         match(SQLParser::T__15);
-        setState(94);
+        setState(98);
         where_and_clause();
         break;
       }
@@ -516,25 +569,59 @@ SQLParser::Table_statementContext* SQLParser::table_statement() {
       case SQLParser::T__16: {
         _localctx = dynamic_cast<Table_statementContext *>(_tracker.createInstance<SQLParser::Update_tableContext>(_localctx));
         enterOuterAlt(_localctx, 6);
-        setState(95);
+        setState(99);
         match(SQLParser::T__16);
-        setState(96);
+        setState(100);
         match(SQLParser::Identifier);
-        setState(97);
+        setState(101);
         match(SQLParser::T__17);
-        setState(98);
+        setState(102);
         set_clause();
-        setState(99);
+        setState(103);
         match(SQLParser::T__15);
-        setState(100);
+        setState(104);
         where_and_clause();
         break;
       }
 
       case SQLParser::T__18: {
-        _localctx = dynamic_cast<Table_statementContext *>(_tracker.createInstance<SQLParser::Select_table_Context>(_localctx));
+        _localctx = dynamic_cast<Table_statementContext *>(_tracker.createInstance<SQLParser::Copy_from_tableContext>(_localctx));
         enterOuterAlt(_localctx, 7);
-        setState(102);
+        setState(106);
+        match(SQLParser::T__18);
+        setState(107);
+        match(SQLParser::Identifier);
+        setState(108);
+        match(SQLParser::T__14);
+        setState(109);
+        match(SQLParser::String);
+        setState(112);
+        _errHandler->sync(this);
+
+        _la = _input->LA(1);
+        if (_la == SQLParser::T__19) {
+          setState(110);
+          match(SQLParser::T__19);
+          setState(111);
+          match(SQLParser::String);
+        }
+        break;
+      }
+
+      case SQLParser::T__20: {
+        _localctx = dynamic_cast<Table_statementContext *>(_tracker.createInstance<SQLParser::Vacuum_tableContext>(_localctx));
+        enterOuterAlt(_localctx, 8);
+        setState(114);
+        match(SQLParser::T__20);
+        setState(115);
+        match(SQLParser::Identifier);
+        break;
+      }
+
+      case SQLParser::T__21: {
+        _localctx = dynamic_cast<Table_statementContext *>(_tracker.createInstance<SQLParser::Select_table_Context>(_localctx));
+        enterOuterAlt(_localctx, 9);
+        setState(116);
         select_table();
         break;
       }
@@ -605,53 +692,53 @@ SQLParser::Select_tableContext* SQLParser::select_table() {
   });
   try {
     enterOuterAlt(_localctx, 1);
-    setState(105);
-    match(SQLParser::T__18);
-    setState(106);
+    setState(119);
+    match(SQLParser::T__21);
+    setState(120);
     selectors();
-    setState(107);
+    setState(121);
     match(SQLParser::T__14);
-    setState(108);
+    setState(122);
     identifiers();
-    setState(111);
+    setState(125);
     _errHandler->sync(this);
 
     _la = _input->LA(1);
     if (_la == SQLParser::T__15) {
-      setState(109);
+      setState(123);
       match(SQLParser::T__15);
-      setState(110);
+      setState(124);
       where_and_clause();
     }
-    setState(116);
+    setState(130);
     _errHandler->sync(this);
 
     _la = _input->LA(1);
-    if (_la == SQLParser::T__19) {
-      setState(113);
-      match(SQLParser::T__19);
-      setState(114);
-      match(SQLParser::T__20);
-      setState(115);
+    if (_la == SQLParser::T__22) {
+      setState(127);
+      match(SQLParser::T__22);
+      setState(128);
+      match(SQLParser::T__23);
+      setState(129);
       column();
     }
-    setState(124);
+    setState(138);
     _errHandler->sync(this);
 
     _la = _input->LA(1);
-    if (_la == SQLParser::T__21) {
-      setState(118);
-      match(SQLParser::T__21);
-      setState(119);
+    if (_la == SQLParser::T__24) {
+      setState(132);
+      match(SQLParser::T__24);
+      setState(133);
       match(SQLParser::Integer);
-      setState(122);
+      setState(136);
       _errHandler->sync(this);
 
       _la = _input->LA(1);
-      if (_la == SQLParser::T__22) {
-        setState(120);
-        match(SQLParser::T__22);
-        setState(121);
+      if (_la == SQLParser::T__25) {
+        setState(134);
+        match(SQLParser::T__25);
+        setState(135);
         match(SQLParser::Integer);
       }
     }
@@ -725,27 +812,27 @@ SQLParser::Index_statementContext* SQLParser::index_statement() {
     exitRule();
   });
   try {
-    setState(144);
+    setState(158);
     _errHandler->sync(this);
-    switch (getInterpreter<atn::ParserATNSimulator>()->adaptivePredict(_input, 8, _ctx)) {
+    switch (getInterpreter<atn::ParserATNSimulator>()->adaptivePredict(_input, 10, _ctx)) {
     case 1: {
       _localctx = dynamic_cast<Index_statementContext *>(_tracker.createInstance<SQLParser::Alter_add_indexContext>(_localctx));
       enterOuterAlt(_localctx, 1);
-      setState(126);
-      match(SQLParser::T__23);
-      setState(127);
+      setState(140);
+      match(SQLParser::T__26);
+      setState(141);
       match(SQLParser::T__5);
-      setState(128);
+      setState(142);
       match(SQLParser::Identifier);
-      setState(129);
-      match(SQLParser::T__24);
-      setState(130);
-      match(SQLParser::T__25);
-      setState(131);
+      setState(143);
+      match(SQLParser::T__27);
+      setState(144);
+      match(SQLParser::T__28);
+      setState(145);
       match(SQLParser::T__6);
-      setState(132);
+      setState(146);
       identifiers();
-      setState(133);
+      setState(147);
       match(SQLParser::T__7);
       break;
     }
@@ -753,21 +840,21 @@ SQLParser::Index_statementContext* SQLParser::index_statement() {
     case 2: {
       _localctx = dynamic_cast<Index_statementContext *>(_tracker.createInstance<SQLParser::Alter_drop_indexContext>(_localctx));
       enterOuterAlt(_localctx, 2);
-      setState(135);
-      match(SQLParser::T__23);
-      setState(136);
+      setState(149);
+      match(SQLParser::T__26);
+      setState(150);
       match(SQLParser::T__5);
-      setState(137);
+      setState(151);
       match(SQLParser::Identifier);
-      setState(138);
+      setState(152);
       match(SQLParser::T__8);
-      setState(139);
-      match(SQLParser::T__25);
-      setState(140);
+      setState(153);
+      match(SQLParser::T__28);
+      setState(154);
       match(SQLParser::T__6);
-      setState(141);
+      setState(155);
       identifiers();
-      setState(142);
+      setState(156);
       match(SQLParser::T__7);
       break;
     }
@@ -820,17 +907,17 @@ SQLParser::Field_listContext* SQLParser::field_list() {
   });
   try {
     enterOuterAlt(_localctx, 1);
-    setState(146);
+    setState(160);
     field();
-    setState(151);
+    setState(165);
     _errHandler->sync(this);
     _la = _input->LA(1);
-    while (_la == SQLParser::T__26) {
-      setState(147);
-      match(SQLParser::T__26);
-      setState(148);
+    while (_la == SQLParser::T__29) {
+      setState(161);
+      match(SQLParser::T__29);
+      setState(162);
       field();
-      setState(153);
+      setState(167);
       _errHandler->sync(this);
       _la = _input->LA(1);
     }
@@ -888,9 +975,9 @@ SQLParser::FieldContext* SQLParser::field() {
   try {
     _localctx = dynamic_cast<FieldContext *>(_tracker.createInstance<SQLParser::Normal_fieldContext>(_localctx));
     enterOuterAlt(_localctx, 1);
-    setState(154);
+    setState(168);
     match(SQLParser::Identifier);
-    setState(155);
+    setState(169);
     type_();
    
   }
@@ -933,33 +1020,54 @@ SQLParser::Type_Context* SQLParser::type_() {
     exitRule();
   });
   try {
-    setState(163);
+    setState(180);
     _errHandler->sync(this);
     switch (_input->LA(1)) {
-      case SQLParser::T__27: {
+      case SQLParser::T__30: {
         enterOuterAlt(_localctx, 1);
-        setState(157);
-        match(SQLParser::T__27);
+        setState(171);
+        match(SQLParser::T__30);
         break;
       }
 
-      case SQLParser::T__28: {
+      case SQLParser::T__31: {
         enterOuterAlt(_localctx, 2);
-        setState(158);
-        match(SQLParser::T__28);
-        setState(159);
+        setState(172);
+        match(SQLParser::T__31);
+        setState(173);
         match(SQLParser::T__6);
-        setState(160);
+        setState(174);
         match(SQLParser::Integer);
-        setState(161);
+        setState(175);
         match(SQLParser::T__7);
         break;
       }
 
-      case SQLParser::T__29: {
+      case SQLParser::T__32: {
         enterOuterAlt(_localctx, 3);
-        setState(162);
-        match(SQLParser::T__29);
+        setState(176);
+        match(SQLParser::T__32);
+        break;
+      }
+
+      case SQLParser::T__33: {
+        enterOuterAlt(_localctx, 4);
+        setState(177);
+        match(SQLParser::T__33);
+        break;
+      }
+
+      case SQLParser::T__34: {
+        enterOuterAlt(_localctx, 5);
+        setState(178);
+        match(SQLParser::T__34);
+        break;
+      }
+
+      case SQLParser::T__35: {
+        enterOuterAlt(_localctx, 6);
+        setState(179);
+        match(SQLParser::T__35);
         break;
       }
 
@@ -977,6 +1085,60 @@ SQLParser::Type_Context* SQLParser::type_() {
   return _localctx;
 }
 
+//----------------- Table_layoutContext ------------------------------------------------------------------
+
+SQLParser::Table_layoutContext::Table_layoutContext(ParserRuleContext *parent, size_t invokingState)
+  : ParserRuleContext(parent, invokingState) {
+}
+
+tree::TerminalNode* SQLParser::Table_layoutContext::EqualOrAssign() {
+  return getToken(SQLParser::EqualOrAssign, 0);
+}
+
+tree::TerminalNode* SQLParser::Table_layoutContext::Identifier() {
+  return getToken(SQLParser::Identifier, 0);
+}
+
+
+size_t SQLParser::Table_layoutContext::getRuleIndex() const {
+  return SQLParser::RuleTable_layout;
+}
+
+antlrcpp::Any SQLParser::Table_layoutContext::accept(tree::ParseTreeVisitor *visitor) {
+  if (auto parserVisitor = dynamic_cast<SQLVisitor*>(visitor))
+    return parserVisitor->visitTable_layout(this);
+  else
+    return visitor->visitChildren(this);
+}
+
+SQLParser::Table_layoutContext* SQLParser::table_layout() {
+  Table_layoutContext *_localctx = _tracker.createInstance<Table_layoutContext>(_ctx, getState());
+  enterRule(_localctx, 18, SQLParser::RuleTable_layout);
+
+  auto onExit = finally([=] {
+    exitRule();
+  });
+  try {
+    enterOuterAlt(_localctx, 1);
+    setState(182);
+    match(SQLParser::T__36);
+    setState(183);
+    match(SQLParser::T__37);
+    setState(184);
+    match(SQLParser::EqualOrAssign);
+    setState(185);
+    match(SQLParser::Identifier);
+   
+  }
+  catch (RecognitionException &e) {
+    _errHandler->reportError(this, e);
+    _localctx->exception = std::current_exception();
+    _errHandler->recover(this, _localctx->exception);
+  }
+
+  return _localctx;
+}
+
 //----------------- Value_listsContext ------------------------------------------------------------------
 
 SQLParser::Value_listsContext::Value_listsContext(ParserRuleContext *parent, size_t invokingState)
@@ -1005,7 +1167,7 @@ antlrcpp::Any SQLParser::Value_listsContext::accept(tree::ParseTreeVisitor *visi
 
 SQLParser::Value_listsContext* SQLParser::value_lists() {
   Value_listsContext *_localctx = _tracker.createInstance<Value_listsContext>(_ctx, getState());
-  enterRule(_localctx, 18, SQLParser::RuleValue_lists);
+  enterRule(_localctx, 20, SQLParser::RuleValue_lists);
   size_t _la = 0;
 
   auto onExit = finally([=] {
@@ -1013,17 +1175,17 @@ SQLParser::Value_listsContext* SQLParser::value_lists() {
   });
   try {
     enterOuterAlt(_localctx, 1);
-    setState(165);
+    setState(187);
     value_list();
-    setState(170);
+    setState(192);
     _errHandler->sync(this);
     _la = _input->LA(1);
-    while (_la == SQLParser::T__26) {
-      setState(166);
-      match(SQLParser::T__26);
-      setState(167);
+    while (_la == SQLParser::T__29) {
+      setState(188);
+      match(SQLParser::T__29);
+      setState(189);
       value_list();
-      setState(172);
+      setState(194);
       _errHandler->sync(this);
       _la = _input->LA(1);
     }
@@ -1066,7 +1228,7 @@ antlrcpp::Any SQLParser::Value_listContext::accept(tree::ParseTreeVisitor *visit
 
 SQLParser::Value_listContext* SQLParser::value_list() {
   Value_listContext *_localctx = _tracker.createInstance<Value_listContext>(_ctx, getState());
-  enterRule(_localctx, 20, SQLParser::RuleValue_list);
+  enterRule(_localctx, 22, SQLParser::RuleValue_list);
   size_t _la = 0;
 
   auto onExit = finally([=] {
@@ -1074,23 +1236,23 @@ SQLParser::Value_listContext* SQLParser::value_list() {
   });
   try {
     enterOuterAlt(_localctx, 1);
-    setState(173);
+    setState(195);
     match(SQLParser::T__6);
-    setState(174);
+    setState(196);
     value();
-    setState(179);
+    setState(201);
     _errHandler->sync(this);
     _la = _input->LA(1);
-    while (_la == SQLParser::T__26) {
-      setState(175);
-      match(SQLParser::T__26);
-      setState(176);
+    while (_la == SQLParser::T__29) {
+      setState(197);
+      match(SQLParser::T__29);
+      setState(198);
       value();
-      setState(181);
+      setState(203);
       _errHandler->sync(this);
       _la = _input->LA(1);
     }
-    setState(182);
+    setState(204);
     match(SQLParser::T__7);
    
   }
@@ -1139,7 +1301,7 @@ antlrcpp::Any SQLParser::ValueContext::accept(tree::ParseTreeVisitor *visitor) {
 
 SQLParser::ValueContext* SQLParser::value() {
   ValueContext *_localctx = _tracker.createInstance<ValueContext>(_ctx, getState());
-  enterRule(_localctx, 22, SQLParser::RuleValue);
+  enterRule(_localctx, 24, SQLParser::RuleValue);
   size_t _la = 0;
 
   auto onExit = finally([=] {
@@ -1147,7 +1309,7 @@ SQLParser::ValueContext* SQLParser::value() {
   });
   try {
     enterOuterAlt(_localctx, 1);
-    setState(184);
+    setState(206);
     _la = _input->LA(1);
     if (!((((_la & ~ 0x3fULL) == 0) &&
       ((1ULL << _la) & ((1ULL << SQLParser::Null)
@@ -1199,7 +1361,7 @@ antlrcpp::Any SQLParser::Where_and_clauseContext::accept(tree::ParseTreeVisitor
 
 SQLParser::Where_and_clauseContext* SQLParser::where_and_clause() {
   Where_and_clauseContext *_localctx = _tracker.createInstance<Where_and_clauseContext>(_ctx, getState());
-  enterRule(_localctx, 24, SQLParser::RuleWhere_and_clause);
+  enterRule(_localctx, 26, SQLParser::RuleWhere_and_clause);
   size_t _la = 0;
 
   auto onExit = finally([=] {
@@ -1207,17 +1369,17 @@ SQLParser::Where_and_clauseContext* SQLParser::where_and_clause() {
   });
   try {
     enterOuterAlt(_localctx, 1);
-    setState(186);
+    setState(208);
     where_clause();
-    setState(191);
+    setState(213);
     _errHandler->sync(this);
     _la = _input->LA(1);
-    while (_la == SQLParser::T__30) {
-      setState(187);
-      match(SQLParser::T__30);
-      setState(188);
+    while (_la == SQLParser::T__38) {
+      setState(209);
+      match(SQLParser::T__38);
+      setState(210);
       where_clause();
-      setState(193);
+      setState(215);
       _errHandler->sync(this);
       _la = _input->LA(1);
     }
@@ -1271,7 +1433,7 @@ antlrcpp::Any SQLParser::Where_operator_expressionContext::accept(tree::ParseTre
 }
 SQLParser::Where_clauseContext* SQLParser::where_clause() {
   Where_clauseContext *_localctx = _tracker.createInstance<Where_clauseContext>(_ctx, getState());
-  enterRule(_localctx, 26, SQLParser::RuleWhere_clause);
+  enterRule(_localctx, 28, SQLParser::RuleWhere_clause);
 
   auto onExit = finally([=] {
     exitRule();
@@ -1279,11 +1441,11 @@ SQLParser::Where_clauseContext* SQLParser::where_clause() {
   try {
     _localctx = dynamic_cast<Where_clauseContext *>(_tracker.createInstance<SQLParser::Where_operator_expressionContext>(_localctx));
     enterOuterAlt(_localctx, 1);
-    setState(194);
+    setState(216);
     column();
-    setState(195);
+    setState(217);
     operate();
-    setState(196);
+    setState(218);
     expression();
    
   }
@@ -1324,18 +1486,18 @@ antlrcpp::Any SQLParser::ColumnContext::accept(tree::ParseTreeVisitor *visitor)
 
 SQLParser::ColumnContext* SQLParser::column() {
   ColumnContext *_localctx = _tracker.createInstance<ColumnContext>(_ctx, getState());
-  enterRule(_localctx, 28, SQLParser::RuleColumn);
+  enterRule(_localctx, 30, SQLParser::RuleColumn);
 
   auto onExit = finally([=] {
     exitRule();
   });
   try {
     enterOuterAlt(_localctx, 1);
-    setState(198);
+    setState(220);
     match(SQLParser::Identifier);
-    setState(199);
-    match(SQLParser::T__31);
-    setState(200);
+    setState(221);
+    match(SQLParser::T__39);
+    setState(222);
     match(SQLParser::Identifier);
    
   }
@@ -1376,13 +1538,13 @@ antlrcpp::Any SQLParser::ExpressionContext::accept(tree::ParseTreeVisitor *visit
 
 SQLParser::ExpressionContext* SQLParser::expression() {
   ExpressionContext *_localctx = _tracker.createInstance<ExpressionContext>(_ctx, getState());
-  enterRule(_localctx, 30, SQLParser::RuleExpression);
+  enterRule(_localctx, 32, SQLParser::RuleExpression);
 
   auto onExit = finally([=] {
     exitRule();
   });
   try {
-    setState(204);
+    setState(226);
     _errHandler->sync(this);
     switch (_input->LA(1)) {
       case SQLParser::Null:
@@ -1390,14 +1552,14 @@ SQLParser::ExpressionContext* SQLParser::expression() {
       case SQLParser::String:
       case SQLParser::Float: {
         enterOuterAlt(_localctx, 1);
-        setState(202);
+        setState(224);
         value();
         break;
       }
 
       case SQLParser::Identifier: {
         enterOuterAlt(_localctx, 2);
-        setState(203);
+        setState(225);
         column();
         break;
       }
@@ -1460,7 +1622,7 @@ antlrcpp::Any SQLParser::Set_clauseContext::accept(tree::ParseTreeVisitor *visit
 
 SQLParser::Set_clauseContext* SQLParser::set_clause() {
   Set_clauseContext *_localctx = _tracker.createInstance<Set_clauseContext>(_ctx, getState());
-  enterRule(_localctx, 32, SQLParser::RuleSet_clause);
+  enterRule(_localctx, 34, SQLParser::RuleSet_clause);
   size_t _la = 0;
 
   auto onExit = finally([=] {
@@ -1468,25 +1630,25 @@ SQLParser::Set_clauseContext* SQLParser::set_clause() {
   });
   try {
     enterOuterAlt(_localctx, 1);
-    setState(206);
+    setState(228);
     match(SQLParser::Identifier);
-    setState(207);
+    setState(229);
     match(SQLParser::EqualOrAssign);
-    setState(208);
+    setState(230);
     value();
-    setState(215);
+    setState(237);
     _errHandler->sync(this);
     _la = _input->LA(1);
-    while (_la == SQLParser::T__26) {
-      setState(209);
-      match(SQLParser::T__26);
-      setState(210);
+    while (_la == SQLParser::T__29) {
+      setState(231);
+      match(SQLParser::T__29);
+      setState(232);
       match(SQLParser::Identifier);
-      setState(211);
+      setState(233);
       match(SQLParser::EqualOrAssign);
-      setState(212);
+      setState(234);
       value();
-      setState(217);
+      setState(239);
       _errHandler->sync(this);
       _la = _input->LA(1);
     }
@@ -1529,20 +1691,20 @@ antlrcpp::Any SQLParser::SelectorsContext::accept(tree::ParseTreeVisitor *visito
 
 SQLParser::SelectorsContext* SQLParser::selectors() {
   SelectorsContext *_localctx = _tracker.createInstance<SelectorsContext>(_ctx, getState());
-  enterRule(_localctx, 34, SQLParser::RuleSelectors);
+  enterRule(_localctx, 36, SQLParser::RuleSelectors);
   size_t _la = 0;
 
   auto onExit = finally([=] {
     exitRule();
   });
   try {
-    setState(227);
+    setState(249);
     _errHandler->sync(this);
     switch (_input->LA(1)) {
-      case SQLParser::T__32: {
+      case SQLParser::T__40: {
         enterOuterAlt(_localctx, 1);
-        setState(218);
-        match(SQLParser::T__32);
+        setState(240);
+        match(SQLParser::T__40);
         break;
       }
 
@@ -1553,17 +1715,17 @@ SQLParser::SelectorsContext* SQLParser::selectors() {
       case SQLParser::Sum:
       case SQLParser::Identifier: {
         enterOuterAlt(_localctx, 2);
-        setState(219);
+        setState(241);
         selector();
-        setState(224);
+        setState(246);
         _errHandler->sync(this);
         _la = _input->LA(1);
-        while (_la == SQLParser::T__26) {
-          setState(220);
-          match(SQLParser::T__26);
-          setState(221);
+        while (_la == SQLParser::T__29) {
+          setState(242);
+          match(SQLParser::T__29);
+          setState(243);
           selector();
-          setState(226);
+          setState(248);
           _errHandler->sync(this);
           _la = _input->LA(1);
         }
@@ -1616,44 +1778,44 @@ antlrcpp::Any SQLParser::SelectorContext::accept(tree::ParseTreeVisitor *visitor
 
 SQLParser::SelectorContext* SQLParser::selector() {
   SelectorContext *_localctx = _tracker.createInstance<SelectorContext>(_ctx, getState());
-  enterRule(_localctx, 36, SQLParser::RuleSelector);
+  enterRule(_localctx, 38, SQLParser::RuleSelector);
 
   auto onExit = finally([=] {
     exitRule();
   });
   try {
-    setState(239);
+    setState(261);
     _errHandler->sync(this);
-    switch (getInterpreter<atn::ParserATNSimulator>()->adaptivePredict(_input, 18, _ctx)) {
+    switch (getInterpreter<atn::ParserATNSimulator>()->adaptivePredict(_input, 20, _ctx)) {
     case 1: {
       enterOuterAlt(_localctx, 1);
-      setState(229);
+      setState(251);
       column();
       break;
     }
 
     case 2: {
       enterOuterAlt(_localctx, 2);
-      setState(230);
+      setState(252);
       aggregator();
-      setState(231);
+      setState(253);
       match(SQLParser::T__6);
-      setState(232);
+      setState(254);
       column();
-      setState(233);
+      setState(255);
       match(SQLParser::T__7);
       break;
     }
 
     case 3: {
       enterOuterAlt(_localctx, 3);
-      setState(235);
+      setState(257);
       match(SQLParser::Count);
-      setState(236);
+      setState(258);
       match(SQLParser::T__6);
-      setState(237);
-      match(SQLParser::T__32);
-      setState(238);
+      setState(259);
+      match(SQLParser::T__40);
+      setState(260);
       match(SQLParser::T__7);
       break;
     }
@@ -1698,7 +1860,7 @@ antlrcpp::Any SQLParser::IdentifiersContext::accept(tree::ParseTreeVisitor *visi
 
 SQLParser::IdentifiersContext* SQLParser::identifiers() {
   IdentifiersContext *_localctx = _tracker.createInstance<IdentifiersContext>(_ctx, getState());
-  enterRule(_localctx, 38, SQLParser::RuleIdentifiers);
+  enterRule(_localctx, 40, SQLParser::RuleIdentifiers);
   size_t _la = 0;
 
   auto onExit = finally([=] {
@@ -1706,17 +1868,17 @@ SQLParser::IdentifiersContext* SQLParser::identifiers() {
   });
   try {
     enterOuterAlt(_localctx, 1);
-    setState(241);
+    setState(263);
     match(SQLParser::Identifier);
-    setState(246);
+    setState(268);
     _errHandler->sync(this);
     _la = _input->LA(1);
-    while (_la == SQLParser::T__26) {
-      setState(242);
-      match(SQLParser::T__26);
-      setState(243);
+    while (_la == SQLParser::T__29) {
+      setState(264);
+      match(SQLParser::T__29);
+      setState(265);
       match(SQLParser::Identifier);
-      setState(248);
+      setState(270);
       _errHandler->sync(this);
       _la = _input->LA(1);
     }
@@ -1775,7 +1937,7 @@ antlrcpp::Any SQLParser::OperateContext::accept(tree::ParseTreeVisitor *visitor)
 
 SQLParser::OperateContext* SQLParser::operate() {
   OperateContext *_localctx = _tracker.createInstance<OperateContext>(_ctx, getState());
-  enterRule(_localctx, 40, SQLParser::RuleOperate);
+  enterRule(_localctx, 42, SQLParser::RuleOperate);
   size_t _la = 0;
 
   auto onExit = finally([=] {
@@ -1783,7 +1945,7 @@ SQLParser::OperateContext* SQLParser::operate() {
   });
   try {
     enterOuterAlt(_localctx, 1);
-    setState(249);
+    setState(271);
     _la = _input->LA(1);
     if (!((((_la & ~ 0x3fULL) == 0) &&
       ((1ULL << _la) & ((1ULL << SQLParser::EqualOrAssign)
@@ -1849,7 +2011,7 @@ antlrcpp::Any SQLParser::AggregatorContext::accept(tree::ParseTreeVisitor *visit
 
 SQLParser::AggregatorContext* SQLParser::aggregator() {
   AggregatorContext *_localctx = _tracker.createInstance<AggregatorContext>(_ctx, getState());
-  enterRule(_localctx, 42, SQLParser::RuleAggregator);
+  enterRule(_localctx, 44, SQLParser::RuleAggregator);
   size_t _la = 0;
 
   auto onExit = finally([=] {
@@ -1857,7 +2019,7 @@ SQLParser::AggregatorContext* SQLParser::aggregator() {
   });
   try {
     enterOuterAlt(_localctx, 1);
-    setState(251);
+    setState(273);
     _la = _input->LA(1);
     if (!((((_la & ~ 0x3fULL) == 0) &&
       ((1ULL << _la) & ((1ULL << SQLParser::Count)
@@ -1892,26 +2054,28 @@ std::vector<uint16_t> SQLParser::_serializedATN;
 
 std::vector<std::string> SQLParser::_ruleNames = {
   "program", "statement", "db_statement", "table_statement", "select_table", 
-  "index_statement", "field_list", "field", "type_", "value_lists", "value_list", 
-  "value", "where_and_clause", "where_clause", "column", "expression", "set_clause", 
-  "selectors", "selector", "identifiers", "operate", "aggregator"
+  "index_statement", "field_list", "field", "type_", "table_layout", "value_lists", 
+  "value_list", "value", "where_and_clause", "where_clause", "column", "expression", 
+  "set_clause", "selectors", "selector", "identifiers", "operate", "aggregator"
 };
 
 std::vector<std::string> SQLParser::_literalNames = {
   "", "';'", "'SHOW'", "'TABLES'", "'INDEXES'", "'CREATE'", "'TABLE'", "'('", 
   "')'", "'DROP'", "'DESC'", "'INSERT'", "'INTO'", "'VALUES'", "'DELETE'", 
-  "'FROM'", "'WHERE'", "'UPDATE'", "'SET'", "'SELECT'", "'GROUP'", "'BY'", 
-  "'LIMIT'", "'OFFSET'", "'ALTER'", "'ADD'", "'INDEX'", "','", "'INT'", 
-  "'VARCHAR'", "'FLOAT'", "'AND'", "'.'", "'*'", "'='", "'<'", "'<='", "'>'", 
-  "'>='", "'<>'", "'COUNT'", "'AVG'", "'MAX'", "'MIN'", "'SUM'", "'NULL'"
+  "'FROM'", "'WHERE'", "'UPDATE'", "'SET'", "'COPY'", "'DELIMITER'", "'VACUUM'", 
+  "'SELECT'", "'GROUP'", "'BY'", "'LIMIT'", "'OFFSET'", "'ALTER'", "'ADD'", 
+  "'INDEX'", "','", "'INT'", "'VARCHAR'", "'FLOAT'", "'TINYINT'", "'SMALLINT'", 
+  "'BIGINT'", "'WITH'", "'LAYOUT'", "'AND'", "'.'", "'*'", "'='", "'<'", 
+  "'<='", "'>'", "'>='", "'<>'", "'COUNT'", "'AVG'", "'MAX'", "'MIN'", "'SUM'", 
+  "'NULL'"
 };
 
 std::vector<std::string> SQLParser::_symbolicNames = {
   "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", 
-  "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "EqualOrAssign", 
-  "Less", "LessEqual", "Greater", "GreaterEqual", "NotEqual", "Count", "Average", 
-  "Max", "Min", "Sum", "Null", "Identifier", "Integer", "String", "Float", 
-  "Whitespace", "Annotation"
+  "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", 
+  "", "", "", "", "", "", "EqualOrAssign", "Less", "LessEqual", "Greater", 
+  "GreaterEqual", "NotEqual", "Count", "Average", "Max", "Min", "Sum", "Null", 
+  "Identifier", "Integer", "String", "Float", "Whitespace", "Annotation"
 };
 
 dfa::Vocabulary SQLParser::_vocabulary(_literalNames, _symbolicNames);
@@ -1934,172 +2098,189 @@ SQLParser::Initializer::Initializer() {
 
   _serializedATN = {
     0x3, 0x608b, 0xa72a, 0x8133, 0xb9ed, 0x417c, 0x3be7, 0x7786, 0x5964, 
-    0x3, 0x35, 0x100, 0x4, 0x2, 0x9, 0x2, 0x4, 0x3, 0x9, 0x3, 0x4, 0x4, 
+    0x3, 0x3d, 0x116, 0x4, 0x2, 0x9, 0x2, 0x4, 0x3, 0x9, 0x3, 0x4, 0x4, 
     0x9, 0x4, 0x4, 0x5, 0x9, 0x5, 0x4, 0x6, 0x9, 0x6, 0x4, 0x7, 0x9, 0x7, 
     0x4, 0x8, 0x9, 0x8, 0x4, 0x9, 0x9, 0x9, 0x4, 0xa, 0x9, 0xa, 0x4, 0xb, 
     0x9, 0xb, 0x4, 0xc, 0x9, 0xc, 0x4, 0xd, 0x9, 0xd, 0x4, 0xe, 0x9, 0xe, 
     0x4, 0xf, 0x9, 0xf, 0x4, 0x10, 0x9, 0x10, 0x4, 0x11, 0x9, 0x11, 0x4, 
     0x12, 0x9, 0x12, 0x4, 0x13, 0x9, 0x13, 0x4, 0x14, 0x9, 0x14, 0x4, 0x15, 
-    0x9, 0x15, 0x4, 0x16, 0x9, 0x16, 0x4, 0x17, 0x9, 0x17, 0x3, 0x2, 0x7, 
-    0x2, 0x30, 0xa, 0x2, 0xc, 0x2, 0xe, 0x2, 0x33, 0xb, 0x2, 0x3, 0x2, 0x3, 
-    0x2, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 
-    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x5, 
-    0x3, 0x44, 0xa, 0x3, 0x3, 0x4, 0x3, 0x4, 0x3, 0x4, 0x3, 0x4, 0x5, 0x4, 
-    0x4a, 0xa, 0x4, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 
+    0x9, 0x15, 0x4, 0x16, 0x9, 0x16, 0x4, 0x17, 0x9, 0x17, 0x4, 0x18, 0x9, 
+    0x18, 0x3, 0x2, 0x7, 0x2, 0x32, 0xa, 0x2, 0xc, 0x2, 0xe, 0x2, 0x35, 
+    0xb, 0x2, 0x3, 0x2, 0x3, 0x2, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 
+    0x3, 0x3, 0x3, 0x3, 0x5, 0x3, 0x46, 0xa, 0x3, 0x3, 0x4, 0x3, 0x4, 0x3, 
+    0x4, 0x3, 0x4, 0x5, 0x4, 0x4c, 0xa, 0x4, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 
+    0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x5, 0x5, 0x55, 0xa, 0x5, 0x3, 
     0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 
     0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 
     0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 
-    0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x5, 0x5, 0x6a, 0xa, 0x5, 0x3, 0x6, 
-    0x3, 0x6, 0x3, 0x6, 0x3, 0x6, 0x3, 0x6, 0x3, 0x6, 0x5, 0x6, 0x72, 0xa, 
-    0x6, 0x3, 0x6, 0x3, 0x6, 0x3, 0x6, 0x5, 0x6, 0x77, 0xa, 0x6, 0x3, 0x6, 
-    0x3, 0x6, 0x3, 0x6, 0x3, 0x6, 0x5, 0x6, 0x7d, 0xa, 0x6, 0x5, 0x6, 0x7f, 
-    0xa, 0x6, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 
-    0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 
-    0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x5, 0x7, 0x93, 0xa, 
-    0x7, 0x3, 0x8, 0x3, 0x8, 0x3, 0x8, 0x7, 0x8, 0x98, 0xa, 0x8, 0xc, 0x8, 
-    0xe, 0x8, 0x9b, 0xb, 0x8, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0xa, 0x3, 
-    0xa, 0x3, 0xa, 0x3, 0xa, 0x3, 0xa, 0x3, 0xa, 0x5, 0xa, 0xa6, 0xa, 0xa, 
-    0x3, 0xb, 0x3, 0xb, 0x3, 0xb, 0x7, 0xb, 0xab, 0xa, 0xb, 0xc, 0xb, 0xe, 
-    0xb, 0xae, 0xb, 0xb, 0x3, 0xc, 0x3, 0xc, 0x3, 0xc, 0x3, 0xc, 0x7, 0xc, 
-    0xb4, 0xa, 0xc, 0xc, 0xc, 0xe, 0xc, 0xb7, 0xb, 0xc, 0x3, 0xc, 0x3, 0xc, 
-    0x3, 0xd, 0x3, 0xd, 0x3, 0xe, 0x3, 0xe, 0x3, 0xe, 0x7, 0xe, 0xc0, 0xa, 
-    0xe, 0xc, 0xe, 0xe, 0xe, 0xc3, 0xb, 0xe, 0x3, 0xf, 0x3, 0xf, 0x3, 0xf, 
-    0x3, 0xf, 0x3, 0x10, 0x3, 0x10, 0x3, 0x10, 0x3, 0x10, 0x3, 0x11, 0x3, 
-    0x11, 0x5, 0x11, 0xcf, 0xa, 0x11, 0x3, 0x12, 0x3, 0x12, 0x3, 0x12, 0x3, 
-    0x12, 0x3, 0x12, 0x3, 0x12, 0x3, 0x12, 0x7, 0x12, 0xd8, 0xa, 0x12, 0xc, 
-    0x12, 0xe, 0x12, 0xdb, 0xb, 0x12, 0x3, 0x13, 0x3, 0x13, 0x3, 0x13, 0x3, 
-    0x13, 0x7, 0x13, 0xe1, 0xa, 0x13, 0xc, 0x13, 0xe, 0x13, 0xe4, 0xb, 0x13, 
-    0x5, 0x13, 0xe6, 0xa, 0x13, 0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 
-    0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 0x5, 
-    0x14, 0xf2, 0xa, 0x14, 0x3, 0x15, 0x3, 0x15, 0x3, 0x15, 0x7, 0x15, 0xf7, 
-    0xa, 0x15, 0xc, 0x15, 0xe, 0x15, 0xfa, 0xb, 0x15, 0x3, 0x16, 0x3, 0x16, 
-    0x3, 0x17, 0x3, 0x17, 0x3, 0x17, 0x2, 0x2, 0x18, 0x2, 0x4, 0x6, 0x8, 
-    0xa, 0xc, 0xe, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1a, 0x1c, 0x1e, 0x20, 
-    0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2, 0x5, 0x4, 0x2, 0x2f, 0x2f, 
-    0x31, 0x33, 0x3, 0x2, 0x24, 0x29, 0x3, 0x2, 0x2a, 0x2e, 0x2, 0x107, 
-    0x2, 0x31, 0x3, 0x2, 0x2, 0x2, 0x4, 0x43, 0x3, 0x2, 0x2, 0x2, 0x6, 0x49, 
-    0x3, 0x2, 0x2, 0x2, 0x8, 0x69, 0x3, 0x2, 0x2, 0x2, 0xa, 0x6b, 0x3, 0x2, 
-    0x2, 0x2, 0xc, 0x92, 0x3, 0x2, 0x2, 0x2, 0xe, 0x94, 0x3, 0x2, 0x2, 0x2, 
-    0x10, 0x9c, 0x3, 0x2, 0x2, 0x2, 0x12, 0xa5, 0x3, 0x2, 0x2, 0x2, 0x14, 
-    0xa7, 0x3, 0x2, 0x2, 0x2, 0x16, 0xaf, 0x3, 0x2, 0x2, 0x2, 0x18, 0xba, 
-    0x3, 0x2, 0x2, 0x2, 0x1a, 0xbc, 0x3, 0x2, 0x2, 0x2, 0x1c, 0xc4, 0x3, 
-    0x2, 0x2, 0x2, 0x1e, 0xc8, 0x3, 0x2, 0x2, 0x2, 0x20, 0xce, 0x3, 0x2, 
-    0x2, 0x2, 0x22, 0xd0, 0x3, 0x2, 0x2, 0x2, 0x24, 0xe5, 0x3, 0x2, 0x2, 
-    0x2, 0x26, 0xf1, 0x3, 0x2, 0x2, 0x2, 0x28, 0xf3, 0x3, 0x2, 0x2, 0x2, 
-    0x2a, 0xfb, 0x3, 0x2, 0x2, 0x2, 0x2c, 0xfd, 0x3, 0x2, 0x2, 0x2, 0x2e, 
-    0x30, 0x5, 0x4, 0x3, 0x2, 0x2f, 0x2e, 0x3, 0x2, 0x2, 0x2, 0x30, 0x33, 
-    0x3, 0x2, 0x2, 0x2, 0x31, 0x2f, 0x3, 0x2, 0x2, 0x2, 0x31, 0x32, 0x3, 
-    0x2, 0x2, 0x2, 0x32, 0x34, 0x3, 0x2, 0x2, 0x2, 0x33, 0x31, 0x3, 0x2, 
-    0x2, 0x2, 0x34, 0x35, 0x7, 0x2, 0x2, 0x3, 0x35, 0x3, 0x3, 0x2, 0x2, 
-    0x2, 0x36, 0x37, 0x5, 0x6, 0x4, 0x2, 0x37, 0x38, 0x7, 0x3, 0x2, 0x2, 
-    0x38, 0x44, 0x3, 0x2, 0x2, 0x2, 0x39, 0x3a, 0x5, 0x8, 0x5, 0x2, 0x3a, 
-    0x3b, 0x7, 0x3, 0x2, 0x2, 0x3b, 0x44, 0x3, 0x2, 0x2, 0x2, 0x3c, 0x3d, 
-    0x5, 0xc, 0x7, 0x2, 0x3d, 0x3e, 0x7, 0x3, 0x2, 0x2, 0x3e, 0x44, 0x3, 
-    0x2, 0x2, 0x2, 0x3f, 0x40, 0x7, 0x35, 0x2, 0x2, 0x40, 0x44, 0x7, 0x3, 
-    0x2, 0x2, 0x41, 0x42, 0x7, 0x2f, 0x2, 0x2, 0x42, 0x44, 0x7, 0x3, 0x2, 
-    0x2, 0x43, 0x36, 0x3, 0x2, 0x2, 0x2, 0x43, 0x39, 0x3, 0x2, 0x2, 0x2, 
-    0x43, 0x3c, 0x3, 0x2, 0x2, 0x2, 0x43, 0x3f, 0x3, 0x2, 0x2, 0x2, 0x43, 
-    0x41, 0x3, 0x2, 0x2, 0x2, 0x44, 0x5, 0x3, 0x2, 0x2, 0x2, 0x45, 0x46, 
-    0x7, 0x4, 0x2, 0x2, 0x46, 0x4a, 0x7, 0x5, 0x2, 0x2, 0x47, 0x48, 0x7, 
-    0x4, 0x2, 0x2, 0x48, 0x4a, 0x7, 0x6, 0x2, 0x2, 0x49, 0x45, 0x3, 0x2, 
-    0x2, 0x2, 0x49, 0x47, 0x3, 0x2, 0x2, 0x2, 0x4a, 0x7, 0x3, 0x2, 0x2, 
-    0x2, 0x4b, 0x4c, 0x7, 0x7, 0x2, 0x2, 0x4c, 0x4d, 0x7, 0x8, 0x2, 0x2, 
-    0x4d, 0x4e, 0x7, 0x30, 0x2, 0x2, 0x4e, 0x4f, 0x7, 0x9, 0x2, 0x2, 0x4f, 
-    0x50, 0x5, 0xe, 0x8, 0x2, 0x50, 0x51, 0x7, 0xa, 0x2, 0x2, 0x51, 0x6a, 
-    0x3, 0x2, 0x2, 0x2, 0x52, 0x53, 0x7, 0xb, 0x2, 0x2, 0x53, 0x54, 0x7, 
-    0x8, 0x2, 0x2, 0x54, 0x6a, 0x7, 0x30, 0x2, 0x2, 0x55, 0x56, 0x7, 0xc, 
-    0x2, 0x2, 0x56, 0x6a, 0x7, 0x30, 0x2, 0x2, 0x57, 0x58, 0x7, 0xd, 0x2, 
-    0x2, 0x58, 0x59, 0x7, 0xe, 0x2, 0x2, 0x59, 0x5a, 0x7, 0x30, 0x2, 0x2, 
-    0x5a, 0x5b, 0x7, 0xf, 0x2, 0x2, 0x5b, 0x6a, 0x5, 0x14, 0xb, 0x2, 0x5c, 
-    0x5d, 0x7, 0x10, 0x2, 0x2, 0x5d, 0x5e, 0x7, 0x11, 0x2, 0x2, 0x5e, 0x5f, 
-    0x7, 0x30, 0x2, 0x2, 0x5f, 0x60, 0x7, 0x12, 0x2, 0x2, 0x60, 0x6a, 0x5, 
-    0x1a, 0xe, 0x2, 0x61, 0x62, 0x7, 0x13, 0x2, 0x2, 0x62, 0x63, 0x7, 0x30, 
-    0x2, 0x2, 0x63, 0x64, 0x7, 0x14, 0x2, 0x2, 0x64, 0x65, 0x5, 0x22, 0x12, 
-    0x2, 0x65, 0x66, 0x7, 0x12, 0x2, 0x2, 0x66, 0x67, 0x5, 0x1a, 0xe, 0x2, 
-    0x67, 0x6a, 0x3, 0x2, 0x2, 0x2, 0x68, 0x6a, 0x5, 0xa, 0x6, 0x2, 0x69, 
-    0x4b, 0x3, 0x2, 0x2, 0x2, 0x69, 0x52, 0x3, 0x2, 0x2, 0x2, 0x69, 0x55, 
-    0x3, 0x2, 0x2, 0x2, 0x69, 0x57, 0x3, 0x2, 0x2, 0x2, 0x69, 0x5c, 0x3, 
-    0x2, 0x2, 0x2, 0x69, 0x61, 0x3, 0x2, 0x2, 0x2, 0x69, 0x68, 0x3, 0x2, 
-    0x2, 0x2, 0x6a, 0x9, 0x3, 0x2, 0x2, 0x2, 0x6b, 0x6c, 0x7, 0x15, 0x2, 
-    0x2, 0x6c, 0x6d, 0x5, 0x24, 0x13, 0x2, 0x6d, 0x6e, 0x7, 0x11, 0x2, 0x2, 
-    0x6e, 0x71, 0x5, 0x28, 0x15, 0x2, 0x6f, 0x70, 0x7, 0x12, 0x2, 0x2, 0x70, 
-    0x72, 0x5, 0x1a, 0xe, 0x2, 0x71, 0x6f, 0x3, 0x2, 0x2, 0x2, 0x71, 0x72, 
-    0x3, 0x2, 0x2, 0x2, 0x72, 0x76, 0x3, 0x2, 0x2, 0x2, 0x73, 0x74, 0x7, 
-    0x16, 0x2, 0x2, 0x74, 0x75, 0x7, 0x17, 0x2, 0x2, 0x75, 0x77, 0x5, 0x1e, 
-    0x10, 0x2, 0x76, 0x73, 0x3, 0x2, 0x2, 0x2, 0x76, 0x77, 0x3, 0x2, 0x2, 
-    0x2, 0x77, 0x7e, 0x3, 0x2, 0x2, 0x2, 0x78, 0x79, 0x7, 0x18, 0x2, 0x2, 
-    0x79, 0x7c, 0x7, 0x31, 0x2, 0x2, 0x7a, 0x7b, 0x7, 0x19, 0x2, 0x2, 0x7b, 
-    0x7d, 0x7, 0x31, 0x2, 0x2, 0x7c, 0x7a, 0x3, 0x2, 0x2, 0x2, 0x7c, 0x7d, 
-    0x3, 0x2, 0x2, 0x2, 0x7d, 0x7f, 0x3, 0x2, 0x2, 0x2, 0x7e, 0x78, 0x3, 
-    0x2, 0x2, 0x2, 0x7e, 0x7f, 0x3, 0x2, 0x2, 0x2, 0x7f, 0xb, 0x3, 0x2, 
-    0x2, 0x2, 0x80, 0x81, 0x7, 0x1a, 0x2, 0x2, 0x81, 0x82, 0x7, 0x8, 0x2, 
-    0x2, 0x82, 0x83, 0x7, 0x30, 0x2, 0x2, 0x83, 0x84, 0x7, 0x1b, 0x2, 0x2, 
-    0x84, 0x85, 0x7, 0x1c, 0x2, 0x2, 0x85, 0x86, 0x7, 0x9, 0x2, 0x2, 0x86, 
-    0x87, 0x5, 0x28, 0x15, 0x2, 0x87, 0x88, 0x7, 0xa, 0x2, 0x2, 0x88, 0x93, 
-    0x3, 0x2, 0x2, 0x2, 0x89, 0x8a, 0x7, 0x1a, 0x2, 0x2, 0x8a, 0x8b, 0x7, 
-    0x8, 0x2, 0x2, 0x8b, 0x8c, 0x7, 0x30, 0x2, 0x2, 0x8c, 0x8d, 0x7, 0xb, 
-    0x2, 0x2, 0x8d, 0x8e, 0x7, 0x1c, 0x2, 0x2, 0x8e, 0x8f, 0x7, 0x9, 0x2, 
-    0x2, 0x8f, 0x90, 0x5, 0x28, 0x15, 0x2, 0x90, 0x91, 0x7, 0xa, 0x2, 0x2, 
-    0x91, 0x93, 0x3, 0x2, 0x2, 0x2, 0x92, 0x80, 0x3, 0x2, 0x2, 0x2, 0x92, 
-    0x89, 0x3, 0x2, 0x2, 0x2, 0x93, 0xd, 0x3, 0x2, 0x2, 0x2, 0x94, 0x99, 
-    0x5, 0x10, 0x9, 0x2, 0x95, 0x96, 0x7, 0x1d, 0x2, 0x2, 0x96, 0x98, 0x5, 
-    0x10, 0x9, 0x2, 0x97, 0x95, 0x3, 0x2, 0x2, 0x2, 0x98, 0x9b, 0x3, 0x2, 
-    0x2, 0x2, 0x99, 0x97, 0x3, 0x2, 0x2, 0x2, 0x99, 0x9a, 0x3, 0x2, 0x2, 
-    0x2, 0x9a, 0xf, 0x3, 0x2, 0x2, 0x2, 0x9b, 0x99, 0x3, 0x2, 0x2, 0x2, 
-    0x9c, 0x9d, 0x7, 0x30, 0x2, 0x2, 0x9d, 0x9e, 0x5, 0x12, 0xa, 0x2, 0x9e, 
-    0x11, 0x3, 0x2, 0x2, 0x2, 0x9f, 0xa6, 0x7, 0x1e, 0x2, 0x2, 0xa0, 0xa1, 
-    0x7, 0x1f, 0x2, 0x2, 0xa1, 0xa2, 0x7, 0x9, 0x2, 0x2, 0xa2, 0xa3, 0x7, 
-    0x31, 0x2, 0x2, 0xa3, 0xa6, 0x7, 0xa, 0x2, 0x2, 0xa4, 0xa6, 0x7, 0x20, 
-    0x2, 0x2, 0xa5, 0x9f, 0x3, 0x2, 0x2, 0x2, 0xa5, 0xa0, 0x3, 0x2, 0x2, 
-    0x2, 0xa5, 0xa4, 0x3, 0x2, 0x2, 0x2, 0xa6, 0x13, 0x3, 0x2, 0x2, 0x2, 
-    0xa7, 0xac, 0x5, 0x16, 0xc, 0x2, 0xa8, 0xa9, 0x7, 0x1d, 0x2, 0x2, 0xa9, 
-    0xab, 0x5, 0x16, 0xc, 0x2, 0xaa, 0xa8, 0x3, 0x2, 0x2, 0x2, 0xab, 0xae, 
-    0x3, 0x2, 0x2, 0x2, 0xac, 0xaa, 0x3, 0x2, 0x2, 0x2, 0xac, 0xad, 0x3, 
-    0x2, 0x2, 0x2, 0xad, 0x15, 0x3, 0x2, 0x2, 0x2, 0xae, 0xac, 0x3, 0x2, 
-    0x2, 0x2, 0xaf, 0xb0, 0x7, 0x9, 0x2, 0x2, 0xb0, 0xb5, 0x5, 0x18, 0xd, 
-    0x2, 0xb1, 0xb2, 0x7, 0x1d, 0x2, 0x2, 0xb2, 0xb4, 0x5, 0x18, 0xd, 0x2, 
-    0xb3, 0xb1, 0x3, 0x2, 0x2, 0x2, 0xb4, 0xb7, 0x3, 0x2, 0x2, 0x2, 0xb5, 
-    0xb3, 0x3, 0x2, 0x2, 0x2, 0xb5, 0xb6, 0x3, 0x2, 0x2, 0x2, 0xb6, 0xb8, 
-    0x3, 0x2, 0x2, 0x2, 0xb7, 0xb5, 0x3, 0x2, 0x2, 0x2, 0xb8, 0xb9, 0x7, 
-    0xa, 0x2, 0x2, 0xb9, 0x17, 0x3, 0x2, 0x2, 0x2, 0xba, 0xbb, 0x9, 0x2, 
-    0x2, 0x2, 0xbb, 0x19, 0x3, 0x2, 0x2, 0x2, 0xbc, 0xc1, 0x5, 0x1c, 0xf, 
-    0x2, 0xbd, 0xbe, 0x7, 0x21, 0x2, 0x2, 0xbe, 0xc0, 0x5, 0x1c, 0xf, 0x2, 
-    0xbf, 0xbd, 0x3, 0x2, 0x2, 0x2, 0xc0, 0xc3, 0x3, 0x2, 0x2, 0x2, 0xc1, 
-    0xbf, 0x3, 0x2, 0x2, 0x2, 0xc1, 0xc2, 0x3, 0x2, 0x2, 0x2, 0xc2, 0x1b, 
-    0x3, 0x2, 0x2, 0x2, 0xc3, 0xc1, 0x3, 0x2, 0x2, 0x2, 0xc4, 0xc5, 0x5, 
-    0x1e, 0x10, 0x2, 0xc5, 0xc6, 0x5, 0x2a, 0x16, 0x2, 0xc6, 0xc7, 0x5, 
-    0x20, 0x11, 0x2, 0xc7, 0x1d, 0x3, 0x2, 0x2, 0x2, 0xc8, 0xc9, 0x7, 0x30, 
-    0x2, 0x2, 0xc9, 0xca, 0x7, 0x22, 0x2, 0x2, 0xca, 0xcb, 0x7, 0x30, 0x2, 
-    0x2, 0xcb, 0x1f, 0x3, 0x2, 0x2, 0x2, 0xcc, 0xcf, 0x5, 0x18, 0xd, 0x2, 
-    0xcd, 0xcf, 0x5, 0x1e, 0x10, 0x2, 0xce, 0xcc, 0x3, 0x2, 0x2, 0x2, 0xce, 
-    0xcd, 0x3, 0x2, 0x2, 0x2, 0xcf, 0x21, 0x3, 0x2, 0x2, 0x2, 0xd0, 0xd1, 
-    0x7, 0x30, 0x2, 0x2, 0xd1, 0xd2, 0x7, 0x24, 0x2, 0x2, 0xd2, 0xd9, 0x5, 
-    0x18, 0xd, 0x2, 0xd3, 0xd4, 0x7, 0x1d, 0x2, 0x2, 0xd4, 0xd5, 0x7, 0x30, 
-    0x2, 0x2, 0xd5, 0xd6, 0x7, 0x24, 0x2, 0x2, 0xd6, 0xd8, 0x5, 0x18, 0xd, 
-    0x2, 0xd7, 0xd3, 0x3, 0x2, 0x2, 0x2, 0xd8, 0xdb, 0x3, 0x2, 0x2, 0x2, 
-    0xd9, 0xd7, 0x3, 0x2, 0x2, 0x2, 0xd9, 0xda, 0x3, 0x2, 0x2, 0x2, 0xda, 
-    0x23, 0x3, 0x2, 0x2, 0x2, 0xdb, 0xd9, 0x3, 0x2, 0x2, 0x2, 0xdc, 0xe6, 
-    0x7, 0x23, 0x2, 0x2, 0xdd, 0xe2, 0x5, 0x26, 0x14, 0x2, 0xde, 0xdf, 0x7, 
-    0x1d, 0x2, 0x2, 0xdf, 0xe1, 0x5, 0x26, 0x14, 0x2, 0xe0, 0xde, 0x3, 0x2, 
-    0x2, 0x2, 0xe1, 0xe4, 0x3, 0x2, 0x2, 0x2, 0xe2, 0xe0, 0x3, 0x2, 0x2, 
-    0x2, 0xe2, 0xe3, 0x3, 0x2, 0x2, 0x2, 0xe3, 0xe6, 0x3, 0x2, 0x2, 0x2, 
-    0xe4, 0xe2, 0x3, 0x2, 0x2, 0x2, 0xe5, 0xdc, 0x3, 0x2, 0x2, 0x2, 0xe5, 
-    0xdd, 0x3, 0x2, 0x2, 0x2, 0xe6, 0x25, 0x3, 0x2, 0x2, 0x2, 0xe7, 0xf2, 
-    0x5, 0x1e, 0x10, 0x2, 0xe8, 0xe9, 0x5, 0x2c, 0x17, 0x2, 0xe9, 0xea, 
-    0x7, 0x9, 0x2, 0x2, 0xea, 0xeb, 0x5, 0x1e, 0x10, 0x2, 0xeb, 0xec, 0x7, 
-    0xa, 0x2, 0x2, 0xec, 0xf2, 0x3, 0x2, 0x2, 0x2, 0xed, 0xee, 0x7, 0x2a, 
-    0x2, 0x2, 0xee, 0xef, 0x7, 0x9, 0x2, 0x2, 0xef, 0xf0, 0x7, 0x23, 0x2, 
-    0x2, 0xf0, 0xf2, 0x7, 0xa, 0x2, 0x2, 0xf1, 0xe7, 0x3, 0x2, 0x2, 0x2, 
-    0xf1, 0xe8, 0x3, 0x2, 0x2, 0x2, 0xf1, 0xed, 0x3, 0x2, 0x2, 0x2, 0xf2, 
-    0x27, 0x3, 0x2, 0x2, 0x2, 0xf3, 0xf8, 0x7, 0x30, 0x2, 0x2, 0xf4, 0xf5, 
-    0x7, 0x1d, 0x2, 0x2, 0xf5, 0xf7, 0x7, 0x30, 0x2, 0x2, 0xf6, 0xf4, 0x3, 
-    0x2, 0x2, 0x2, 0xf7, 0xfa, 0x3, 0x2, 0x2, 0x2, 0xf8, 0xf6, 0x3, 0x2, 
-    0x2, 0x2, 0xf8, 0xf9, 0x3, 0x2, 0x2, 0x2, 0xf9, 0x29, 0x3, 0x2, 0x2, 
-    0x2, 0xfa, 0xf8, 0x3, 0x2, 0x2, 0x2, 0xfb, 0xfc, 0x9, 0x3, 0x2, 0x2, 
-    0xfc, 0x2b, 0x3, 0x2, 0x2, 0x2, 0xfd, 0xfe, 0x9, 0x4, 0x2, 0x2, 0xfe, 
-    0x2d, 0x3, 0x2, 0x2, 0x2, 0x16, 0x31, 0x43, 0x49, 0x69, 0x71, 0x76, 
-    0x7c, 0x7e, 0x92, 0x99, 0xa5, 0xac, 0xb5, 0xc1, 0xce, 0xd9, 0xe2, 0xe5, 
-    0xf1, 0xf8, 
+    0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x5, 
+    0x5, 0x73, 0xa, 0x5, 0x3, 0x5, 0x3, 0x5, 0x3, 0x5, 0x5, 0x5, 0x78, 0xa, 
+    0x5, 0x3, 0x6, 0x3, 0x6, 0x3, 0x6, 0x3, 0x6, 0x3, 0x6, 0x3, 0x6, 0x5, 
+    0x6, 0x80, 0xa, 0x6, 0x3, 0x6, 0x3, 0x6, 0x3, 0x6, 0x5, 0x6, 0x85, 0xa, 
+    0x6, 0x3, 0x6, 0x3, 0x6, 0x3, 0x6, 0x3, 0x6, 0x5, 0x6, 0x8b, 0xa, 0x6, 
+    0x5, 0x6, 0x8d, 0xa, 0x6, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 
+    0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 
+    0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x5, 
+    0x7, 0xa1, 0xa, 0x7, 0x3, 0x8, 0x3, 0x8, 0x3, 0x8, 0x7, 0x8, 0xa6, 0xa, 
+    0x8, 0xc, 0x8, 0xe, 0x8, 0xa9, 0xb, 0x8, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 
+    0x3, 0xa, 0x3, 0xa, 0x3, 0xa, 0x3, 0xa, 0x3, 0xa, 0x3, 0xa, 0x3, 0xa, 
+    0x3, 0xa, 0x3, 0xa, 0x5, 0xa, 0xb7, 0xa, 0xa, 0x3, 0xb, 0x3, 0xb, 0x3, 
+    0xb, 0x3, 0xb, 0x3, 0xb, 0x3, 0xc, 0x3, 0xc, 0x3, 0xc, 0x7, 0xc, 0xc1, 
+    0xa, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc4, 0xb, 0xc, 0x3, 0xd, 0x3, 0xd, 0x3, 
+    0xd, 0x3, 0xd, 0x7, 0xd, 0xca, 0xa, 0xd, 0xc, 0xd, 0xe, 0xd, 0xcd, 0xb, 
+    0xd, 0x3, 0xd, 0x3, 0xd, 0x3, 0xe, 0x3, 0xe, 0x3, 0xf, 0x3, 0xf, 0x3, 
+    0xf, 0x7, 0xf, 0xd6, 0xa, 0xf, 0xc, 0xf, 0xe, 0xf, 0xd9, 0xb, 0xf, 0x3, 
+    0x10, 0x3, 0x10, 0x3, 0x10, 0x3, 0x10, 0x3, 0x11, 0x3, 0x11, 0x3, 0x11, 
+    0x3, 0x11, 0x3, 0x12, 0x3, 0x12, 0x5, 0x12, 0xe5, 0xa, 0x12, 0x3, 0x13, 
+    0x3, 0x13, 0x3, 0x13, 0x3, 0x13, 0x3, 0x13, 0x3, 0x13, 0x3, 0x13, 0x7, 
+    0x13, 0xee, 0xa, 0x13, 0xc, 0x13, 0xe, 0x13, 0xf1, 0xb, 0x13, 0x3, 0x14, 
+    0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 0x7, 0x14, 0xf7, 0xa, 0x14, 0xc, 0x14, 
+    0xe, 0x14, 0xfa, 0xb, 0x14, 0x5, 0x14, 0xfc, 0xa, 0x14, 0x3, 0x15, 0x3, 
+    0x15, 0x3, 0x15, 0x3, 0x15, 0x3, 0x15, 0x3, 0x15, 0x3, 0x15, 0x3, 0x15, 
+    0x3, 0x15, 0x3, 0x15, 0x5, 0x15, 0x108, 0xa, 0x15, 0x3, 0x16, 0x3, 0x16, 
+    0x3, 0x16, 0x7, 0x16, 0x10d, 0xa, 0x16, 0xc, 0x16, 0xe, 0x16, 0x110, 
+    0xb, 0x16, 0x3, 0x17, 0x3, 0x17, 0x3, 0x18, 0x3, 0x18, 0x3, 0x18, 0x2, 
+    0x2, 0x19, 0x2, 0x4, 0x6, 0x8, 0xa, 0xc, 0xe, 0x10, 0x12, 0x14, 0x16, 
+    0x18, 0x1a, 0x1c, 0x1e, 0x20, 0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2e, 
+    0x2, 0x5, 0x4, 0x2, 0x37, 0x37, 0x39, 0x3b, 0x3, 0x2, 0x2c, 0x31, 0x3, 
+    0x2, 0x32, 0x36, 0x2, 0x123, 0x2, 0x33, 0x3, 0x2, 0x2, 0x2, 0x4, 0x45, 
+    0x3, 0x2, 0x2, 0x2, 0x6, 0x4b, 0x3, 0x2, 0x2, 0x2, 0x8, 0x77, 0x3, 0x2, 
+    0x2, 0x2, 0xa, 0x79, 0x3, 0x2, 0x2, 0x2, 0xc, 0xa0, 0x3, 0x2, 0x2, 0x2, 
+    0xe, 0xa2, 0x3, 0x2, 0x2, 0x2, 0x10, 0xaa, 0x3, 0x2, 0x2, 0x2, 0x12, 
+    0xb6, 0x3, 0x2, 0x2, 0x2, 0x14, 0xb8, 0x3, 0x2, 0x2, 0x2, 0x16, 0xbd, 
+    0x3, 0x2, 0x2, 0x2, 0x18, 0xc5, 0x3, 0x2, 0x2, 0x2, 0x1a, 0xd0, 0x3, 
+    0x2, 0x2, 0x2, 0x1c, 0xd2, 0x3, 0x2, 0x2, 0x2, 0x1e, 0xda, 0x3, 0x2, 
+    0x2, 0x2, 0x20, 0xde, 0x3, 0x2, 0x2, 0x2, 0x22, 0xe4, 0x3, 0x2, 0x2, 
+    0x2, 0x24, 0xe6, 0x3, 0x2, 0x2, 0x2, 0x26, 0xfb, 0x3, 0x2, 0x2, 0x2, 
+    0x28, 0x107, 0x3, 0x2, 0x2, 0x2, 0x2a, 0x109, 0x3, 0x2, 0x2, 0x2, 0x2c, 
+    0x111, 0x3, 0x2, 0x2, 0x2, 0x2e, 0x113, 0x3, 0x2, 0x2, 0x2, 0x30, 0x32, 
+    0x5, 0x4, 0x3, 0x2, 0x31, 0x30, 0x3, 0x2, 0x2, 0x2, 0x32, 0x35, 0x3, 
+    0x2, 0x2, 0x2, 0x33, 0x31, 0x3, 0x2, 0x2, 0x2, 0x33, 0x34, 0x3, 0x2, 
+    0x2, 0x2, 0x34, 0x36, 0x3, 0x2, 0x2, 0x2, 0x35, 0x33, 0x3, 0x2, 0x2, 
+    0x2, 0x36, 0x37, 0x7, 0x2, 0x2, 0x3, 0x37, 0x3, 0x3, 0x2, 0x2, 0x2, 
+    0x38, 0x39, 0x5, 0x6, 0x4, 0x2, 0x39, 0x3a, 0x7, 0x3, 0x2, 0x2, 0x3a, 
+    0x46, 0x3, 0x2, 0x2, 0x2, 0x3b, 0x3c, 0x5, 0x8, 0x5, 0x2, 0x3c, 0x3d, 
+    0x7, 0x3, 0x2, 0x2, 0x3d, 0x46, 0x3, 0x2, 0x2, 0x2, 0x3e, 0x3f, 0x5, 
+    0xc, 0x7, 0x2, 0x3f, 0x40, 0x7, 0x3, 0x2, 0x2, 0x40, 0x46, 0x3, 0x2, 
+    0x2, 0x2, 0x41, 0x42, 0x7, 0x3d, 0x2, 0x2, 0x42, 0x46, 0x7, 0x3, 0x2, 
+    0x2, 0x43, 0x44, 0x7, 0x37, 0x2, 0x2, 0x44, 0x46, 0x7, 0x3, 0x2, 0x2, 
+    0x45, 0x38, 0x3, 0x2, 0x2, 0x2, 0x45, 0x3b, 0x3, 0x2, 0x2, 0x2, 0x45, 
+    0x3e, 0x3, 0x2, 0x2, 0x2, 0x45, 0x41, 0x3, 0x2, 0x2, 0x2, 0x45, 0x43, 
+    0x3, 0x2, 0x2, 0x2, 0x46, 0x5, 0x3, 0x2, 0x2, 0x2, 0x47, 0x48, 0x7, 
+    0x4, 0x2, 0x2, 0x48, 0x4c, 0x7, 0x5, 0x2, 0x2, 0x49, 0x4a, 0x7, 0x4, 
+    0x2, 0x2, 0x4a, 0x4c, 0x7, 0x6, 0x2, 0x2, 0x4b, 0x47, 0x3, 0x2, 0x2, 
+    0x2, 0x4b, 0x49, 0x3, 0x2, 0x2, 0x2, 0x4c, 0x7, 0x3, 0x2, 0x2, 0x2, 
+    0x4d, 0x4e, 0x7, 0x7, 0x2, 0x2, 0x4e, 0x4f, 0x7, 0x8, 0x2, 0x2, 0x4f, 
+    0x50, 0x7, 0x38, 0x2, 0x2, 0x50, 0x51, 0x7, 0x9, 0x2, 0x2, 0x51, 0x52, 
+    0x5, 0xe, 0x8, 0x2, 0x52, 0x54, 0x7, 0xa, 0x2, 0x2, 0x53, 0x55, 0x5, 
+    0x14, 0xb, 0x2, 0x54, 0x53, 0x3, 0x2, 0x2, 0x2, 0x54, 0x55, 0x3, 0x2, 
+    0x2, 0x2, 0x55, 0x78, 0x3, 0x2, 0x2, 0x2, 0x56, 0x57, 0x7, 0xb, 0x2, 
+    0x2, 0x57, 0x58, 0x7, 0x8, 0x2, 0x2, 0x58, 0x78, 0x7, 0x38, 0x2, 0x2, 
+    0x59, 0x5a, 0x7, 0xc, 0x2, 0x2, 0x5a, 0x78, 0x7, 0x38, 0x2, 0x2, 0x5b, 
+    0x5c, 0x7, 0xd, 0x2, 0x2, 0x5c, 0x5d, 0x7, 0xe, 0x2, 0x2, 0x5d, 0x5e, 
+    0x7, 0x38, 0x2, 0x2, 0x5e, 0x5f, 0x7, 0xf, 0x2, 0x2, 0x5f, 0x78, 0x5, 
+    0x16, 0xc, 0x2, 0x60, 0x61, 0x7, 0x10, 0x2, 0x2, 0x61, 0x62, 0x7, 0x11, 
+    0x2, 0x2, 0x62, 0x63, 0x7, 0x38, 0x2, 0x2, 0x63, 0x64, 0x7, 0x12, 0x2, 
+    0x2, 0x64, 0x78, 0x5, 0x1c, 0xf, 0x2, 0x65, 0x66, 0x7, 0x13, 0x2, 0x2, 
+    0x66, 0x67, 0x7, 0x38, 0x2, 0x2, 0x67, 0x68, 0x7, 0x14, 0x2, 0x2, 0x68, 
+    0x69, 0x5, 0x24, 0x13, 0x2, 0x69, 0x6a, 0x7, 0x12, 0x2, 0x2, 0x6a, 0x6b, 
+    0x5, 0x1c, 0xf, 0x2, 0x6b, 0x78, 0x3, 0x2, 0x2, 0x2, 0x6c, 0x6d, 0x7, 
+    0x15, 0x2, 0x2, 0x6d, 0x6e, 0x7, 0x38, 0x2, 0x2, 0x6e, 0x6f, 0x7, 0x11, 
+    0x2, 0x2, 0x6f, 0x72, 0x7, 0x3a, 0x2, 0x2, 0x70, 0x71, 0x7, 0x16, 0x2, 
+    0x2, 0x71, 0x73, 0x7, 0x3a, 0x2, 0x2, 0x72, 0x70, 0x3, 0x2, 0x2, 0x2, 
+    0x72, 0x73, 0x3, 0x2, 0x2, 0x2, 0x73, 0x78, 0x3, 0x2, 0x2, 0x2, 0x74, 
+    0x75, 0x7, 0x17, 0x2, 0x2, 0x75, 0x78, 0x7, 0x38, 0x2, 0x2, 0x76, 0x78, 
+    0x5, 0xa, 0x6, 0x2, 0x77, 0x4d, 0x3, 0x2, 0x2, 0x2, 0x77, 0x56, 0x3, 
+    0x2, 0x2, 0x2, 0x77, 0x59, 0x3, 0x2, 0x2, 0x2, 0x77, 0x5b, 0x3, 0x2, 
+    0x2, 0x2, 0x77, 0x60, 0x3, 0x2, 0x2, 0x2, 0x77, 0x65, 0x3, 0x2, 0x2, 
+    0x2, 0x77, 0x6c, 0x3, 0x2, 0x2, 0x2, 0x77, 0x74, 0x3, 0x2, 0x2, 0x2, 
+    0x77, 0x76, 0x3, 0x2, 0x2, 0x2, 0x78, 0x9, 0x3, 0x2, 0x2, 0x2, 0x79, 
+    0x7a, 0x7, 0x18, 0x2, 0x2, 0x7a, 0x7b, 0x5, 0x26, 0x14, 0x2, 0x7b, 0x7c, 
+    0x7, 0x11, 0x2, 0x2, 0x7c, 0x7f, 0x5, 0x2a, 0x16, 0x2, 0x7d, 0x7e, 0x7, 
+    0x12, 0x2, 0x2, 0x7e, 0x80, 0x5, 0x1c, 0xf, 0x2, 0x7f, 0x7d, 0x3, 0x2, 
+    0x2, 0x2, 0x7f, 0x80, 0x3, 0x2, 0x2, 0x2, 0x80, 0x84, 0x3, 0x2, 0x2, 
+    0x2, 0x81, 0x82, 0x7, 0x19, 0x2, 0x2, 0x82, 0x83, 0x7, 0x1a, 0x2, 0x2, 
+    0x83, 0x85, 0x5, 0x20, 0x11, 0x2, 0x84, 0x81, 0x3, 0x2, 0x2, 0x2, 0x84, 
+    0x85, 0x3, 0x2, 0x2, 0x2, 0x85, 0x8c, 0x3, 0x2, 0x2, 0x2, 0x86, 0x87, 
+    0x7, 0x1b, 0x2, 0x2, 0x87, 0x8a, 0x7, 0x39, 0x2, 0x2, 0x88, 0x89, 0x7, 
+    0x1c, 0x2, 0x2, 0x89, 0x8b, 0x7, 0x39, 0x2, 0x2, 0x8a, 0x88, 0x3, 0x2, 
+    0x2, 0x2, 0x8a, 0x8b, 0x3, 0x2, 0x2, 0x2, 0x8b, 0x8d, 0x3, 0x2, 0x2, 
+    0x2, 0x8c, 0x86, 0x3, 0x2, 0x2, 0x2, 0x8c, 0x8d, 0x3, 0x2, 0x2, 0x2, 
+    0x8d, 0xb, 0x3, 0x2, 0x2, 0x2, 0x8e, 0x8f, 0x7, 0x1d, 0x2, 0x2, 0x8f, 
+    0x90, 0x7, 0x8, 0x2, 0x2, 0x90, 0x91, 0x7, 0x38, 0x2, 0x2, 0x91, 0x92, 
+    0x7, 0x1e, 0x2, 0x2, 0x92, 0x93, 0x7, 0x1f, 0x2, 0x2, 0x93, 0x94, 0x7, 
+    0x9, 0x2, 0x2, 0x94, 0x95, 0x5, 0x2a, 0x16, 0x2, 0x95, 0x96, 0x7, 0xa, 
+    0x2, 0x2, 0x96, 0xa1, 0x3, 0x2, 0x2, 0x2, 0x97, 0x98, 0x7, 0x1d, 0x2, 
+    0x2, 0x98, 0x99, 0x7, 0x8, 0x2, 0x2, 0x99, 0x9a, 0x7, 0x38, 0x2, 0x2, 
+    0x9a, 0x9b, 0x7, 0xb, 0x2, 0x2, 0x9b, 0x9c, 0x7, 0x1f, 0x2, 0x2, 0x9c, 
+    0x9d, 0x7, 0x9, 0x2, 0x2, 0x9d, 0x9e, 0x5, 0x2a, 0x16, 0x2, 0x9e, 0x9f, 
+    0x7, 0xa, 0x2, 0x2, 0x9f, 0xa1, 0x3, 0x2, 0x2, 0x2, 0xa0, 0x8e, 0x3, 
+    0x2, 0x2, 0x2, 0xa0, 0x97, 0x3, 0x2, 0x2, 0x2, 0xa1, 0xd, 0x3, 0x2, 
+    0x2, 0x2, 0xa2, 0xa7, 0x5, 0x10, 0x9, 0x2, 0xa3, 0xa4, 0x7, 0x20, 0x2, 
+    0x2, 0xa4, 0xa6, 0x5, 0x10, 0x9, 0x2, 0xa5, 0xa3, 0x3, 0x2, 0x2, 0x2, 
+    0xa6, 0xa9, 0x3, 0x2, 0x2, 0x2, 0xa7, 0xa5, 0x3, 0x2, 0x2, 0x2, 0xa7, 
+    0xa8, 0x3, 0x2, 0x2, 0x2, 0xa8, 0xf, 0x3, 0x2, 0x2, 0x2, 0xa9, 0xa7, 
+    0x3, 0x2, 0x2, 0x2, 0xaa, 0xab, 0x7, 0x38, 0x2, 0x2, 0xab, 0xac, 0x5, 
+    0x12, 0xa, 0x2, 0xac, 0x11, 0x3, 0x2, 0x2, 0x2, 0xad, 0xb7, 0x7, 0x21, 
+    0x2, 0x2, 0xae, 0xaf, 0x7, 0x22, 0x2, 0x2, 0xaf, 0xb0, 0x7, 0x9, 0x2, 
+    0x2, 0xb0, 0xb1, 0x7, 0x39, 0x2, 0x2, 0xb1, 0xb7, 0x7, 0xa, 0x2, 0x2, 
+    0xb2, 0xb7, 0x7, 0x23, 0x2, 0x2, 0xb3, 0xb7, 0x7, 0x24, 0x2, 0x2, 0xb4, 
+    0xb7, 0x7, 0x25, 0x2, 0x2, 0xb5, 0xb7, 0x7, 0x26, 0x2, 0x2, 0xb6, 0xad, 
+    0x3, 0x2, 0x2, 0x2, 0xb6, 0xae, 0x3, 0x2, 0x2, 0x2, 0xb6, 0xb2, 0x3, 
+    0x2, 0x2, 0x2, 0xb6, 0xb3, 0x3, 0x2, 0x2, 0x2, 0xb6, 0xb4, 0x3, 0x2, 
+    0x2, 0x2, 0xb6, 0xb5, 0x3, 0x2, 0x2, 0x2, 0xb7, 0x13, 0x3, 0x2, 0x2, 
+    0x2, 0xb8, 0xb9, 0x7, 0x27, 0x2, 0x2, 0xb9, 0xba, 0x7, 0x28, 0x2, 0x2, 
+    0xba, 0xbb, 0x7, 0x2c, 0x2, 0x2, 0xbb, 0xbc, 0x7, 0x38, 0x2, 0x2, 0xbc, 
+    0x15, 0x3, 0x2, 0x2, 0x2, 0xbd, 0xc2, 0x5, 0x18, 0xd, 0x2, 0xbe, 0xbf, 
+    0x7, 0x20, 0x2, 0x2, 0xbf, 0xc1, 0x5, 0x18, 0xd, 0x2, 0xc0, 0xbe, 0x3, 
+    0x2, 0x2, 0x2, 0xc1, 0xc4, 0x3, 0x2, 0x2, 0x2, 0xc2, 0xc0, 0x3, 0x2, 
+    0x2, 0x2, 0xc2, 0xc3, 0x3, 0x2, 0x2, 0x2, 0xc3, 0x17, 0x3, 0x2, 0x2, 
+    0x2, 0xc4, 0xc2, 0x3, 0x2, 0x2, 0x2, 0xc5, 0xc6, 0x7, 0x9, 0x2, 0x2, 
+    0xc6, 0xcb, 0x5, 0x1a, 0xe, 0x2, 0xc7, 0xc8, 0x7, 0x20, 0x2, 0x2, 0xc8, 
+    0xca, 0x5, 0x1a, 0xe, 0x2, 0xc9, 0xc7, 0x3, 0x2, 0x2, 0x2, 0xca, 0xcd, 
+    0x3, 0x2, 0x2, 0x2, 0xcb, 0xc9, 0x3, 0x2, 0x2, 0x2, 0xcb, 0xcc, 0x3, 
+    0x2, 0x2, 0x2, 0xcc, 0xce, 0x3, 0x2, 0x2, 0x2, 0xcd, 0xcb, 0x3, 0x2, 
+    0x2, 0x2, 0xce, 0xcf, 0x7, 0xa, 0x2, 0x2, 0xcf, 0x19, 0x3, 0x2, 0x2, 
+    0x2, 0xd0, 0xd1, 0x9, 0x2, 0x2, 0x2, 0xd1, 0x1b, 0x3, 0x2, 0x2, 0x2, 
+    0xd2, 0xd7, 0x5, 0x1e, 0x10, 0x2, 0xd3, 0xd4, 0x7, 0x29, 0x2, 0x2, 0xd4, 
+    0xd6, 0x5, 0x1e, 0x10, 0x2, 0xd5, 0xd3, 0x3, 0x2, 0x2, 0x2, 0xd6, 0xd9, 
+    0x3, 0x2, 0x2, 0x2, 0xd7, 0xd5, 0x3, 0x2, 0x2, 0x2, 0xd7, 0xd8, 0x3, 
+    0x2, 0x2, 0x2, 0xd8, 0x1d, 0x3, 0x2, 0x2, 0x2, 0xd9, 0xd7, 0x3, 0x2, 
+    0x2, 0x2, 0xda, 0xdb, 0x5, 0x20, 0x11, 0x2, 0xdb, 0xdc, 0x5, 0x2c, 0x17, 
+    0x2, 0xdc, 0xdd, 0x5, 0x22, 0x12, 0x2, 0xdd, 0x1f, 0x3, 0x2, 0x2, 0x2, 
+    0xde, 0xdf, 0x7, 0x38, 0x2, 0x2, 0xdf, 0xe0, 0x7, 0x2a, 0x2, 0x2, 0xe0, 
+    0xe1, 0x7, 0x38, 0x2, 0x2, 0xe1, 0x21, 0x3, 0x2, 0x2, 0x2, 0xe2, 0xe5, 
+    0x5, 0x1a, 0xe, 0x2, 0xe3, 0xe5, 0x5, 0x20, 0x11, 0x2, 0xe4, 0xe2, 0x3, 
+    0x2, 0x2, 0x2, 0xe4, 0xe3, 0x3, 0x2, 0x2, 0x2, 0xe5, 0x23, 0x3, 0x2, 
+    0x2, 0x2, 0xe6, 0xe7, 0x7, 0x38, 0x2, 0x2, 0xe7, 0xe8, 0x7, 0x2c, 0x2, 
+    0x2, 0xe8, 0xef, 0x5, 0x1a, 0xe, 0x2, 0xe9, 0xea, 0x7, 0x20, 0x2, 0x2, 
+    0xea, 0xeb, 0x7, 0x38, 0x2, 0x2, 0xeb, 0xec, 0x7, 0x2c, 0x2, 0x2, 0xec, 
+    0xee, 0x5, 0x1a, 0xe, 0x2, 0xed, 0xe9, 0x3, 0x2, 0x2, 0x2, 0xee, 0xf1, 
+    0x3, 0x2, 0x2, 0x2, 0xef, 0xed, 0x3, 0x2, 0x2, 0x2, 0xef, 0xf0, 0x3, 
+    0x2, 0x2, 0x2, 0xf0, 0x25, 0x3, 0x2, 0x2, 0x2, 0xf1, 0xef, 0x3, 0x2, 
+    0x2, 0x2, 0xf2, 0xfc, 0x7, 0x2b, 0x2, 0x2, 0xf3, 0xf8, 0x5, 0x28, 0x15, 
+    0x2, 0xf4, 0xf5, 0x7, 0x20, 0x2, 0x2, 0xf5, 0xf7, 0x5, 0x28, 0x15, 0x2, 
+    0xf6, 0xf4, 0x3, 0x2, 0x2, 0x2, 0xf7, 0xfa, 0x3, 0x2, 0x2, 0x2, 0xf8, 
+    0xf6, 0x3, 0x2, 0x2, 0x2, 0xf8, 0xf9, 0x3, 0x2, 0x2, 0x2, 0xf9, 0xfc, 
+    0x3, 0x2, 0x2, 0x2, 0xfa, 0xf8, 0x3, 0x2, 0x2, 0x2, 0xfb, 0xf2, 0x3, 
+    0x2, 0x2, 0x2, 0xfb, 0xf3, 0x3, 0x2, 0x2, 0x2, 0xfc, 0x27, 0x3, 0x2, 
+    0x2, 0x2, 0xfd, 0x108, 0x5, 0x20, 0x11, 0x2, 0xfe, 0xff, 0x5, 0x2e, 
+    0x18, 0x2, 0xff, 0x100, 0x7, 0x9, 0x2, 0x2, 0x100, 0x101, 0x5, 0x20, 
+    0x11, 0x2, 0x101, 0x102, 0x7, 0xa, 0x2, 0x2, 0x102, 0x108, 0x3, 0x2, 
+    0x2, 0x2, 0x103, 0x104, 0x7, 0x32, 0x2, 0x2, 0x104, 0x105, 0x7, 0x9, 
+    0x2, 0x2, 0x105, 0x106, 0x7, 0x2b, 0x2, 0x2, 0x106, 0x108, 0x7, 0xa, 
+    0x2, 0x2, 0x107, 0xfd, 0x3, 0x2, 0x2, 0x2, 0x107, 0xfe, 0x3, 0x2, 0x2, 
+    0x2, 0x107, 0x103, 0x3, 0x2, 0x2, 0x2, 0x108, 0x29, 0x3, 0x2, 0x2, 0x2, 
+    0x109, 0x10e, 0x7, 0x38, 0x2, 0x2, 0x10a, 0x10b, 0x7, 0x20, 0x2, 0x2, 
+    0x10b, 0x10d, 0x7, 0x38, 0x2, 0x2, 0x10c, 0x10a, 0x3, 0x2, 0x2, 0x2, 
+    0x10d, 0x110, 0x3, 0x2, 0x2, 0x2, 0x10e, 0x10c, 0x3, 0x2, 0x2, 0x2, 
+    0x10e, 0x10f, 0x3, 0x2, 0x2, 0x2, 0x10f, 0x2b, 0x3, 0x2, 0x2, 0x2, 0x110, 
+    0x10e, 0x3, 0x2, 0x2, 0x2, 0x111, 0x112, 0x9, 0x3, 0x2, 0x2, 0x112, 
+    0x2d, 0x3, 0x2, 0x2, 0x2, 0x113, 0x114, 0x9, 0x4, 0x2, 0x2, 0x114, 0x2f, 
+    0x3, 0x2, 0x2, 0x2, 0x18, 0x33, 0x45, 0x4b, 0x54, 0x72, 0x77, 0x7f, 
+    0x84, 0x8a, 0x8c, 0xa0, 0xa7, 0xb6, 0xc2, 0xcb, 0xd7, 0xe4, 0xef, 0xf8, 
+    0xfb, 0x107, 0x10e, 
   };
 
   atn::ATNDeserializer deserializer;
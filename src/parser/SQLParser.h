@@ -17,19 +17,20 @@ public:
     T__14 = 15, T__15 = 16, T__16 = 17, T__17 = 18, T__18 = 19, T__19 = 20, 
     T__20 = 21, T__21 = 22, T__22 = 23, T__23 = 24, T__24 = 25, T__25 = 26, 
     T__26 = 27, T__27 = 28, T__28 = 29, T__29 = 30, T__30 = 31, T__31 = 32, 
-    T__32 = 33, EqualOrAssign = 34, Less = 35, LessEqual = 36, Greater = 37, 
-    GreaterEqual = 38, NotEqual = 39, Count = 40, Average = 41, Max = 42, 
-    Min = 43, Sum = 44, Null = 45, Identifier = 46, Integer = 47, String = 48, 
-    Float = 49, Whitespace = 50, Annotation = 51
+    T__32 = 33, T__33 = 34, T__34 = 35, T__35 = 36, T__36 = 37, T__37 = 38, 
+    T__38 = 39, T__39 = 40, T__40 = 41, EqualOrAssign = 42, Less = 43, LessEqual = 44, 
+    Greater = 45, GreaterEqual = 46, NotEqual = 47, Count = 48, Average = 49, 
+    Max = 50, Min = 51, Sum = 52, Null = 53, Identifier = 54, Integer = 55, 
+    String = 56, Float = 57, Whitespace = 58, Annotation = 59
   };
 
   enum {
     RuleProgram = 0, RuleStatement = 1, RuleDb_statement = 2, RuleTable_statement = 3, 
     RuleSelect_table = 4, RuleIndex_statement = 5, RuleField_list = 6, RuleField = 7, 
-    RuleType_ = 8, RuleValue_lists = 9, RuleValue_list = 10, RuleValue = 11, 
-    RuleWhere_and_clause = 12, RuleWhere_clause = 13, RuleColumn = 14, RuleExpression = 15, 
-    RuleSet_clause = 16, RuleSelectors = 17, RuleSelector = 18, RuleIdentifiers = 19, 
-    RuleOperate = 20, RuleAggregator = 21
+    RuleType_ = 8, RuleTable_layout = 9, RuleValue_lists = 10, RuleValue_list = 11, 
+    RuleValue = 12, RuleWhere_and_clause = 13, RuleWhere_clause = 14, RuleColumn = 15, 
+    RuleExpression = 16, RuleSet_clause = 17, RuleSelectors = 18, RuleSelector = 19, 
+    RuleIdentifiers = 20, RuleOperate = 21, RuleAggregator = 22
   };
 
   SQLParser(antlr4::TokenStream *input);
@@ -51,6 +52,7 @@ public:
   class Field_listContext;
   class FieldContext;
   class Type_Context;
+  class Table_layoutContext;
   class Value_listsContext;
   class Value_listContext;
   class ValueContext;
@@ -137,6 +139,14 @@ public:
    
   };
 
+  class  Vacuum_tableContext : public Table_statementContext {
+  public:
+    Vacuum_tableContext(Table_statementContext *ctx);
+
+    antlr4::tree::TerminalNode *Identifier();
+    virtual antlrcpp::Any accept(antlr4::tree::ParseTreeVisitor *visitor) override;
+  };
+
   class  Delete_from_tableContext : public Table_statementContext {
   public:
     Delete_from_tableContext(Table_statementContext *ctx);
@@ -161,6 +171,7 @@ public:
 
     antlr4::tree::TerminalNode *Identifier();
     Field_listContext *field_list();
+    Table_layoutContext *table_layout();
     virtual antlrcpp::Any accept(antlr4::tree::ParseTreeVisitor *visitor) override;
   };
 
@@ -188,6 +199,16 @@ public:
     virtual antlrcpp::Any accept(antlr4::tree::ParseTreeVisitor *visitor) override;
   };
 
+  class  Copy_from_tableContext : public Table_statementContext {
+  public:
+    Copy_from_tableContext(Table_statementContext *ctx);
+
+    antlr4::tree::TerminalNode *Identifier();
+    std::vector<antlr4::tree::TerminalNode *> String();
+    antlr4::tree::TerminalNode* String(size_t i);
+    virtual antlrcpp::Any accept(antlr4::tree::ParseTreeVisitor *visitor) override;
+  };
+
   class  Update_tableContext : public Table_statementContext {
   public:
     Update_tableContext(Table_statementContext *ctx);
@@ -299,6 +320,19 @@ public:
 
   Type_Context* type_();
 
+  class  Table_layoutContext : public antlr4::ParserRuleContext {
+  public:
+    Table_layoutContext(antlr4::ParserRuleContext *parent, size_t invokingState);
+    virtual size_t getRuleIndex() const override;
+    antlr4::tree::TerminalNode *EqualOrAssign();
+    antlr4::tree::TerminalNode *Identifier();
+
+    virtual antlrcpp::Any accept(antlr4::tree::ParseTreeVisitor *visitor) override;
+   
+  };
+
+  Table_layoutContext* table_layout();
+
   class  Value_listsContext : public antlr4::ParserRuleContext {
   public:
     Value_listsContext(antlr4::ParserRuleContext *parent, size_t invokingState);
@@ -39,6 +39,10 @@ public:
 
     virtual antlrcpp::Any visitUpdate_table(SQLParser::Update_tableContext *context) = 0;
 
+    virtual antlrcpp::Any visitCopy_from_table(SQLParser::Copy_from_tableContext *context) = 0;
+
+    virtual antlrcpp::Any visitVacuum_table(SQLParser::Vacuum_tableContext *context) = 0;
+
     virtual antlrcpp::Any visitSelect_table_(SQLParser::Select_table_Context *context) = 0;
 
     virtual antlrcpp::Any visitSelect_table(SQLParser::Select_tableContext *context) = 0;
@@ -53,6 +57,8 @@ public:
 
     virtual antlrcpp::Any visitType_(SQLParser::Type_Context *context) = 0;
 
+    virtual antlrcpp::Any visitTable_layout(SQLParser::Table_layoutContext *context) = 0;
+
     virtual antlrcpp::Any visitValue_lists(SQLParser::Value_listsContext *context) = 0;
 
     virtual antlrcpp::Any visitValue_list(SQLParser::Value_listContext *context) = 0;
@@ -1,7 +1,11 @@
 #include "SystemVisitor.h"
 
+#include <errno.h>
 #include <float.h>
 #include <stdlib.h>
+#include <strings.h>
+
+#include <chrono>
 
 #include "condition/conditions.h"
 #include "exception/exceptions.h"
@@ -68,11 +72,13 @@ antlrcpp::Any SystemVisitor::visitShow_indexes(
 
 antlrcpp::Any SystemVisitor::visitCreate_table(
     SQLParser::Create_tableContext *ctx) {
+  RecordFormat iFormat = RecordFormat::FIXED_FORMAT;
+  if (ctx->table_layout()) iFormat = ctx->table_layout()->accept(this);
   Size nSize = 0;
   try {
-    Schema iSchema = ctx->field_list()->accept(this);
+    std::vector<Column> iColVec = ctx->field_list()->accept(this);
     String sTableName = ctx->Identifier()->getText();
-    _pDB->CreateTable(sTableName, iSchema);
+    _pDB->CreateTable(sTableName, Schema(iColVec, iFormat));
     nSize = 1;
   } catch (const std::exception &e) {
     std::cerr << e.what() << '\n';
@@ -107,7 +113,20 @@ antlrcpp::Any SystemVisitor::visitField_list(
   for (const auto &it : ctx->field()) {
     iColVec.push_back(it->accept(this));
   }
-  return Schema(iColVec);
+  return iColVec;
+}
+
+// 布局名称不区分大小写，格式随表的元数据页面保存
+antlrcpp::Any SystemVisitor::visitTable_layout(
+    SQLParser::Table_layoutContext *ctx) {
+  String sLayout = ctx->Identifier()->getText();
+  if (strcasecmp(sLayout.c_str(), "ROW") == 0)
+    return RecordFormat::FIXED_FORMAT;
+  if (strcasecmp(sLayout.c_str(), "VARIABLE") == 0)
+    return RecordFormat::VAR_FORMAT;
+  if (strcasecmp(sLayout.c_str(), "COLUMNAR") == 0)
+    return RecordFormat::PAX_FORMAT;
+  throw ParserException("unknown layout " + sLayout);
 }
 
 antlrcpp::Any SystemVisitor::visitNormal_field(
@@ -115,6 +134,12 @@ antlrcpp::Any SystemVisitor::visitNormal_field(
   String sType = ctx->type_()->getText();
   if (sType == "INT") {
     return Column(ctx->Identifier()->getText(), FieldType::INT_TYPE);
+  } else if (sType == "TINYINT") {
+    return Column(ctx->Identifier()->getText(), FieldType::TINYINT_TYPE);
+  } else if (sType == "SMALLINT") {
+    return Column(ctx->Identifier()->getText(), FieldType::SMALLINT_TYPE);
+  } else if (sType == "BIGINT") {
+    return Column(ctx->Identifier()->getText(), FieldType::BIGINT_TYPE);
   } else if (sType == "FLOAT") {
     return Column(ctx->Identifier()->getText(), FieldType::FLOAT_TYPE);
   } else {
@@ -210,9 +235,7 @@ antlrcpp::Any SystemVisitor::visitInsert_into_table(
   std::vector<std::vector<String>> iValueListVec =
       ctx->value_lists()->accept(this);
   String sTableName = ctx->Identifier()->getText();
-  for (const auto &iValueList : iValueListVec) {
-    _pDB->Insert(sTableName, iValueList);
-  }
+  _pDB->InsertBatch(sTableName, iValueListVec);
   Result *res = new MemResult({"Insert"});
   FixedRecord *pRes = new FixedRecord(1, {FieldType::INT_TYPE}, {4});
   pRes->SetField(0, new IntField(iValueListVec.size()));
@@ -220,6 +243,44 @@ antlrcpp::Any SystemVisitor::visitInsert_into_table(
   return res;
 }
 
+// 导入出错时抛出异常，之前的批次已经插入
+antlrcpp::Any SystemVisitor::visitCopy_from_table(
+    SQLParser::Copy_from_tableContext *ctx) {
+  String sTableName = ctx->Identifier()->getText();
+  String sPath = ctx->String(0)->getText();
+  sPath = sPath.substr(1, sPath.size() - 2);
+  char cDelim = ',';
+  if (ctx->String(1)) {
+    String sDelim = ctx->String(1)->getText();
+    if (sDelim.size() != 3)
+      throw ParserException("COPY: expected DELIMITER 'c'");
+    cDelim = sDelim[1];
+  }
+  auto iBegin = std::chrono::steady_clock::now();
+  Size nRows = _pDB->CopyFrom(sTableName, sPath, cDelim);
+  double fSeconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - iBegin)
+          .count();
+  Result *res = new MemResult({"Copy", "Rows/s"});
+  FixedRecord *pRes = new FixedRecord(
+      2, {FieldType::INT_TYPE, FieldType::FLOAT_TYPE}, {4, 8});
+  pRes->SetField(0, new IntField(nRows));
+  pRes->SetField(1, new FloatField(fSeconds > 0 ? nRows / fSeconds : 0));
+  res->PushBack(pRes);
+  return res;
+}
+
+// 有活跃事务时抛出 TableBusyException
+antlrcpp::Any SystemVisitor::visitVacuum_table(
+    SQLParser::Vacuum_tableContext *ctx) {
+  Size nFreed = _pDB->Vacuum(ctx->Identifier()->getText());
+  Result *res = new MemResult({"Vacuum"});
+  FixedRecord *pRes = new FixedRecord(1, {FieldType::INT_TYPE}, {4});
+  pRes->SetField(0, new IntField(nFreed));
+  res->PushBack(pRes);
+  return res;
+}
+
 antlrcpp::Any SystemVisitor::visitSelect_table(
     SQLParser::Select_tableContext *ctx) {
   std::vector<String> iTableNameVec = ctx->identifiers()->accept(this);
@@ -303,6 +364,16 @@ antlrcpp::Any SystemVisitor::visitIdentifiers(
   return iStringVec;
 }
 
+// 整数常量按 int64_t 解析，不是整数或超出范围时返回 false
+static bool ParseInteger(const String &sValue, int64_t &nValue) {
+  char *pEnd = nullptr;
+  errno = 0;
+  long long nVal = strtoll(sValue.c_str(), &pEnd, 10);
+  if (errno == ERANGE || pEnd == sValue.c_str() || *pEnd != '\0') return false;
+  nValue = nVal;
+  return true;
+}
+
 antlrcpp::Any SystemVisitor::visitWhere_operator_expression(
     SQLParser::Where_operator_expressionContext *ctx) {
   std::pair<String, String> iPair = ctx->column()->accept(this);
@@ -315,9 +386,85 @@ antlrcpp::Any SystemVisitor::visitWhere_operator_expression(
         "JOIN", new JoinCondition(iPair.first, iPair.second, iPairB.first,
                                   iPairB.second));
   }
+  if (_pDB->GetColType(iPair.first, iPair.second) == FieldType::STRING_TYPE) {
+    // 字符串按字节比较：v 的后继是 v + '\0'，列长度+1个'\xff'大于列中所有值
+    String sValue = ctx->expression()->value()->getText();
+    if (sValue.size() >= 2 && sValue[0] == '\'')
+      sValue = sValue.substr(1, sValue.size() - 2);
+    String sNext = sValue + '\0';
+    String sMax(_pDB->GetColSize(iPair.first, iPair.second) + 1, '\xff');
+    String sOp = ctx->children[1]->getText();
+    String sLow, sHigh;
+    if (sOp == "<") {
+      sHigh = sValue;
+    } else if (sOp == ">") {
+      sLow = sNext, sHigh = sMax;
+    } else if (sOp == "=") {
+      sLow = sValue, sHigh = sNext;
+    } else if (sOp == "<=") {
+      sHigh = sNext;
+    } else if (sOp == ">=") {
+      sLow = sValue, sHigh = sMax;
+    } else if (sOp == "<>") {
+      return std::pair<String, Condition *>(
+          iPair.first,
+          new NotCondition(
+              new StringRangeCondition(nColIndex, sValue, sNext), nColIndex));
+    } else {
+      throw SpecialException();
+    }
+    if (_pDB->IsIndex(iPair.first, iPair.second)) {
+      return std::pair<String, Condition *>(
+          iPair.first,
+          new IndexCondition(iPair.first, iPair.second, sLow, sHigh));
+    }
+    return std::pair<String, Condition *>(
+        iPair.first, new StringRangeCondition(nColIndex, sLow, sHigh));
+  }
+  // 数值条件按列类型选择值的读取方式
+  FieldType iType = _pDB->GetColType(iPair.first, iPair.second);
+  int64_t nValue;
+  if (IsIntegerType(iType) &&
+      ParseInteger(ctx->expression()->value()->getText(), nValue)) {
+    // 整数常量不经过 double，直接换算为闭区间[nLow, nHigh]，两端都可以取到
+    // INT64_MIN 和 INT64_MAX；nLow > nHigh 表示空区间
+    int64_t nLow = INT64_MIN, nHigh = INT64_MAX;
+    String sOp = ctx->children[1]->getText();
+    if (sOp == "<") {
+      if (nValue == INT64_MIN)
+        nLow = INT64_MAX;
+      else
+        nHigh = nValue - 1;
+    } else if (sOp == ">") {
+      if (nValue == INT64_MAX)
+        nHigh = INT64_MIN;
+      else
+        nLow = nValue + 1;
+    } else if (sOp == "=") {
+      nLow = nValue, nHigh = nValue;
+    } else if (sOp == "<=") {
+      nHigh = nValue;
+    } else if (sOp == ">=") {
+      nLow = nValue;
+    } else if (sOp == "<>") {
+      return std::pair<String, Condition *>(
+          iPair.first,
+          new NotCondition(
+              new RangeCondition(nColIndex, iType, nValue, nValue, true),
+              nColIndex));
+    } else {
+      throw SpecialException();
+    }
+    if (_pDB->IsIndex(iPair.first, iPair.second)) {
+      return std::pair<String, Condition *>(
+          iPair.first, new IndexCondition(iPair.first, iPair.second, nLow,
+                                          nHigh, iType, true));
+    }
+    return std::pair<String, Condition *>(
+        iPair.first, new RangeCondition(nColIndex, iType, nLow, nHigh, true));
+  }
   if (_pDB->IsIndex(iPair.first, iPair.second)) {
     double fValue = stod(ctx->expression()->value()->getText());
-    FieldType iType = _pDB->GetColType(iPair.first, iPair.second);
     if (ctx->children[1]->getText() == "<") {
       return std::pair<String, Condition *>(
           iPair.first, new IndexCondition(iPair.first, iPair.second, DBL_MIN,
@@ -340,8 +487,10 @@ antlrcpp::Any SystemVisitor::visitWhere_operator_expression(
                                           DBL_MAX, iType));
     } else if (ctx->children[1]->getText() == "<>") {
       return std::pair<String, Condition *>(
-          iPair.first, new NotCondition(new RangeCondition(nColIndex, fValue,
-                                                           fValue + EPOSILO)));
+          iPair.first,
+          new NotCondition(
+              new RangeCondition(nColIndex, iType, fValue, fValue + EPOSILO),
+              nColIndex));
     } else {
       throw SpecialException();
     }
@@ -349,25 +498,28 @@ antlrcpp::Any SystemVisitor::visitWhere_operator_expression(
     double fValue = stod(ctx->expression()->value()->getText());
     if (ctx->children[1]->getText() == "<") {
       return std::pair<String, Condition *>(
-          iPair.first, new RangeCondition(nColIndex, DBL_MIN, fValue));
+          iPair.first, new RangeCondition(nColIndex, iType, DBL_MIN, fValue));
     } else if (ctx->children[1]->getText() == ">") {
       return std::pair<String, Condition *>(
           iPair.first,
-          new RangeCondition(nColIndex, fValue + EPOSILO, DBL_MAX));
+          new RangeCondition(nColIndex, iType, fValue + EPOSILO, DBL_MAX));
     } else if (ctx->children[1]->getText() == "=") {
       return std::pair<String, Condition *>(
-          iPair.first, new RangeCondition(nColIndex, fValue, fValue + EPOSILO));
+          iPair.first,
+          new RangeCondition(nColIndex, iType, fValue, fValue + EPOSILO));
     } else if (ctx->children[1]->getText() == "<=") {
       return std::pair<String, Condition *>(
           iPair.first,
-          new RangeCondition(nColIndex, DBL_MIN, fValue + EPOSILO));
+          new RangeCondition(nColIndex, iType, DBL_MIN, fValue + EPOSILO));
     } else if (ctx->children[1]->getText() == ">=") {
       return std::pair<String, Condition *>(
-          iPair.first, new RangeCondition(nColIndex, fValue, DBL_MAX));
+          iPair.first, new RangeCondition(nColIndex, iType, fValue, DBL_MAX));
     } else if (ctx->children[1]->getText() == "<>") {
       return std::pair<String, Condition *>(
-          iPair.first, new NotCondition(new RangeCondition(nColIndex, fValue,
-                                                           fValue + EPOSILO)));
+          iPair.first,
+          new NotCondition(
+              new RangeCondition(nColIndex, iType, fValue, fValue + EPOSILO),
+              nColIndex));
     } else {
       throw SpecialException();
     }
@@ -23,9 +23,13 @@ class SystemVisitor : public SQLBaseVisitor {
   antlrcpp::Any visitSelect_table(SQLParser::Select_tableContext *ctx) override;
   antlrcpp::Any visitDescribe_table(
       SQLParser::Describe_tableContext *ctx) override;
+  antlrcpp::Any visitCopy_from_table(
+      SQLParser::Copy_from_tableContext *ctx) override;
+  antlrcpp::Any visitVacuum_table(SQLParser::Vacuum_tableContext *ctx) override;
 
   antlrcpp::Any visitField_list(SQLParser::Field_listContext *ctx) override;
   antlrcpp::Any visitNormal_field(SQLParser::Normal_fieldContext *ctx) override;
+  antlrcpp::Any visitTable_layout(SQLParser::Table_layoutContext *ctx) override;
 
   antlrcpp::Any visitIdentifiers(SQLParser::IdentifiersContext *ctx) override;
   antlrcpp::Any visitWhere_and_clause(
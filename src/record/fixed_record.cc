@@ -2,6 +2,7 @@
 
 #include <assert.h>
 #include <algorithm>
+#include <cstring>
 
 #include "exception/exceptions.h"
 #include "field/fields.h"
@@ -10,12 +11,27 @@ namespace thdb {
 
 FixedRecord::FixedRecord(Size nFieldSize,
                          const std::vector<FieldType> &iTypeVec,
-                         const std::vector<Size> &iSizeVec)
-    : Record(nFieldSize), _iTypeVec(iTypeVec), _iSizeVec(iSizeVec) {
+                         const std::vector<Size> &iSizeVec, bool bNullBitmap)
+    : Record(nFieldSize),
+      _iTypeVec(iTypeVec.begin(), iTypeVec.end()),
+      _iSizeVec(iSizeVec.begin(), iSizeVec.end()),
+      _bNullBitmap(bNullBitmap) {
   assert(_iTypeVec.size() == nFieldSize);
   assert(_iSizeVec.size() == nFieldSize);
 }
 
+FixedRecord::FixedRecord(const FixedRecord &iShape, bool)
+    : Record(iShape.GetSize()),
+      _iTypeVec(iShape._iTypeVec),
+      _iSizeVec(iShape._iSizeVec),
+      _bNullBitmap(iShape._bNullBitmap) {}
+
+// 字段在定长格式中占用的空间
+static Size StoredSize(FieldType iType, Size nSize) {
+  if (iType == FieldType::STRING_TYPE) return nSize;
+  return GetTypeSize(iType);
+}
+
 // 定长记录反序列化
 Size FixedRecord::Load(const uint8_t *src) {
   Clear();
@@ -26,12 +42,20 @@ Size FixedRecord::Load(const uint8_t *src) {
   // return: 反序列化使用的数据长度
   // 要填充的: _iFields(类型指针向量，指向一个具体的Field数据), iTypeVec(类型向量), iSizeVec(数据类型大小向量)
   // 如果有n个元素，就占用 4 + 4n + 4n + k 个空间
-  Size offset = 0;
+  // 带空值位图时位图之后是各字段，空字段仍然占用原来的空间
+  const uint8_t *pNull = src;
+  Size offset = _bNullBitmap ? (_iFields.size() + 7) / 8 : 0;
   for (FieldID i = 0; i < _iFields.size(); ++i) {
     FieldType iType = _iTypeVec[i];
-    if (iType == FieldType::INT_TYPE) {
-      _iFields[i] = new IntField(src + offset, 4);
-      offset += 4;
+    if (_bNullBitmap && ((pNull[i / 8] >> (i % 8)) & 1)) {
+      _iFields[i] = new NoneField();
+      offset += StoredSize(iType, _iSizeVec[i]);
+    } else if (IsIntType(iType)) {
+      _iFields[i] = new IntField(src + offset, GetTypeSize(iType));
+      offset += GetTypeSize(iType);
+    } else if (iType == FieldType::BIGINT_TYPE) {
+      _iFields[i] = new BigIntField(src + offset, 8);
+      offset += 8;
     } else if (iType == FieldType::FLOAT_TYPE) {
       _iFields[i] = new FloatField(src + offset, 8);
       offset += 8;
@@ -55,22 +79,31 @@ Size FixedRecord::Store(uint8_t *dst) const {
   // TIPS: 利用 Field 的抽象方法 GetData 写出数据
   // TIPS: 基于类型进行 dynamic_cast 进行指针转化
   // return: 序列化使用的数据长度
-  Size offset = 0;
+  uint8_t *pNull = dst;
+  Size offset = _bNullBitmap ? (_iFields.size() + 7) / 8 : 0;
+  memset(pNull, 0, offset);
   // 存Fields数据
   for (FieldID i = 0; i < _iFields.size(); ++i) {
     FieldType iType = _iTypeVec[i];
     assert(_iFields[i] != nullptr);
-    if (iType == FieldType::INT_TYPE) {
-      IntField* field = dynamic_cast<IntField *>(_iFields[i]);
-      field->GetData(dst + offset, 4);
-      offset += 4;
+    // 空字段在位图中标记，内容填0，使相同的记录序列化结果相同
+    if (_iFields[i]->GetType() == FieldType::NONE_TYPE &&
+        iType != FieldType::NONE_TYPE) {
+      Size nSize = StoredSize(iType, _iSizeVec[i]);
+      if (_bNullBitmap) pNull[i / 8] |= 1 << (i % 8);
+      memset(dst + offset, 0, nSize);
+      offset += nSize;
+      continue;
+    }
+    // 字段类型由列类型决定，直接写出，不需要 dynamic_cast
+    if (IsIntegerType(iType)) {
+      _iFields[i]->GetData(dst + offset, GetTypeSize(iType));
+      offset += GetTypeSize(iType);
     } else if (iType == FieldType::FLOAT_TYPE) {
-      FloatField* field = dynamic_cast<FloatField *>(_iFields[i]);
-      field->GetData(dst + offset, 8);
+      _iFields[i]->GetData(dst + offset, 8);
       offset += 8;
     } else if (iType == FieldType::STRING_TYPE) {
-      StringField* field = dynamic_cast<StringField *>(_iFields[i]);
-      field->GetData(dst + offset, _iSizeVec[i]);
+      _iFields[i]->GetData(dst + offset, _iSizeVec[i]);
       offset += _iSizeVec[i];
     } else if (iType == FieldType::NONE_TYPE) {
       // do nothing
@@ -91,9 +124,8 @@ void FixedRecord::Build(const std::vector<String> &iRawVec) {
       SetField(i, new NoneField()); // 置_iFields[i] = Field*
       continue;
     }
-    if (iType == FieldType::INT_TYPE) {
-      int nVal = std::stoi(iRawVec[i]);
-      SetField(i, new IntField(nVal));
+    if (IsIntegerType(iType)) {
+      SetField(i, ParseIntegerField(iRawVec[i], iType));
     } else if (iType == FieldType::FLOAT_TYPE) {
       double fVal = std::stod(iRawVec[i]);
       SetField(i, new FloatField(fVal));
@@ -106,7 +138,7 @@ void FixedRecord::Build(const std::vector<String> &iRawVec) {
 }
 
 Record *FixedRecord::Copy() const {
-  Record *pRecord = new FixedRecord(GetSize(), _iTypeVec, _iSizeVec);
+  Record *pRecord = new FixedRecord(*this, true);
   for (Size i = 0; i < GetSize(); ++i)
     pRecord->SetField(i, GetField(i)->Copy());
   return pRecord;
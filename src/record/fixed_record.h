@@ -14,8 +14,15 @@ class Instance;
 class FixedRecord : public Record {
   friend class Instance;
  public:
+  /**
+   * @param bNullBitmap 序列化结果是否以空值位图开头，不带位图时空字段无法保存
+   */
   FixedRecord(Size nFieldSize, const std::vector<FieldType> &iTypeVec,
-              const std::vector<Size> &iSizeVec);
+              const std::vector<Size> &iSizeVec, bool bNullBitmap = false);
+  /**
+   * @brief 构建与 iShape 字段类型和长度相同的空记录
+   */
+  FixedRecord(const FixedRecord &iShape, bool);
   ~FixedRecord() = default;
 
   /**
@@ -45,15 +52,19 @@ class FixedRecord : public Record {
   void Add(Record *pRecord) override;
   void Remove(FieldID nPos) override;
 
- private:
+ protected:
   /**
    * @brief 各个字段的类型
    */
-  std::vector<FieldType> _iTypeVec;
+  ArenaVector<FieldType> _iTypeVec;
   /**
    * @brief 各个字段分配的空间长度
    */
-  std::vector<Size> _iSizeVec;
+  ArenaVector<Size> _iSizeVec;
+  /**
+   * @brief 序列化格式是否带空值位图，格式与 RowView 一致
+   */
+  bool _bNullBitmap;
 };
 
 }  // namespace thdb
@@ -8,10 +8,10 @@
 
 namespace thdb {
 
-Record::Record() { _iFields = std::vector<Field *>(); }
+Record::Record() {}
 
 Record::Record(Size nFieldSize) {
-  _iFields = std::vector<Field *>();
+  _iFields.reserve(nFieldSize);
   for (Size i = 0; i < nFieldSize; ++i) _iFields.push_back(nullptr);
 }
 
@@ -49,8 +49,12 @@ class Record {
   void Clear(); // _iFields 置 nullptr
   String ToString();
 
+  // 执行语句时在语句的内存池中分配，字段数组同样使用内存池
+  static void *operator new(size_t nSize) { return Arena::New(nSize); }
+  static void operator delete(void *pData) { Arena::Delete(pData); }
+
  protected:
-  std::vector<Field *> _iFields; // 各个字段的类型
+  ArenaVector<Field *> _iFields; // 各个字段的类型
 };
 
 }  // namespace thdb
@@ -0,0 +1,115 @@
+#include "record/row_view.h"
+
+#include <assert.h>
+
+#include <cstring>
+#include <sstream>
+
+#include "exception/exceptions.h"
+
+namespace thdb {
+
+RowView::RowView(const std::vector<FieldType> &iTypeVec,
+                 const std::vector<Size> &iSizeVec, bool bNullBitmap)
+    : _pData(nullptr), _iTypeVec(iTypeVec), _iSizeVec(iSizeVec) {
+  assert(_iTypeVec.size() == _iSizeVec.size());
+  // 偏移与 FixedRecord::Load 的布局一致
+  _nBitmapSize = bNullBitmap ? (_iTypeVec.size() + 7) / 8 : 0;
+  Size nOffset = _nBitmapSize;
+  for (FieldID i = 0; i < _iTypeVec.size(); ++i) {
+    _iOffsetVec.push_back(nOffset);
+    if (IsIntegerType(_iTypeVec[i]) ||
+        _iTypeVec[i] == FieldType::FLOAT_TYPE) {
+      _iSizeVec[i] = GetTypeSize(_iTypeVec[i]);
+    } else if (_iTypeVec[i] == FieldType::NONE_TYPE) {
+      _iSizeVec[i] = 0;
+    } else if (_iTypeVec[i] != FieldType::STRING_TYPE) {
+      throw RecordTypeException();
+    }
+    nOffset += _iSizeVec[i];
+  }
+  _nTotalSize = nOffset;
+  _bCheckNull = _nBitmapSize > 0;
+}
+
+void RowView::Reset(const uint8_t *pData) { _pData = pData; }
+
+Size RowView::GetSize() const { return _iTypeVec.size(); }
+
+Size RowView::GetTotalSize() const { return _nTotalSize; }
+
+FieldType RowView::GetType(FieldID nPos) const { return _iTypeVec[nPos]; }
+
+Size RowView::GetOffset(FieldID nPos) const { return _iOffsetVec[nPos]; }
+
+Size RowView::GetNullBitmapSize() const { return _nBitmapSize; }
+
+bool RowView::IsNull(FieldID nPos) const {
+  return _bCheckNull && ((_pData[nPos / 8] >> (nPos % 8)) & 1);
+}
+
+void RowView::SetNullFree(bool bNullFree) {
+  _bCheckNull = _nBitmapSize > 0 && !bNullFree;
+}
+
+bool RowView::MayHaveNull() const { return _bCheckNull; }
+
+int RowView::GetInt(FieldID nPos) const {
+  assert(IsIntType(_iTypeVec[nPos]));
+  const uint8_t *pData = _pData + _iOffsetVec[nPos];
+  if (_iSizeVec[nPos] == 1) return (int8_t)pData[0];
+  if (_iSizeVec[nPos] == 2) {
+    int16_t nVal;
+    memcpy(&nVal, pData, sizeof(int16_t));
+    return nVal;
+  }
+  int nVal;
+  memcpy(&nVal, pData, sizeof(int));
+  return nVal;
+}
+
+int64_t RowView::GetBigInt(FieldID nPos) const {
+  if (IsIntType(_iTypeVec[nPos])) return GetInt(nPos);
+  assert(_iTypeVec[nPos] == FieldType::BIGINT_TYPE);
+  int64_t nVal;
+  memcpy(&nVal, _pData + _iOffsetVec[nPos], sizeof(int64_t));
+  return nVal;
+}
+
+double RowView::GetFloat(FieldID nPos) const {
+  assert(_iTypeVec[nPos] == FieldType::FLOAT_TYPE);
+  double fVal;
+  memcpy(&fVal, _pData + _iOffsetVec[nPos], sizeof(double));
+  return fVal;
+}
+
+const char *RowView::GetString(FieldID nPos) const {
+  assert(_iTypeVec[nPos] == FieldType::STRING_TYPE);
+  return (const char *)(_pData + _iOffsetVec[nPos]);
+}
+
+Size RowView::GetStringSize(FieldID nPos) const {
+  // 定长格式中字符串之后用'\0'填充
+  const char *pStr = GetString(nPos);
+  const void *pEnd = memchr(pStr, 0, _iSizeVec[nPos]);
+  return pEnd ? (const char *)pEnd - pStr : _iSizeVec[nPos];
+}
+
+String RowView::ToString(FieldID nPos) const {
+  if (IsNull(nPos)) return "";
+  FieldType iType = _iTypeVec[nPos];
+  if (IsIntType(iType)) {
+    return std::to_string(GetInt(nPos));
+  } else if (iType == FieldType::BIGINT_TYPE) {
+    return std::to_string(GetBigInt(nPos));
+  } else if (iType == FieldType::FLOAT_TYPE) {
+    std::ostringstream strs;
+    strs << GetFloat(nPos);
+    return strs.str();
+  } else if (iType == FieldType::STRING_TYPE) {
+    return String(GetString(nPos), GetStringSize(nPos));
+  }
+  return "";
+}
+
+}  // namespace thdb
@@ -0,0 +1,85 @@
+#ifndef THDB_ROW_VIEW_H_
+#define THDB_ROW_VIEW_H_
+
+#include "defines.h"
+#include "field/field.h"
+
+namespace thdb {
+
+/**
+ * @brief 定长格式化记录的只读视图。
+ * 直接按预先计算好的字段偏移读取原始数据，不构建 Field 对象，
+ * 同一个视图可以依次指向扫描中的每一条记录。
+ * 视图不拥有数据，数据在视图使用期间需要保持有效。
+ * 带空值位图时记录以 (字段数+7)/8 字节的位图开头，第 i 位为1表示第 i 个字段为空，
+ * 空字段的内容为0。
+ */
+class RowView {
+ public:
+  RowView(const std::vector<FieldType> &iTypeVec,
+          const std::vector<Size> &iSizeVec, bool bNullBitmap = false);
+  ~RowView() = default;
+
+  /**
+   * @brief 指向一条定长格式化的记录
+   *
+   * @param pData 记录内容，长度为 GetTotalSize()
+   */
+  void Reset(const uint8_t *pData);
+
+  Size GetSize() const;
+  Size GetTotalSize() const;
+  FieldType GetType(FieldID nPos) const;
+  /**
+   * @brief 字段在定长格式中的偏移
+   */
+  Size GetOffset(FieldID nPos) const;
+  /**
+   * @brief 空值位图的长度，没有位图时为0
+   */
+  Size GetNullBitmapSize() const;
+  /**
+   * @brief 字段是否为空，没有位图或 SetNullFree(true) 之后总是 false
+   */
+  bool IsNull(FieldID nPos) const;
+  /**
+   * @brief 扫描按页面判断前设置：整个页面都没有空值时，不再逐条检查位图
+   */
+  void SetNullFree(bool bNullFree);
+  /**
+   * @brief 当前指向的这批记录中是否可能有空值
+   */
+  bool MayHaveNull() const;
+
+  /**
+   * @brief TINYINT、SMALLINT、INT 字段的值
+   */
+  int GetInt(FieldID nPos) const;
+  /**
+   * @brief 任意整数类型字段的值
+   */
+  int64_t GetBigInt(FieldID nPos) const;
+  double GetFloat(FieldID nPos) const;
+  /**
+   * @brief 字符串字段的内容，不一定以'\0'结尾，长度由 GetStringSize 给出
+   */
+  const char *GetString(FieldID nPos) const;
+  Size GetStringSize(FieldID nPos) const;
+  /**
+   * @brief 与 Field::ToString 输出相同
+   */
+  String ToString(FieldID nPos) const;
+
+ private:
+  const uint8_t *_pData;
+  std::vector<FieldType> _iTypeVec;
+  std::vector<Size> _iSizeVec;
+  std::vector<Size> _iOffsetVec;
+  Size _nBitmapSize;
+  Size _nTotalSize;
+  bool _bCheckNull;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_ROW_VIEW_H_
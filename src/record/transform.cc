@@ -11,11 +11,9 @@ FieldID Transform::GetPos() const { return _nFieldID; }
 
 Field *Transform::GetField() const {
   Field *pField = nullptr;
-  if (_sRaw == "NULL") {
-    pField = new NoneField();
-  }
-  if (_iType == FieldType::INT_TYPE) {
-    pField = new IntField(std::stoi(_sRaw));
+  if (_sRaw == "NULL") return new NoneField();
+  if (IsIntegerType(_iType)) {
+    pField = ParseIntegerField(_sRaw, _iType);
   } else if (_iType == FieldType::FLOAT_TYPE) {
     pField = new FloatField(std::stod(_sRaw));
   } else if (_iType == FieldType::STRING_TYPE) {
@@ -0,0 +1,103 @@
+#include "record/var_record.h"
+
+#include <assert.h>
+
+#include <cstring>
+
+#include "exception/exceptions.h"
+#include "field/fields.h"
+
+namespace thdb {
+
+VarRecord::VarRecord(Size nFieldSize, const std::vector<FieldType> &iTypeVec,
+                     const std::vector<Size> &iSizeVec)
+    : FixedRecord(nFieldSize, iTypeVec, iSizeVec) {}
+
+VarRecord::VarRecord(const VarRecord &iShape, bool)
+    : FixedRecord(iShape, true) {}
+
+// 空值位图之后是各字段的结束位置
+Size VarRecord::GetHeaderSize() const {
+  return (_iFields.size() + 7) / 8 + _iFields.size() * sizeof(uint16_t);
+}
+
+Size VarRecord::GetMaxSize() const {
+  Size nSize = GetHeaderSize();
+  for (FieldID i = 0; i < _iFields.size(); ++i) {
+    if (_iTypeVec[i] == FieldType::STRING_TYPE)
+      nSize += _iSizeVec[i];
+    else
+      nSize += GetTypeSize(_iTypeVec[i]);
+  }
+  return nSize;
+}
+
+Size VarRecord::Load(const uint8_t *src) {
+  Clear();
+  const uint8_t *pNull = src;
+  const uint8_t *pEnd = src + (_iFields.size() + 7) / 8;
+  Size nOffset = GetHeaderSize();
+  for (FieldID i = 0; i < _iFields.size(); ++i) {
+    uint16_t nEnd;
+    memcpy(&nEnd, pEnd + i * sizeof(uint16_t), sizeof(uint16_t));
+    FieldType iType = _iTypeVec[i];
+    if ((pNull[i / 8] >> (i % 8)) & 1) {
+      _iFields[i] = new NoneField();
+    } else if (IsIntType(iType)) {
+      _iFields[i] = new IntField(src + nOffset, GetTypeSize(iType));
+    } else if (iType == FieldType::BIGINT_TYPE) {
+      _iFields[i] = new BigIntField(src + nOffset, 8);
+    } else if (iType == FieldType::FLOAT_TYPE) {
+      _iFields[i] = new FloatField(src + nOffset, 8);
+    } else if (iType == FieldType::STRING_TYPE) {
+      _iFields[i] = new StringField(src + nOffset, nEnd - nOffset);
+    } else if (iType == FieldType::NONE_TYPE) {
+      _iFields[i] = new NoneField();
+    } else {
+      throw RecordTypeException();
+    }
+    nOffset = nEnd;
+  }
+  return nOffset;
+}
+
+Size VarRecord::Store(uint8_t *dst) const {
+  uint8_t *pNull = dst;
+  uint8_t *pEnd = dst + (_iFields.size() + 7) / 8;
+  memset(pNull, 0, pEnd - pNull);
+  Size nOffset = GetHeaderSize();
+  for (FieldID i = 0; i < _iFields.size(); ++i) {
+    FieldType iType = _iTypeVec[i];
+    assert(_iFields[i] != nullptr);
+    if (_iFields[i]->GetType() == FieldType::NONE_TYPE ||
+        iType == FieldType::NONE_TYPE) {
+      pNull[i / 8] |= 1 << (i % 8);
+    } else if (IsIntegerType(iType)) {
+      _iFields[i]->GetData(dst + nOffset, GetTypeSize(iType));
+      nOffset += GetTypeSize(iType);
+    } else if (iType == FieldType::FLOAT_TYPE) {
+      _iFields[i]->GetData(dst + nOffset, 8);
+      nOffset += 8;
+    } else if (iType == FieldType::STRING_TYPE) {
+      // 只保存实际长度，超过声明长度的部分与定长记录一样被截断
+      Size nLength = _iFields[i]->ToString().size();
+      if (nLength > _iSizeVec[i]) nLength = _iSizeVec[i];
+      _iFields[i]->GetData(dst + nOffset, nLength);
+      nOffset += nLength;
+    } else {
+      throw RecordTypeException();
+    }
+    uint16_t nEnd = nOffset;
+    memcpy(pEnd + i * sizeof(uint16_t), &nEnd, sizeof(uint16_t));
+  }
+  return nOffset;
+}
+
+Record *VarRecord::Copy() const {
+  Record *pRecord = new VarRecord(*this, true);
+  for (Size i = 0; i < GetSize(); ++i)
+    pRecord->SetField(i, GetField(i)->Copy());
+  return pRecord;
+}
+
+}  // namespace thdb
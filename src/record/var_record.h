@@ -0,0 +1,51 @@
+#ifndef THDB_VAR_RECORD_H_
+#define THDB_VAR_RECORD_H_
+
+#include "defines.h"
+#include "record/fixed_record.h"
+
+namespace thdb {
+
+/**
+ * @brief 变长记录。
+ * 序列化格式为：空值位图(每个字段1位) + 各字段结束位置(uint16_t，相对记录起始) +
+ * 字段内容。字符串只保存实际长度的内容(不超过声明长度)，空值字段不占用内容空间。
+ * 字段的类型和声明长度与 FixedRecord 相同，因此 Build、Sub、Add、Remove
+ * 直接沿用 FixedRecord 的实现，两种记录可以在 JOIN 结果中拼接。
+ */
+class VarRecord : public FixedRecord {
+ public:
+  VarRecord(Size nFieldSize, const std::vector<FieldType> &iTypeVec,
+            const std::vector<Size> &iSizeVec);
+  VarRecord(const VarRecord &iShape, bool);
+  ~VarRecord() = default;
+
+  /**
+   * @brief 记录反序列化
+   *
+   * @param src 反序列化源数据
+   * @return Size 反序列化使用的数据长度
+   */
+  Size Load(const uint8_t *src) override;
+  /**
+   * @brief 记录序列化
+   *
+   * @param dst 序列化结果存储位置，至少需要 GetMaxSize 字节
+   * @return Size 序列化使用的数据长度
+   */
+  Size Store(uint8_t *dst) const override;
+
+  Record *Copy() const override;
+
+  /**
+   * @brief 所有字段都取声明长度时序列化后的长度
+   */
+  Size GetMaxSize() const;
+
+ private:
+  Size GetHeaderSize() const;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_VAR_RECORD_H_
@@ -2,6 +2,14 @@
 
 namespace thdb {
 
-Result::Result(const std::vector<String> &iHeader) : _iHeader(iHeader) {}
+Result::Result(const std::vector<String> &iHeader)
+    : _iHeader(iHeader), _pArena(Arena::Current()) {
+  if (_pArena) _pArena->Ref();
+}
+
+// 派生类先释放记录，最后一个结果释放时内存池一次性回收
+Result::~Result() {
+  if (_pArena) _pArena->Unref();
+}
 
 }  // namespace thdb
@@ -7,10 +7,11 @@
 namespace thdb {
 
 // 用于传递SQL语句执行结果并输出
+// 结果持有语句内存池的一个引用，结果中的记录在内存池中分配
 class Result {
  public:
   Result(const std::vector<String> &iHeader);
-  virtual ~Result() = default;
+  virtual ~Result();
 
   virtual void PushBack(Record *pRecord) = 0;
   virtual Record *GetRecord(Size nPos) const = 0;
@@ -21,6 +22,9 @@ class Result {
 
  protected:
   std::vector<String> _iHeader;
+
+ private:
+  Arena *_pArena;
 };
 
 }  // namespace thdb
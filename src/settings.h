@@ -5,6 +5,38 @@
 
 #include "defines.h"
 
-namespace thdb {}  // namespace thdb
+namespace thdb {
 
-#endif
\ No newline at end of file
+// 缓冲池默认帧数(64MB)，可以通过环境变量 THDB_BUFFER_FRAMES 覆盖
+const Size BUFFER_FRAMES = 1U << 14;
+// 后台检查点的时间间隔(毫秒)，可以通过环境变量 THDB_CHECKPOINT_MS 覆盖，为0时不启动后台线程
+const Size CHECKPOINT_INTERVAL_MS = 1000;
+// 脏页面数量达到该值时立即触发一次检查点
+const Size CHECKPOINT_DIRTY_PAGES = 1U << 10;
+// 批量读写数据文件时的线程数，以及单次 preadv/pwritev 的最大页面数(4MB)
+const Size IO_THREADS = 4;
+const Size IO_BATCH_PAGES = 1U << 10;
+// 异步写回队列最多缓存的页面数(16MB)，队列满时淘汰脏帧的线程等待
+const Size IO_QUEUE_PAGES = 1U << 12;
+// 设置环境变量 THDB_DIRECT_IO=1 时以 O_DIRECT 打开未压缩的数据文件，绕过操作系统的页缓存
+// 顺序扫描时沿链表预读的初始和最大页面数，扫描追上预读位置时窗口加倍，
+// 设置环境变量 THDB_PREFETCH=0 时关闭预读
+const Size PREFETCH_MIN_PAGES = 8;
+const Size PREFETCH_MAX_PAGES = 256;
+// 每张表缓存的已解析定长记录页面数量，可以通过环境变量 THDB_PAGE_CACHE 覆盖
+const Size RECORD_PAGE_CACHE_PAGES = 256;
+// 设置环境变量 THDB_PREWARM=1 时启动后并行预读已使用的页面填满缓冲池，
+// 设置 THDB_IO_STATS=1 时在标准错误输出预读和写回的吞吐量
+// COPY 导入时读取文件的初始缓冲区大小(1MB)，以及每批插入的行数
+const Size COPY_BUFFER_SIZE = 1U << 20;
+const Size COPY_BATCH_ROWS = 1U << 12;
+// VACUUM 每一步整理的尾部页面数量，每一步之后更新索引
+const Size VACUUM_STEP_PAGES = 16;
+// 语句内存池每次申请的块大小(64KB)，以及语句结束后留作复用的最大块数，
+// 设置环境变量 THDB_ARENA=0 时语句产生的记录和字段直接在堆上分配
+const Size ARENA_CHUNK_SIZE = 1U << 16;
+const Size ARENA_POOL_CHUNKS = 64;
+
+}  // namespace thdb
+
+#endif
@@ -3,6 +3,7 @@
 #include <cassert>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 #include <vector>
 #include <unordered_map>
@@ -10,10 +11,12 @@
 
 #include "condition/conditions.h"
 #include "exception/exceptions.h"
+#include "field/compare.h"
 #include "manager/table_manager.h"
-#include "page/record_page.h"
 #include "record/record.h"
 #include "record/fixed_record.h"
+#include "settings.h"
+#include "utils/csv_reader.h"
 
 using namespace std;
 
@@ -25,6 +28,8 @@ Instance::Instance() {
   _pTransactionManager = new TransactionManager();
   _pRecoveryManager = new RecoveryManager();
   _pRecoveryManager->setLogPageID(_pTransactionManager->getLogPageID());
+  _pTransactionManager->setTableManager(_pTableManager);
+  _pRecoveryManager->setTableManager(_pTableManager);
 }
 
 Instance::~Instance() {
@@ -48,7 +53,8 @@ bool Instance::CreateTable(const String &sTableName, const Schema &iSchema,
       _iColVec.push_back(iSchema.GetColumn(i));
     }
     _iColVec.push_back(Column("_txn_id", FieldType::INT_TYPE, 4));
-    _pTableManager->AddTable(sTableName, Schema(_iColVec));
+    _pTableManager->AddTable(sTableName,
+                             Schema(_iColVec, iSchema.GetFormat()));
   } else {
     _pTableManager->AddTable(sTableName, iSchema);
   }
@@ -109,14 +115,16 @@ std::vector<PageSlotID> Instance::Search(
     auto iName = pIndexCond->GetIndexName();
     auto iRange = pIndexCond->GetIndexRange();
     std::vector<PageSlotID> iRes =
-        GetIndex(iName.first, iName.second)->Range(iRange.first, iRange.second);
+        GetIndex(iName.first, iName.second)
+            ->Range(iRange.first, iRange.second, pIndexCond->IsClosed());
     for (Size i = 1; i < iIndexCond.size(); ++i) {
       IndexCondition *pIndexCond =
           dynamic_cast<IndexCondition *>(iIndexCond[i]);
       auto iName = pIndexCond->GetIndexName();
       auto iRange = pIndexCond->GetIndexRange();
       iRes = Intersection(iRes, GetIndex(iName.first, iName.second)
-                                    ->Range(iRange.first, iRange.second));
+                                    ->Range(iRange.first, iRange.second,
+                                            pIndexCond->IsClosed()));
     }
     return iRes;
   } else
@@ -126,31 +134,185 @@ std::vector<PageSlotID> Instance::Search(
 PageSlotID Instance::Insert(const String &sTableName,
                             const std::vector<String> &iRawVec,
                             Transaction *txn) {
+  return InsertBatch(sTableName, {iRawVec}, txn).front();
+}
+
+std::vector<PageSlotID> Instance::InsertBatch(
+    const String &sTableName,
+    const std::vector<std::vector<String>> &iRawVecs, Transaction *txn) {
   Table *pTable = GetTable(sTableName);
   if (pTable == nullptr) throw TableException();
-  Record *pRecord = pTable->EmptyRecord();
-  if (txn == nullptr) {
-    pRecord->Build(iRawVec);
-  } else {
-    txn->setTableID(pTable->GetPageID());
-    std::vector<String> newRawVec = iRawVec; // insert txn id
-    newRawVec.push_back(std::to_string(txn->GetTxnID()));
-    pRecord->Build(newRawVec);
+  std::vector<Record *> iRecordVec;
+  iRecordVec.reserve(iRawVecs.size());
+  if (txn != nullptr) txn->setTableID(pTable->GetPageID());
+  try {
+    for (const auto &iRawVec : iRawVecs) {
+      Record *pRecord = pTable->EmptyRecord();
+      iRecordVec.push_back(pRecord);
+      if (txn == nullptr) {
+        pRecord->Build(iRawVec);
+      } else {
+        std::vector<String> newRawVec = iRawVec; // insert txn id
+        newRawVec.push_back(std::to_string(txn->GetTxnID()));
+        pRecord->Build(newRawVec);
+      }
+    }
+  } catch (...) {
+    // 有记录无法构建时不插入任何记录
+    for (const auto &pRecord : iRecordVec) delete pRecord;
+    throw;
+  }
+  std::vector<PageSlotID> iPairVec;
+  try {
+    iPairVec = InsertRecords(sTableName, pTable, iRecordVec, txn);
+  } catch (...) {
+    for (const auto &pRecord : iRecordVec) delete pRecord;
+    throw;
+  }
+  for (const auto &pRecord : iRecordVec) delete pRecord;
+  return iPairVec;
+}
+
+std::vector<PageSlotID> Instance::InsertRecords(
+    const String &sTableName, Table *pTable,
+    const std::vector<Record *> &iRecordVec, Transaction *txn) {
+  std::vector<PageSlotID> iPairVec = pTable->InsertRecords(iRecordVec);
+  if (txn != nullptr) {
+    _pTransactionManager->LogInserts(txn, iPairVec); // write-ahead log
+    for (const auto &iPair : iPairVec) txn->recordInsert(iPair);
   }
-  PageSlotID iPair = pTable->InsertRecord(pRecord);
-  _pTransactionManager->LogInsert(txn, iPair); // write-ahead log
   // Handle Insert on Index
+  // 每个索引按键排序后批量插入，落在同一叶节点的键只从根下降一次
   if (_pIndexManager->HasIndex(sTableName)) {
     auto iColNames = _pIndexManager->GetTableIndexes(sTableName);
     for (const auto &sCol : iColNames) {
       FieldID nPos = pTable->GetPos(sCol);
-      Field *pKey = pRecord->GetField(nPos);
-      _pIndexManager->GetIndex(sTableName, sCol)->Insert(pKey, iPair);
+      FieldType iType = pTable->GetType(sCol);
+      std::vector<std::pair<Field *, PageSlotID>> iEntryVec;
+      iEntryVec.reserve(iRecordVec.size());
+      for (Size i = 0; i < iRecordVec.size(); ++i)
+        if (iRecordVec[i]->GetField(nPos)->GetType() != FieldType::NONE_TYPE)
+          iEntryVec.push_back({iRecordVec[i]->GetField(nPos), iPairVec[i]});
+      GetComparator(iType).Sort(iEntryVec);
+      _pIndexManager->GetIndex(sTableName, sCol)->InsertBatch(iEntryVec);
+    }
+    _pIndexManager->Sync();
+  }
+  return iPairVec;
+}
+
+// 把 CSV 字段直接转换为对应类型的 Field，不构造中间的 String
+static Field *ParseField(const CsvField &iField, FieldType iType, Size nLine) {
+  if (!iField.bQuoted &&
+      (iField.nSize == 0 ||
+       (iField.nSize == 4 && memcmp(iField.pData, "NULL", 4) == 0)))
+    return new NoneField();
+  if (IsIntegerType(iType)) {
+    const char *p = iField.pData, *pEnd = iField.pData + iField.nSize;
+    bool bNeg = false;
+    if (p < pEnd && (*p == '-' || *p == '+')) bNeg = (*p++ == '-');
+    if (p == pEnd) throw LoadException(nLine, "invalid integer");
+    // 按绝对值累加，负数可以比正数多1
+    int64_t nMin, nMax;
+    GetIntegerRange(iType, nMin, nMax);
+    uint64_t nLimit = bNeg ? (uint64_t)nMax + 1 : (uint64_t)nMax;
+    uint64_t nVal = 0;
+    for (; p < pEnd; ++p) {
+      if (*p < '0' || *p > '9') throw LoadException(nLine, "invalid integer");
+      uint64_t nDigit = *p - '0';
+      if (nVal > (nLimit - nDigit) / 10)
+        throw LoadException(nLine, "integer out of range");
+      nVal = nVal * 10 + nDigit;
+    }
+    int64_t nSigned = bNeg ? (int64_t)(0 - nVal) : (int64_t)nVal;
+    if (iType == FieldType::BIGINT_TYPE) return new BigIntField(nSigned);
+    return new IntField((int)nSigned);
+  } else if (iType == FieldType::FLOAT_TYPE) {
+    char pBuffer[64];
+    if (iField.nSize >= sizeof(pBuffer))
+      throw LoadException(nLine, "invalid float");
+    memcpy(pBuffer, iField.pData, iField.nSize);
+    pBuffer[iField.nSize] = '\0';
+    char *pEnd = nullptr;
+    double fVal = strtod(pBuffer, &pEnd);
+    if (pEnd != pBuffer + iField.nSize) throw LoadException(nLine, "invalid float");
+    return new FloatField(fVal);
+  } else if (iType == FieldType::STRING_TYPE) {
+    return new StringField(String(iField.pData, iField.nSize));
+  }
+  throw RecordTypeException();
+}
+
+Size Instance::CopyFrom(const String &sTableName, const String &sPath,
+                        char cDelim) {
+  Table *pTable = GetTable(sTableName);
+  if (pTable == nullptr) throw TableException();
+  std::vector<FieldType> iTypeVec;
+  for (const auto &sCol : pTable->GetColumnNames())
+    iTypeVec.push_back(pTable->GetType(sCol));
+  CsvReader iReader(sPath, cDelim);
+  std::vector<CsvField> iFieldVec;
+  std::vector<Record *> iRecordVec;
+  iRecordVec.reserve(COPY_BATCH_ROWS);
+  Size nRows = 0;
+  try {
+    while (true) {
+      bool bMore = iReader.Next(iFieldVec);
+      if (bMore) {
+        if (iFieldVec.size() != iTypeVec.size())
+          throw LoadException(iReader.GetLine(),
+                              "expected " + std::to_string(iTypeVec.size()) +
+                                  " fields, got " +
+                                  std::to_string(iFieldVec.size()));
+        Record *pRecord = pTable->EmptyRecord();
+        iRecordVec.push_back(pRecord);
+        for (FieldID i = 0; i < iTypeVec.size(); ++i)
+          pRecord->SetField(
+              i, ParseField(iFieldVec[i], iTypeVec[i], iReader.GetLine()));
+      }
+      if (iRecordVec.size() == COPY_BATCH_ROWS ||
+          (!bMore && iRecordVec.size() > 0)) {
+        InsertRecords(sTableName, pTable, iRecordVec, nullptr);
+        nRows += iRecordVec.size();
+        for (const auto &pRecord : iRecordVec) delete pRecord;
+        iRecordVec.clear();
+      }
+      if (!bMore) break;
+    }
+  } catch (...) {
+    // 出错之前已经插入的批次保留
+    for (const auto &pRecord : iRecordVec) delete pRecord;
+    throw;
+  }
+  return nRows;
+}
+
+Size Instance::Vacuum(const String &sTableName) {
+  Table *pTable = GetTable(sTableName);
+  if (pTable == nullptr) throw TableException();
+  if (_pTransactionManager->hasActiveTxns()) throw TableBusyException();
+  Size nFreed = pTable->FreeEmptyPages();
+  std::vector<String> iColNames;
+  if (_pIndexManager->HasIndex(sTableName))
+    iColNames = _pIndexManager->GetTableIndexes(sTableName);
+  std::vector<std::pair<PageSlotID, PageSlotID>> iMoved;
+  bool bMore = true;
+  while (bMore) {
+    iMoved.clear();
+    bMore = pTable->CompactStep(VACUUM_STEP_PAGES, iMoved, nFreed);
+    // Handle Move on Index
+    if (iColNames.empty()) continue;
+    for (const auto &iMove : iMoved) {
+      Record *pRecord = pTable->GetRecord(iMove.second.first, iMove.second.second);
+      for (const auto &sCol : iColNames) {
+        Field *pKey = pRecord->GetField(pTable->GetPos(sCol));
+        _pIndexManager->GetIndex(sTableName, sCol)
+            ->Update(pKey, iMove.first, iMove.second);
+      }
+      delete pRecord;
     }
   }
-  if (txn != nullptr) txn->recordInsert(iPair);
-  delete pRecord;
-  return iPair;
+  return nFreed;
 }
 
 uint32_t Instance::Delete(const String &sTableName, Condition *pCond,
@@ -174,6 +336,7 @@ uint32_t Instance::Delete(const String &sTableName, Condition *pCond,
 
     pTable->DeleteRecord(iPair.first, iPair.second);
   }
+  if (bHasIndex) _pIndexManager->Sync();
   return iResVec.size();
 }
 
@@ -197,20 +360,23 @@ uint32_t Instance::Update(const String &sTableName, Condition *pCond,
       delete pRecord;
     }
 
-    pTable->UpdateRecord(iPair.first, iPair.second, iTrans);
+    // 变长记录可能被移动到其他页面，索引使用更新后的位置
+    PageSlotID iNewPair =
+        pTable->UpdateRecord(iPair.first, iPair.second, iTrans);
 
     // Handle Delete on Index
     if (bHasIndex) {
-      Record *pRecord = pTable->GetRecord(iPair.first, iPair.second);
+      Record *pRecord = pTable->GetRecord(iNewPair.first, iNewPair.second);
       auto iColNames = _pIndexManager->GetTableIndexes(sTableName);
       for (const auto &sCol : iColNames) {
         FieldID nPos = pTable->GetPos(sCol);
         Field *pKey = pRecord->GetField(nPos);
-        _pIndexManager->GetIndex(sTableName, sCol)->Insert(pKey, iPair);
+        _pIndexManager->GetIndex(sTableName, sCol)->Insert(pKey, iNewPair);
       }
       delete pRecord;
     }
   }
+  if (bHasIndex) _pIndexManager->Sync();
   return iResVec.size();
 }
 
@@ -276,16 +442,24 @@ std::vector<Record *> Instance::GetIndexInfos() const {
 bool Instance::CreateIndex(const String &sTableName, const String &sColName,
                            FieldType iType) {
   auto iAll = Search(sTableName, nullptr, {});
-  _pIndexManager->AddIndex(sTableName, sColName, iType);
   Table *pTable = GetTable(sTableName);
+  _pIndexManager->AddIndex(sTableName, sColName, iType,
+                           pTable->GetSize(sColName));
   // Handle Exists Data
+  // 只保留已有记录的键，按键排序后批量插入
+  FieldID nPos = pTable->GetPos(sColName);
+  std::vector<std::pair<Field *, PageSlotID>> iEntryVec;
+  iEntryVec.reserve(iAll.size());
   for (const auto &iPair : iAll) {
-    FieldID nPos = pTable->GetPos(sColName);
     Record *pRecord = pTable->GetRecord(iPair.first, iPair.second);
-    Field *pKey = pRecord->GetField(nPos);
-    _pIndexManager->GetIndex(sTableName, sColName)->Insert(pKey, iPair);
+    if (pRecord->GetField(nPos)->GetType() != FieldType::NONE_TYPE)
+      iEntryVec.push_back({pRecord->GetField(nPos)->Copy(), iPair});
     delete pRecord;
   }
+  GetComparator(iType).Sort(iEntryVec);
+  _pIndexManager->GetIndex(sTableName, sColName)->InsertBatch(iEntryVec);
+  for (const auto &iEntry : iEntryVec) delete iEntry.first;
+  _pIndexManager->Sync();
   return true;
 }
 
@@ -303,6 +477,72 @@ bool Instance::DropIndex(const String &sTableName, const String &sColName) {
   return true;
 }
 
+static double NumberKey(const RowView &iRow, FieldID nPos) {
+  if (IsIntegerType(iRow.GetType(nPos))) return iRow.GetBigInt(nPos);
+  return iRow.GetFloat(nPos);
+}
+
+// 两侧都是整数列时按 int64_t 比较，BIGINT 不经过 double 损失精度
+static int64_t IntegerKey(const RowView &iRow, FieldID nPos) {
+  return iRow.GetBigInt(nPos);
+}
+
+static String StringKey(const RowView &iRow, FieldID nPos) {
+  return String(iRow.GetString(nPos), iRow.GetStringSize(nPos));
+}
+
+// 读取各条记录的连接列，second 为记录在 iPairs 中的下标，连接列为空的记录不参与连接
+template <typename T>
+static std::vector<std::pair<T, Size>> ReadKeys(
+    Table *pTable, const std::vector<PageSlotID> &iPairs, FieldID nPos,
+    T (*pKey)(const RowView &, FieldID)) {
+  RowView iRow = pTable->EmptyRowView();
+  std::vector<uint8_t> iRowData(iRow.GetTotalSize());
+  iRow.Reset(iRowData.data());
+  std::vector<std::pair<T, Size>> iKeys;
+  iKeys.reserve(iPairs.size());
+  for (Size i = 0; i < iPairs.size(); ++i) {
+    pTable->ReadRow(iPairs[i].first, iPairs[i].second, iRowData.data());
+    if (iRow.IsNull(nPos)) continue;
+    iKeys.emplace_back(pKey(iRow, nPos), i);
+  }
+  return iKeys;
+}
+
+// 返回连接列相等的记录下标对
+template <typename T>
+static std::vector<std::pair<Size, Size>> JoinKeys(
+    std::vector<std::pair<T, Size>> iKeys1,
+    std::vector<std::pair<T, Size>> iKeys2, bool bHash) {
+  std::vector<std::pair<Size, Size>> iMatches;
+  if (!bHash) {
+    // sort
+    auto cmp = [](const std::pair<T, Size> &a, const std::pair<T, Size> &b) {
+      return a.first < b.first;
+    };
+    std::sort(iKeys1.begin(), iKeys1.end(), cmp);
+    std::sort(iKeys2.begin(), iKeys2.end(), cmp);
+    // merge
+    Size j = 0;
+    for (Size i = 0; i < iKeys1.size(); ++i) {
+      while (j < iKeys2.size() && iKeys2[j].first < iKeys1[i].first) ++j;
+      for (Size k = j; k < iKeys2.size() && !(iKeys1[i].first < iKeys2[k].first); ++k)
+        iMatches.emplace_back(iKeys1[i].second, iKeys2[k].second);
+    }
+  } else {
+    // hash O(m)
+    std::unordered_map<T, std::vector<Size>> hashmap;
+    for (const auto &iKey : iKeys1) hashmap[iKey.first].push_back(iKey.second);
+    // iteration, O(n)
+    for (const auto &iKey : iKeys2) {
+      auto it = hashmap.find(iKey.first);
+      if (it == hashmap.end()) continue;
+      for (const auto &i : it->second) iMatches.emplace_back(i, iKey.second);
+    }
+  }
+  return iMatches;
+}
+
 std::pair<std::vector<String>, std::vector<Record *>> Instance::Join(
     std::map<String, std::vector<PageSlotID>> &iResultMap,
     std::vector<Condition *> &iJoinConds) {
@@ -327,50 +567,16 @@ std::pair<std::vector<String>, std::vector<Record *>> Instance::Join(
   // EXTRA:在多表JOIN时，可以采用并查集或执行树来确定执行JOIN的数据内容
 
   // implemented Sort-Merge Algorithm.
-  // 初始化两个表的Record*向量
+  // 连接列通过 RowView 读取，只为参与输出的记录构建 Record
   const String tableName1 = iResultMap.cbegin()->first;
-  std::vector<PageSlotID> pageslots1 = iResultMap.cbegin()->second;
+  const std::vector<PageSlotID> &pageslots1 = iResultMap.cbegin()->second;
   Table *pTable1 = GetTable(tableName1);
   std::vector<String> columnNames1 = pTable1->GetColumnNames();
-  std::vector<Record *> records1;
-  // record page cache
-  RecordPage* last_record_page = nullptr;
-  PageID last_page_id = -1;
-  for (const auto& pageslot: pageslots1) {
-    Record* fixed_record = pTable1->EmptyRecord();
-    uint8_t* raw_slot_data;
-    if (pageslot.first != last_page_id) {
-      if (last_record_page != nullptr) delete last_record_page;
-      last_record_page = new RecordPage(pageslot.first);
-      last_page_id = pageslot.first;
-    }
-    raw_slot_data = last_record_page->GetRecord(pageslot.second);
-    fixed_record->Load(raw_slot_data);
-    delete[] raw_slot_data;
-    records1.emplace_back(fixed_record);
-  }
 
   const String tableName2 = iResultMap.crbegin()->first;
-  std::vector<PageSlotID> pageslots2 = iResultMap.crbegin()->second;
+  const std::vector<PageSlotID> &pageslots2 = iResultMap.crbegin()->second;
   Table *pTable2 = GetTable(tableName2);
   std::vector<String> columnNames2 = pTable2->GetColumnNames();
-  std::vector<Record *> records2;
-  // record page cache
-  last_record_page = nullptr;
-  last_page_id = -1;
-  for (const auto& pageslot: pageslots2) {
-    Record* fixed_record = pTable2->EmptyRecord();
-    uint8_t* raw_slot_data;
-    if (pageslot.first != last_page_id) {
-      if (last_record_page != nullptr) delete last_record_page;
-      last_record_page = new RecordPage(pageslot.first);
-      last_page_id = pageslot.first;
-    }
-    raw_slot_data = last_record_page->GetRecord(pageslot.second);
-    fixed_record->Load(raw_slot_data);
-    delete[] raw_slot_data;
-    records2.emplace_back(fixed_record);
-  }
 
   // get join condition
   JoinCondition* condition = dynamic_cast<JoinCondition*>(iJoinConds[0]); // we only select one for simplification.
@@ -384,60 +590,47 @@ std::pair<std::vector<String>, std::vector<Record *>> Instance::Join(
   uint32_t joinColRank1 = pTable1->GetPos(joinCol1);
   uint32_t joinColRank2 = pTable2->GetPos(joinCol2);
   FieldType type = pTable1->GetType(joinCol1);
-  assert(type == pTable2->GetType(joinCol2));
+  FieldType type2 = pTable2->GetType(joinCol2);
+  // 不同宽度的整数列之间可以连接
+  assert((type == FieldType::STRING_TYPE) == (type2 == FieldType::STRING_TYPE));
 
-  std::vector<Record *> resultRecords;
   std::vector<String> resultColNames = columnNames1;
   resultColNames.insert(resultColNames.end(), columnNames2.begin(), columnNames2.end());
 
   // use dynamic join algo.
-  if (pageslots1.size() < 1024 && pageslots2.size() < 1024) { // use sort merge join, O(m + n + mlogm + nlogn)
-    // sort
-    sort(records1.begin(), records1.end(), [=](Record* left, Record* right){
-      return Less(left->_iFields[joinColRank1], right->_iFields[joinColRank1], type);
-    });
-    sort(records2.begin(), records2.end(), [=](Record* left, Record* right){
-      return Less(left->_iFields[joinColRank2], right->_iFields[joinColRank2], type);
-    });
-    // merge
-    size_t last_j = 0;
-    for (size_t i = 0; i < records1.size(); ++i) {
-      size_t j;
-      for (j = last_j; j < records2.size(); ++j) {
-        if (Equal(records1[i]->_iFields[joinColRank1], records2[j]->_iFields[joinColRank2], type)) {
-          Record* hitRecord = records1[i]->Copy();
-          hitRecord->Add(records2[j]);
-          resultRecords.emplace_back(hitRecord);
-        } else {
-          break;
-        }
-      }
-      if (i < records1.size()-1 && !Equal(records1[i]->_iFields[joinColRank1], records1[i+1]->_iFields[joinColRank1], type)) {
-        last_j = j;
-      }
-    }
-  } else { // use hash join O(m+n)
-    // hash O(m)
-    std::unordered_map<int, std::vector<Record*>> hashmap;
-    for (auto* record: records1) {
-      IntField* field = dynamic_cast<IntField*>(record->_iFields[joinColRank1]);
-      if (hashmap.count(field->GetIntData()) > 0) {
-        hashmap[field->GetIntData()].emplace_back(record);
-      } else {
-        hashmap.insert({field->GetIntData(), std::vector<Record*>{record}});
-      }
-    }
-    // iteration, O(n)
-    for (auto* record: records2) {
-      IntField* field = dynamic_cast<IntField*>(record->_iFields[joinColRank2]);
-      if (hashmap.count(field->GetIntData()) > 0) {
-        for (auto* record1: hashmap[field->GetIntData()]) {
-          Record* hitRecord = record1->Copy();
-          hitRecord->Add(record);
-          resultRecords.emplace_back(hitRecord);
-        }
-      }
-    }
+  // sort merge join O(m + n + mlogm + nlogn) for small inputs, hash join O(m+n) otherwise
+  bool bHash = !(pageslots1.size() < 1024 && pageslots2.size() < 1024);
+  std::vector<std::pair<Size, Size>> iMatches;
+  if (type == FieldType::STRING_TYPE)
+    iMatches = JoinKeys(ReadKeys(pTable1, pageslots1, joinColRank1, StringKey),
+                        ReadKeys(pTable2, pageslots2, joinColRank2, StringKey),
+                        bHash);
+  else if (IsIntegerType(type) && IsIntegerType(type2))
+    iMatches = JoinKeys(ReadKeys(pTable1, pageslots1, joinColRank1, IntegerKey),
+                        ReadKeys(pTable2, pageslots2, joinColRank2, IntegerKey),
+                        bHash);
+  else
+    iMatches = JoinKeys(ReadKeys(pTable1, pageslots1, joinColRank1, NumberKey),
+                        ReadKeys(pTable2, pageslots2, joinColRank2, NumberKey),
+                        bHash);
+
+  std::vector<Record *> records1(pageslots1.size(), nullptr);
+  std::vector<Record *> records2(pageslots2.size(), nullptr);
+  std::vector<Record *> resultRecords;
+  resultRecords.reserve(iMatches.size());
+  for (const auto &iMatch : iMatches) {
+    // Table::GetRecord 经过表的页面缓存，同一页面上的记录不会重复解析页面
+    Record *&record1 = records1[iMatch.first];
+    Record *&record2 = records2[iMatch.second];
+    if (record1 == nullptr)
+      record1 = pTable1->GetRecord(pageslots1[iMatch.first].first,
+                                   pageslots1[iMatch.first].second);
+    if (record2 == nullptr)
+      record2 = pTable2->GetRecord(pageslots2[iMatch.second].first,
+                                   pageslots2[iMatch.second].second);
+    Record* hitRecord = record1->Copy();
+    hitRecord->Add(record2);
+    resultRecords.emplace_back(hitRecord);
   }
 
   for (size_t i = 0; i < records1.size(); ++i) {
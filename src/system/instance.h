@@ -48,6 +48,34 @@ class Instance {
   PageSlotID Insert(const String &sTableName,
                     const std::vector<String> &iRawVec,
                     Transaction *txn = nullptr);
+  /**
+   * @brief 批量插入多条记录，记录按页面成批写入，索引按键排序后插入，
+   * 事务中的插入一次写入日志
+   *
+   * @return std::vector<PageSlotID> 各条记录插入的位置，与 iRawVecs 顺序一致
+   */
+  std::vector<PageSlotID> InsertBatch(
+      const String &sTableName,
+      const std::vector<std::vector<String>> &iRawVecs,
+      Transaction *txn = nullptr);
+  /**
+   * @brief 从 CSV 文件批量导入记录，不经过 SQL 解析器。
+   * 字段按表中列的顺序排列，未加引号的空字段和 NULL 表示空值，
+   * 每 COPY_BATCH_ROWS 行调用一次批量插入，出错时之前的批次已经插入
+   *
+   * @param cDelim 字段分隔符
+   * @return Size 导入的记录数
+   */
+  Size CopyFrom(const String &sTableName, const String &sPath,
+                char cDelim = ',');
+  /**
+   * @brief 整理表：释放空页面，再把尾部页面的记录移动到前部页面的空闲空间中并释放尾部页面。
+   * 每次整理 VACUUM_STEP_PAGES 个页面，之后更新所有索引中被移动记录的位置。
+   * 日志中记录的是记录位置，有活跃事务时不能整理
+   *
+   * @return Size 释放的页面数量
+   */
+  Size Vacuum(const String &sTableName);
 
   Record *GetRecord(const String &sTableName, const PageSlotID &iPair,
                     Transaction *txn = nullptr) const;
@@ -92,6 +120,14 @@ class Instance {
       std::vector<Condition *> &iJoinConds);
 
  private:
+  /**
+   * @brief 插入已经构建好的记录并维护日志和索引，记录由调用者释放
+   */
+  std::vector<PageSlotID> InsertRecords(const String &sTableName,
+                                        Table *pTable,
+                                        const std::vector<Record *> &iRecordVec,
+                                        Transaction *txn);
+
   TableManager *_pTableManager;
   IndexManager *_pIndexManager;
   TransactionManager *_pTransactionManager;
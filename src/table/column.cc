@@ -3,19 +3,7 @@
 namespace thdb {
 
 Column::Column(const String &sName, FieldType iType)
-    : _sName(sName), _iType(iType) {
-  switch (iType) {
-    case FieldType::INT_TYPE:
-      _nSize = 4;
-      break;
-    case FieldType::FLOAT_TYPE:
-      _nSize = 8;
-      break;
-    default:
-      _nSize = 0;
-      break;
-  }
-}
+    : _sName(sName), _iType(iType), _nSize(GetTypeSize(iType)) {}
 
 Column::Column(const String &sName, FieldType iType, Size nSize)
     : _sName(sName), _iType(iType), _nSize(nSize) {}
@@ -2,10 +2,13 @@
 
 namespace thdb {
 
-Schema::Schema(const std::vector<Column> &iColVec) : _iColVec(iColVec) {}
+Schema::Schema(const std::vector<Column> &iColVec, RecordFormat iFormat)
+    : _iColVec(iColVec), _iFormat(iFormat) {}
 
 Size Schema::GetSize() const { return _iColVec.size(); }
 
 Column Schema::GetColumn(Size nPos) const { return _iColVec[nPos]; }
 
+RecordFormat Schema::GetFormat() const { return _iFormat; }
+
 }  // namespace thdb
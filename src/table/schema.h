@@ -6,22 +6,32 @@
 
 namespace thdb {
 
+// 表中记录在页面上的存储格式
+enum class RecordFormat {
+  FIXED_FORMAT = 0,  // 定长槽，RecordPage + FixedRecord
+  VAR_FORMAT = 1,    // 槽目录 + 变长记录，VarRecordPage + VarRecord
+  PAX_FORMAT = 2     // 定长槽按列存放，PaxRecordPage + FixedRecord
+};
+
 // 模式: 是数据库的组织和结构. 它显示了数据库对象及其相互之间的关系
 // 可以是表(table)、列(column)、数据类型(data type)、视图(view)、存储过程(stored procedures)
 
-// 在这里就是 std::vector<Column> 的封装
+// 在这里就是 std::vector<Column> 的封装，以及表的记录存储格式
 class Schema {
  public:
-  Schema(const std::vector<Column> &iColVec);
+  Schema(const std::vector<Column> &iColVec,
+         RecordFormat iFormat = RecordFormat::FIXED_FORMAT);
   ~Schema() = default;
 
   Size GetSize() const;
   Column GetColumn(Size nPos) const;
+  RecordFormat GetFormat() const;
 
  private:
   std::vector<Column> _iColVec;
+  RecordFormat _iFormat;
 };
 
 }  // namespace thdb
 
-#endif
\ No newline at end of file
+#endif
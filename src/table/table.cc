@@ -2,11 +2,21 @@
 
 #include <cassert>
 #include <algorithm>
+#include <cstring>
+#include <map>
 
+#include "exception/exceptions.h"
 #include "macros.h"
 #include "minios/os.h"
+#include "page/chain_prefetcher.h"
+#include "page/free_space_map.h"
+#include "page/pax_record_page.h"
+#include "page/record_page_cache.h"
 #include "page/record_page.h"
+#include "page/var_record_page.h"
 #include "record/fixed_record.h"
+#include "record/var_record.h"
+#include "settings.h"
 
 namespace thdb {
 
@@ -18,21 +28,54 @@ PageID NextPageID(PageID nCur) {
   return nNext;
 }
 
+// 变长页面的空闲等级以 FREE_LEVEL_UNIT 字节为单位，等级 k 保证能插入 k 个单位长的记录
+const Size FREE_LEVEL_UNIT = 16;
+
+static uint8_t FreeLevel(const RecordPage *pPage) {
+  return std::min<Size>(255, pPage->GetCap() - pPage->GetUsed());
+}
+
+static uint8_t FreeLevel(const VarRecordPage *pPage) {
+  return std::min<Size>(255, pPage->GetInsertSize() / FREE_LEVEL_UNIT);
+}
+
+static uint8_t NeedLevel(PageOffset nSize) {
+  return std::max<Size>(1, (nSize + FREE_LEVEL_UNIT - 1) / FREE_LEVEL_UNIT);
+}
+
 Table::Table(PageID nTableID) {
   pTable = new TablePage(nTableID); // 不会 向OS请求新的页面
 
   _nHeadID = pTable->GetHeadID();
   _nTailID = pTable->GetTailID();
-  _nNotFull = _nHeadID;
+  _iFormat = pTable->GetFormat();
+  Size nCachePages = RECORD_PAGE_CACHE_PAGES;
+  const char *sCachePages = getenv("THDB_PAGE_CACHE");
+  if (sCachePages != nullptr && atoi(sCachePages) > 0)
+    nCachePages = atoi(sCachePages);
+  _pPageCache = new RecordPageCache(
+      nCachePages, _iFormat == RecordFormat::PAX_FORMAT ? pTable->GetSlotSizeVec()
+                                                        : std::vector<Size>());
+  if (pTable->GetFreeMapID() != NULL_PAGE)
+    _pFreeMap = new FreeSpaceMap(pTable->GetFreeMapID());
+  else
+    BuildFreeMap();
+  _nNotFull = NULL_PAGE;
   NextNotFull();
 }
 
-Table::~Table() { delete pTable; }
+Table::~Table() {
+  delete _pPageCache;
+  delete _pFreeMap;
+  delete pTable;
+}
 
 PageID Table::GetPageID() const {
   return pTable->GetPageID();
 }
 
+RecordFormat Table::GetFormat() const { return _iFormat; }
+
 Record *Table::GetRecord(PageID nPageID, SlotID nSlotID) {
   // LAB1 BEGIN
   // 获得一条记录
@@ -41,11 +84,19 @@ Record *Table::GetRecord(PageID nPageID, SlotID nSlotID) {
   // GetSizeVec三个函数可以构建空的 FixedRecord 对象 TIPS:
   // 利用 Record::Load 导入数据 
   // ALERT: 需要注意析构所有不会返回的内容
-  // 1. 新建RecordPage管理对象RecordPage
-  RecordPage* record_page = new RecordPage(nPageID);
+  if (_iFormat == RecordFormat::VAR_FORMAT) {
+    VarRecordPage *pPage = new VarRecordPage(nPageID);
+    uint8_t *pData = pPage->GetRecord(nSlotID);
+    delete pPage;
+    Record *pRecord = EmptyRecord();
+    pRecord->Load(pData);
+    delete[] pData;
+    return pRecord;
+  }
+  // 1. 从缓存获取已解析的RecordPage
+  RecordPage* record_page = _pPageCache->Get(nPageID);
   // 2. RecordPage::GetRecord获取无格式记录数据
   uint8_t* raw_slot_data = record_page->GetRecord(nSlotID);
-  delete record_page;
   // 3. 构建空的FixedRecord对象
   Record* fixed_record = EmptyRecord();
   // 4. fix_record->Load() 从buffer来初始化 fixed_record 的数据成员
@@ -56,6 +107,29 @@ Record *Table::GetRecord(PageID nPageID, SlotID nSlotID) {
   // LAB1 END
 }
 
+void Table::ReadRow(PageID nPageID, SlotID nSlotID, uint8_t *dst) {
+  if (_iFormat != RecordFormat::VAR_FORMAT) {
+    _pPageCache->Get(nPageID)->ReadRecord(nSlotID, dst);
+    return;
+  }
+  // 变长记录转换为定长格式，空值字段填0并在位图中标记
+  Record *pRecord = GetRecord(nPageID, nSlotID);
+  RowView iRow = EmptyRowView();
+  memset(dst, 0, iRow.GetNullBitmapSize());
+  for (Size i = 0; i < iRow.GetSize(); ++i) {
+    Field *pField = pRecord->GetField(i);
+    Size nSize = (i + 1 < iRow.GetSize() ? iRow.GetOffset(i + 1)
+                                         : iRow.GetTotalSize()) -
+                 iRow.GetOffset(i);
+    if (pField->GetType() == FieldType::NONE_TYPE) {
+      memset(dst + iRow.GetOffset(i), 0, nSize);
+      if (iRow.GetNullBitmapSize() > 0) dst[i / 8] |= 1 << (i % 8);
+    } else
+      pField->GetData(dst + iRow.GetOffset(i), nSize);
+  }
+  delete pRecord;
+}
+
 PageSlotID Table::InsertRecord(Record *pRecord) {
   // LAB1 BEGIN
   // 插入一条记录
@@ -63,46 +137,104 @@ PageSlotID Table::InsertRecord(Record *pRecord) {
   // TIPS: 利用 Record::Store 获得序列化数据
   // TIPS: 利用 RecordPage::InsertRecord 插入数据
   // TIPS: 注意页满时更新_nNotFull
-  RecordPage* record_page = new RecordPage(_nNotFull);
+  return InsertRecords({pRecord}).front();
+  // LAB1 END
+}
+
+std::vector<PageSlotID> Table::InsertRecords(
+    const std::vector<Record *> &iRecordVec) {
+  if (_iFormat == RecordFormat::VAR_FORMAT)
+    return InsertVarRecords(iRecordVec);
+  std::vector<PageSlotID> iPairVec;
+  if (iRecordVec.empty()) return iPairVec;
+  iPairVec.reserve(iRecordVec.size());
+  if (_nNotFull == NULL_PAGE) NextNotFull();
+  RecordPage* record_page = _pPageCache->Get(_nNotFull);
   PageOffset _nFixed = record_page->GetFixedSize();
   uint8_t* raw_slot_data = new uint8_t[_nFixed];
-  Size size = pRecord->Store(raw_slot_data);
-  assert(size <= _nFixed);
-  SlotID nSlotID = record_page->InsertRecord(raw_slot_data);
-  PageID nPageID = _nNotFull;
-  PageSlotID location = std::pair<PageID, SlotID>(nPageID, nSlotID);
-  delete[] raw_slot_data;
-  // 页满时更新_nNotFull
-  bool full = record_page->Full();
-  delete record_page; // 先delete, 强制写回
-  if (full) {
-    NextNotFull();
+  for (Record *pRecord : iRecordVec) {
+    Size size = pRecord->Store(raw_slot_data);
+    assert(size <= _nFixed);
+    SlotID nSlotID = record_page->InsertRecord(raw_slot_data);
+    // 空闲空间映射只是提示，页面实际已满时修正后重新查找
+    while (nSlotID == NULL_SLOT) {
+      record_page->Store();
+      _pFreeMap->Update(_nNotFull, FreeLevel(record_page));
+      NextNotFull();
+      record_page = _pPageCache->Get(_nNotFull);
+      nSlotID = record_page->InsertRecord(raw_slot_data);
+    }
+    iPairVec.push_back(std::pair<PageID, SlotID>(_nNotFull, nSlotID));
+    // 页满时才写回位图并更新_nNotFull，同一页面上的记录只写回一次
+    if (record_page->Full()) {
+      record_page->Store();
+      _pFreeMap->Update(_nNotFull, FreeLevel(record_page));
+      NextNotFull();
+      record_page = _pPageCache->Get(_nNotFull);
+    }
   }
-  return location;
-  // LAB1 END
+  delete[] raw_slot_data;
+  record_page->Store(); // 立即写回, 缓存中的对象保持干净
+  _pFreeMap->Update(_nNotFull, FreeLevel(record_page));
+  return iPairVec;
 }
 
 void Table::DeleteRecord(PageID nPageID, SlotID nSlotID) {
   // LAB1 BEGIN
   // TIPS: 利用 RecordPage::DeleteRecord 插入数据
   // TIPS: 注意更新 _nNotFull 来保证较高的页面空间利用效率
-  RecordPage* record_page = new RecordPage(nPageID);
-  record_page->DeleteRecord(nSlotID);
-  _nNotFull = (nPageID < _nNotFull) ? nPageID : _nNotFull;
-  delete record_page;
+  if (_iFormat == RecordFormat::VAR_FORMAT) {
+    VarRecordPage *pPage = new VarRecordPage(nPageID);
+    pPage->DeleteRecord(nSlotID);
+    _pFreeMap->Update(nPageID, FreeLevel(pPage));
+    delete pPage;
+  } else {
+    RecordPage* record_page = _pPageCache->Get(nPageID);
+    record_page->DeleteRecord(nSlotID);
+    record_page->Store();
+    _pFreeMap->Update(nPageID, FreeLevel(record_page));
+  }
+  // 下次插入时重新查找，优先填充链表前部有空间的页面
+  if (nPageID != _nNotFull) _nNotFull = NULL_PAGE;
   // LAB1 END
 }
 
-void Table::UpdateRecord(PageID nPageID, SlotID nSlotID,
-                         const std::vector<Transform> &iTrans) {
+PageSlotID Table::UpdateRecord(PageID nPageID, SlotID nSlotID,
+                               const std::vector<Transform> &iTrans) {
   // LAB1 BEGIN
   // TIPS: 仿照InsertRecord从无格式数据导入原始记录
   // TIPS: 构建Record对象，利用Record::SetField更新Record对象
   // TIPS: Trasform::GetPos表示更新位置，GetField表示更新后的字段
   // TIPS: 将新的记录序列化
   // TIPS: 利用RecordPage::UpdateRecord更新一条数据
-  // 1. 构建RecordPage来管理页面
-  RecordPage* record_page = new RecordPage(nPageID);
+  if (_iFormat == RecordFormat::VAR_FORMAT) {
+    VarRecordPage *pPage = new VarRecordPage(nPageID);
+    uint8_t *pData = pPage->GetRecord(nSlotID);
+    VarRecord *pRecord = dynamic_cast<VarRecord *>(EmptyRecord());
+    pRecord->Load(pData);
+    delete[] pData;
+    for (const auto &iTran : iTrans)
+      pRecord->SetField(iTran.GetPos(), iTran.GetField());
+    pData = new uint8_t[pRecord->GetMaxSize()];
+    Size nSize = pRecord->Store(pData);
+    delete pRecord;
+    PageSlotID iPair(nPageID, nSlotID);
+    // 原页面放不下变长后的记录时，删除后重新插入到其他页面
+    if (nSize > VarRecordPage::GetMaxRecordSize()) {
+      delete pPage;
+      delete[] pData;
+      throw RecordSizeException(nSize);
+    }
+    bool bUpdated = pPage->UpdateRecord(nSlotID, pData, nSize);
+    if (!bUpdated) pPage->DeleteRecord(nSlotID);
+    _pFreeMap->Update(nPageID, FreeLevel(pPage));
+    delete pPage;
+    if (!bUpdated) iPair = InsertVarRecord(pData, nSize);
+    delete[] pData;
+    return iPair;
+  }
+  // 1. 从缓存获取RecordPage来管理页面
+  RecordPage* record_page = _pPageCache->Get(nPageID);
   // 2. RecordPage::GetRecord获取无格式记录数据
   uint8_t* raw_slot_data = record_page->GetRecord(nSlotID);
   // 3. 构建空的FixedRecord对象
@@ -119,10 +251,54 @@ void Table::UpdateRecord(PageID nPageID, SlotID nSlotID,
   record_page->UpdateRecord(nSlotID, raw_slot_data);
   delete[] raw_slot_data;
   delete fixed_record;
-  delete record_page;
+  return std::pair<PageID, SlotID>(nPageID, nSlotID);
   // LAB1 END
 }
 
+// 事务可见且满足检索条件，pCond 为 nullptr 表示查找该表的所有记录
+static bool MatchRecord(Record *pRecord, Condition *pCond,
+                        const Transaction *txn) {
+  if (txn != nullptr) {
+    Size columnNumber = pRecord->GetSize();
+    IntField* txn_field = static_cast<IntField*>(pRecord->GetField(columnNumber-1));
+    TxnID rowTxnID = uint32_t(txn_field->GetIntData());
+    if (!txn->visible(rowTxnID)) return false;
+  }
+  return pCond == nullptr || pCond->Match(*pRecord);
+}
+
+// 把候选槽的空值位图按字节合并，只在整个页面结束时判断一次是否有空值
+static bool HasNull(const RowView &iRow, const uint8_t *pData,
+                    const std::vector<SlotID> &iSlotVec) {
+  Size nBitmapSize = iRow.GetNullBitmapSize();
+  if (nBitmapSize == 0) return false;
+  Size nStride = iRow.GetTotalSize();
+  uint8_t nAny = 0;
+  for (const auto &nSlotID : iSlotVec) {
+    const uint8_t *pBitmap = pData + nSlotID * nStride;
+    for (Size i = 0; i < nBitmapSize; ++i) nAny |= pBitmap[i];
+  }
+  return nAny != 0;
+}
+
+// 在一个页面的候选槽中筛选事务可见且满足检索条件的记录，条件每个页面只调用一次
+static void FilterRows(RowView &iRow, const uint8_t *pData, Condition *pCond,
+                       const Transaction *txn, std::vector<SlotID> &iSlotVec) {
+  if (txn != nullptr) {
+    Size nStride = iRow.GetTotalSize();
+    FieldID nTxnPos = iRow.GetSize() - 1;
+    Size nKept = 0;
+    for (const auto &nSlotID : iSlotVec) {
+      iRow.Reset(pData + nSlotID * nStride);
+      if (txn->visible(uint32_t(iRow.GetInt(nTxnPos))))
+        iSlotVec[nKept++] = nSlotID;
+    }
+    iSlotVec.resize(nKept);
+  }
+  if (pCond != nullptr && !iSlotVec.empty())
+    pCond->Filter(iRow, pData, iSlotVec);
+}
+
 std::vector<PageSlotID> Table::SearchRecord(Condition *pCond, const Transaction *txn) {
   // LAB1 BEGIN
   // 对记录的条件检索
@@ -132,38 +308,118 @@ std::vector<PageSlotID> Table::SearchRecord(Condition *pCond, const Transaction
   // TIPS: 返回所有符合条件的结果的pair<PageID,SlotID>
   // loop
   std::vector<PageSlotID> result;
+  // 列存表只读取检索条件和事务可见性用到的列
+  std::vector<FieldID> iPosVec;
+  bool bColumns = (_iFormat == RecordFormat::PAX_FORMAT) &&
+                  (pCond == nullptr || pCond->GetColumns(iPosVec));
+  if (bColumns && txn != nullptr)
+    iPosVec.push_back(pTable->GetFieldSize() - 1);
+  std::sort(iPosVec.begin(), iPosVec.end());
+  iPosVec.erase(std::unique(iPosVec.begin(), iPosVec.end()), iPosVec.end());
+  // 定长记录按页面整块复制，通过 RowView 的布局按页面批量判断，不为每条记录构建 Record
+  RowView iRow = EmptyRowView();
+  std::vector<uint8_t> iPageData;
+  std::vector<SlotID> iSlotVec;
+  bool bFilter = (pCond != nullptr || txn != nullptr);
+  // 后台沿链表预读，扫描到达时页面已经在缓冲池中
+  ChainPrefetcher iPrefetcher;
   PageID nBegin = _nHeadID;
   while(nBegin != NULL_PAGE) {
     PageID nPageID = nBegin;
-    RecordPage* record_page = new RecordPage(nPageID);
-    Size total_slots = record_page->GetCap();
-    for (Size i = 0; i < total_slots; ++i) {
-      if (record_page->HasRecord(i)) {
-        uint8_t* raw_slot_data = record_page->GetRecord(i);
-        Record* fixed_record = EmptyRecord();
-        Size size = fixed_record->Load(raw_slot_data);
-        delete[] raw_slot_data;
-        // nullptr, 表示查找该表的所有记录
-        if (txn != nullptr) {
-          Size columnNumber = fixed_record->GetSize();
-          IntField* txn_field = dynamic_cast<IntField*>(fixed_record->GetField(columnNumber-1));
-          TxnID rowTxnID = uint32_t(txn_field->GetIntData());
-          if (txn->visible(rowTxnID) && (pCond == nullptr || pCond->Match(*fixed_record))) {
-            result.push_back(std::pair<PageID, SlotID>(nPageID, i));
-          }
-        } else if (pCond == nullptr || pCond->Match(*fixed_record)) {
+    iPrefetcher.Advance(nPageID);
+    if (bColumns) {
+      PaxRecordPage *pPage =
+          dynamic_cast<PaxRecordPage *>(_pPageCache->Get(nPageID));
+      SearchColumns(pPage, iPosVec, pCond, txn, iRow, iPageData, result);
+      nBegin = pPage->GetNextID();
+      continue;
+    }
+    if (_iFormat == RecordFormat::VAR_FORMAT) {
+      VarRecordPage *pPage = new VarRecordPage(nPageID);
+      for (SlotID i = 0; i < pPage->GetSlots(); ++i) {
+        if (!pPage->HasRecord(i)) continue;
+        uint8_t *pData = pPage->GetRecord(i);
+        Record *pRecord = EmptyRecord();
+        pRecord->Load(pData);
+        delete[] pData;
+        if (MatchRecord(pRecord, pCond, txn))
           result.push_back(std::pair<PageID, SlotID>(nPageID, i));
-        }
-        delete fixed_record;
+        delete pRecord;
       }
+      nBegin = pPage->GetNextID();
+      delete pPage;
+      continue;
     }
-    delete record_page;
-    nBegin = NextPageID(nBegin);
+    RecordPage* record_page = _pPageCache->Get(nPageID);
+    Size total_slots = record_page->GetCap();
+    // 按位图直接跳到下一个存在记录的槽
+    iSlotVec.clear();
+    for (Size i = record_page->NextRecord(0); i < total_slots;
+         i = record_page->NextRecord(i + 1))
+      iSlotVec.push_back(i);
+    if (bFilter && !iSlotVec.empty()) {
+      iPageData.resize(total_slots * record_page->GetFixedSize());
+      record_page->ReadSlots(iPageData.data());
+      // 页面中没有空值时，条件判断跳过逐条的空值检查
+      iRow.SetNullFree(!HasNull(iRow, iPageData.data(), iSlotVec));
+      FilterRows(iRow, iPageData.data(), pCond, txn, iSlotVec);
+    }
+    for (const auto &nSlotID : iSlotVec)
+      result.push_back(std::pair<PageID, SlotID>(nPageID, nSlotID));
+    nBegin = record_page->GetNextID();
   }
   return result;
   // LAB1 END
 }
 
+// 按列读取用到的小页，只把这些列按槽转置到 iPageData 中用于条件判断，完整的记录在之后按位置读取
+void Table::SearchColumns(PaxRecordPage *pPage,
+                          const std::vector<FieldID> &iPosVec,
+                          Condition *pCond, const Transaction *txn,
+                          RowView &iRow, std::vector<uint8_t> &iPageData,
+                          std::vector<PageSlotID> &iResult) {
+  PageID nPageID = pPage->GetPageID();
+  Size nCap = pPage->GetCap();
+  std::vector<SlotID> iSlotVec;
+  for (Size i = pPage->NextRecord(0); i < nCap; i = pPage->NextRecord(i + 1))
+    iSlotVec.push_back(i);
+  if (!iPosVec.empty() && !iSlotVec.empty()) {
+    Size nStride = iRow.GetTotalSize();
+    iPageData.resize(nCap * nStride);
+    uint8_t *pData = iPageData.data();
+    // 有空值位图时位图是第一个小页，各列的小页依次后移一位
+    Size nBitmapSize = iRow.GetNullBitmapSize();
+    FieldID nFirst = (nBitmapSize > 0) ? 1 : 0;
+    std::vector<uint8_t> iColumn;
+    bool bNoNull = true;
+    if (nBitmapSize > 0) {
+      // 整个位图小页都为0时页面中没有空值，不再复制位图，条件也不再逐条检查空值
+      iColumn.resize(nCap * nBitmapSize);
+      pPage->GetColumn(0, iColumn.data());
+      bNoNull = std::all_of(iColumn.begin(), iColumn.end(),
+                            [](uint8_t nByte) { return nByte == 0; });
+      if (!bNoNull) {
+        for (const auto &nSlotID : iSlotVec)
+          memcpy(pData + nSlotID * nStride,
+                 iColumn.data() + nSlotID * nBitmapSize, nBitmapSize);
+      }
+    }
+    iRow.SetNullFree(bNoNull);
+    for (const auto &nPos : iPosVec) {
+      Size nSize = pPage->GetColumnSize(nPos + nFirst);
+      Size nOffset = iRow.GetOffset(nPos);
+      iColumn.resize(nCap * nSize);
+      pPage->GetColumn(nPos + nFirst, iColumn.data());
+      for (const auto &nSlotID : iSlotVec)
+        memcpy(pData + nSlotID * nStride + nOffset,
+               iColumn.data() + nSlotID * nSize, nSize);
+    }
+    FilterRows(iRow, pData, pCond, txn, iSlotVec);
+  }
+  for (const auto &nSlotID : iSlotVec)
+    iResult.push_back(std::pair<PageID, SlotID>(nPageID, nSlotID));
+}
+
 void Table::SearchRecord(std::vector<PageSlotID> &iPairs, Condition *pCond) {
   if (!pCond) return;
   auto it = iPairs.begin();
@@ -178,15 +434,17 @@ void Table::SearchRecord(std::vector<PageSlotID> &iPairs, Condition *pCond) {
 }
 
 void Table::Clear() {
+  _pPageCache->Clear();
   PageID nBegin = _nHeadID;
   while (nBegin != NULL_PAGE) {
     PageID nTemp = nBegin;
     nBegin = NextPageID(nBegin);
     MiniOS::GetOS()->DeletePage(nTemp);
   }
+  _pFreeMap->Clear();
 }
 
-void Table::NextNotFull() {
+void Table::NextNotFull(PageOffset nSize) {
   // LAB1 BEGIN
   // 实现一个快速查找非满记录页面的算法
   // ALERT: ！！！一定要注意！！！
@@ -195,32 +453,283 @@ void Table::NextNotFull() {
   // TIPS:
   // 充分利用链表性质，注意全满时需要在结尾_pTable->GetTailID对应结点后插入新的结点，并更新_pTable的TailID
   // TIPS: 只需要保证均摊复杂度较低即可
-  PageID nBegin = _nNotFull;
-  while(nBegin != NULL_PAGE) {
-    PageID nCur = nBegin;
-    RecordPage* record_page = new RecordPage(nCur);
-    bool full = record_page->Full();
-    delete record_page;
-    if (full) {
-      nBegin = NextPageID(nBegin);
-    } else {
-      _nNotFull = nCur;
-      break;
-    }
-  }
+  // 空闲空间映射中按页面加入的顺序查找第一个空间足够的页面
+  _nNotFull = _pFreeMap->Find(NeedLevel(nSize));
   // 创建新页面, 加到链表尾部
-  if (nBegin == NULL_PAGE) {
-    RecordPage* record_page = new RecordPage(pTable->GetTotalSize(), true);
-    RecordPage* prev_tail_page = new RecordPage(_nTailID);
+  if (_nNotFull == NULL_PAGE) {
+    // 新页面尽量紧跟在尾页面之后，顺序扫描时访问相邻的页面
+    LinkedPage* record_page = nullptr;
+    if (_iFormat == RecordFormat::VAR_FORMAT)
+      record_page = new VarRecordPage(_nTailID, true);
+    else if (_iFormat == RecordFormat::PAX_FORMAT)
+      record_page = new PaxRecordPage(pTable->GetSlotSizeVec(), true, _nTailID);
+    else
+      record_page = new RecordPage(pTable->GetTotalSize(), true, _nTailID);
+    // 尾页面的链表指针不经过缓存修改
+    _pPageCache->Invalidate(_nTailID);
+    LinkedPage* prev_tail_page = new LinkedPage(_nTailID);
     prev_tail_page->PushBack(record_page);
     pTable->SetTailID(record_page->GetPageID());
     _nNotFull = _nTailID = pTable->GetTailID();
     delete prev_tail_page;
+    if (_iFormat == RecordFormat::VAR_FORMAT)
+      _pFreeMap->Update(_nTailID,
+                        FreeLevel(dynamic_cast<VarRecordPage *>(record_page)));
+    else
+      _pFreeMap->Update(_nTailID,
+                        FreeLevel(dynamic_cast<RecordPage *>(record_page)));
     delete record_page;
   }
   // LAB1 END
 }
 
+// 早期版本的表没有空闲空间映射，打开时沿链表扫描一次建立
+void Table::BuildFreeMap() {
+  _pFreeMap = new FreeSpaceMap(pTable->GetPageID(), true);
+  PageID nPageID = _nHeadID;
+  while (nPageID != NULL_PAGE) {
+    PageID nNext = NULL_PAGE;
+    if (_iFormat == RecordFormat::VAR_FORMAT) {
+      VarRecordPage *pPage = new VarRecordPage(nPageID);
+      _pFreeMap->Update(nPageID, FreeLevel(pPage));
+      nNext = pPage->GetNextID();
+      delete pPage;
+    } else {
+      RecordPage *pPage = _pPageCache->Get(nPageID);
+      _pFreeMap->Update(nPageID, FreeLevel(pPage));
+      nNext = pPage->GetNextID();
+    }
+    nPageID = nNext;
+  }
+  pTable->SetFreeMapID(_pFreeMap->GetRootID());
+}
+
+// 先序列化所有记录并检查长度，有记录过长时不插入任何记录
+std::vector<PageSlotID> Table::InsertVarRecords(
+    const std::vector<Record *> &iRecordVec) {
+  std::vector<uint8_t> iData;
+  std::vector<Size> iEndVec;
+  for (Record *pRecord : iRecordVec) {
+    VarRecord *pVar = dynamic_cast<VarRecord *>(pRecord);
+    assert(pVar != nullptr);
+    Size nBegin = iData.size();
+    iData.resize(nBegin + pVar->GetMaxSize());
+    Size nSize = pVar->Store(iData.data() + nBegin);
+    if (nSize > VarRecordPage::GetMaxRecordSize())
+      throw RecordSizeException(nSize);
+    iData.resize(nBegin + nSize);
+    iEndVec.push_back(iData.size());
+  }
+  std::vector<PageSlotID> iPairVec;
+  if (iRecordVec.empty()) return iPairVec;
+  iPairVec.reserve(iRecordVec.size());
+  if (_nNotFull == NULL_PAGE) NextNotFull(iEndVec[0]);
+  VarRecordPage *pPage = new VarRecordPage(_nNotFull);
+  Size nBegin = 0;
+  for (Size nEnd : iEndVec) {
+    const uint8_t *src = iData.data() + nBegin;
+    PageOffset nSize = nEnd - nBegin;
+    nBegin = nEnd;
+    SlotID nSlotID = pPage->InsertRecord(src, nSize);
+    // 当前页面放不下时写回，再按映射中的等级查找其他页面
+    while (nSlotID == NULL_SLOT) {
+      _pFreeMap->Update(_nNotFull, FreeLevel(pPage));
+      delete pPage;
+      NextNotFull(nSize);
+      pPage = new VarRecordPage(_nNotFull);
+      nSlotID = pPage->InsertRecord(src, nSize);
+    }
+    iPairVec.push_back(std::pair<PageID, SlotID>(_nNotFull, nSlotID));
+  }
+  _pFreeMap->Update(_nNotFull, FreeLevel(pPage));
+  delete pPage;
+  return iPairVec;
+}
+
+// 变长表不在插入后检查页满，放不下时才向后查找
+PageSlotID Table::InsertVarRecord(const uint8_t *src, PageOffset nSize) {
+  if (_nNotFull == NULL_PAGE) NextNotFull(nSize);
+  VarRecordPage *pPage = new VarRecordPage(_nNotFull);
+  SlotID nSlotID = pPage->InsertRecord(src, nSize);
+  // 放不下时按映射中的等级查找其他页面，映射过时的页面在这里得到修正
+  while (nSlotID == NULL_SLOT) {
+    _pFreeMap->Update(_nNotFull, FreeLevel(pPage));
+    delete pPage;
+    NextNotFull(nSize);
+    pPage = new VarRecordPage(_nNotFull);
+    nSlotID = pPage->InsertRecord(src, nSize);
+  }
+  _pFreeMap->Update(_nNotFull, FreeLevel(pPage));
+  delete pPage;
+  return std::pair<PageID, SlotID>(_nNotFull, nSlotID);
+}
+
+// 相邻页面的链表指针不经过缓存修改
+void Table::UnlinkPage(PageID nPageID) {
+  assert(nPageID != _nHeadID);
+  _pPageCache->Invalidate(nPageID);
+  LinkedPage *pPage = new LinkedPage(nPageID);
+  PageID nPrevID = pPage->GetPrevID();
+  PageID nNextID = pPage->GetNextID();
+  delete pPage;
+  _pPageCache->Invalidate(nPrevID);
+  LinkedPage *pPrev = new LinkedPage(nPrevID);
+  pPrev->SetNextID(nNextID);
+  delete pPrev;
+  if (nNextID != NULL_PAGE) {
+    _pPageCache->Invalidate(nNextID);
+    LinkedPage *pNext = new LinkedPage(nNextID);
+    pNext->SetPrevID(nPrevID);
+    delete pNext;
+  } else {
+    pTable->SetTailID(nPrevID);
+    _nTailID = nPrevID;
+  }
+  _pFreeMap->Remove(nPageID);
+  if (_nNotFull == nPageID) _nNotFull = NULL_PAGE;
+  MiniOS::GetOS()->DeletePage(nPageID);
+}
+
+Size Table::FreeEmptyPages() {
+  Size nFreed = 0;
+  PageID nPageID = NextPageID(_nHeadID);
+  while (nPageID != NULL_PAGE) {
+    PageID nNext = NULL_PAGE;
+    bool bEmpty = false;
+    if (_iFormat == RecordFormat::VAR_FORMAT) {
+      VarRecordPage *pPage = new VarRecordPage(nPageID);
+      bEmpty = (pPage->GetUsed() == 0);
+      nNext = pPage->GetNextID();
+      delete pPage;
+    } else {
+      RecordPage *pPage = _pPageCache->Get(nPageID);
+      bEmpty = (pPage->GetUsed() == 0);
+      nNext = pPage->GetNextID();
+    }
+    if (bEmpty) {
+      UnlinkPage(nPageID);
+      ++nFreed;
+    }
+    nPageID = nNext;
+  }
+  return nFreed;
+}
+
+bool Table::CompactStep(Size nPages,
+                        std::vector<std::pair<PageSlotID, PageSlotID>> &iMoved,
+                        Size &nFreed) {
+  // 记录在同一步中可能先被移动到之后成为尾页面的页面，再被移走，只保留最终位置
+  std::map<PageSlotID, Size> iMovedPos;
+  for (Size i = 0; i < iMoved.size(); ++i) iMovedPos[iMoved[i].second] = i;
+  std::vector<std::pair<PageSlotID, PageSlotID>> iPageMoved;
+  for (Size i = 0; i < nPages; ++i) {
+    if (_nTailID == _nHeadID) return false;
+    PageID nPageID = _nTailID;
+    // 尾页面不作为移动的目标
+    _pFreeMap->Remove(nPageID);
+    iPageMoved.clear();
+    bool bEmpty = (_iFormat == RecordFormat::VAR_FORMAT)
+                      ? MoveVarRecords(nPageID, iPageMoved)
+                      : MoveRecords(nPageID, iPageMoved);
+    for (const auto &iMove : iPageMoved) {
+      auto it = iMovedPos.find(iMove.first);
+      if (it == iMovedPos.end()) {
+        iMovedPos[iMove.second] = iMoved.size();
+        iMoved.push_back(iMove);
+      } else {
+        Size nPos = it->second;
+        iMovedPos.erase(it);
+        iMoved[nPos].second = iMove.second;
+        iMovedPos[iMove.second] = nPos;
+      }
+    }
+    if (!bEmpty) return false;
+    UnlinkPage(nPageID);
+    ++nFreed;
+  }
+  return _nTailID != _nHeadID;
+}
+
+bool Table::MoveRecords(
+    PageID nPageID, std::vector<std::pair<PageSlotID, PageSlotID>> &iMoved) {
+  // 同时使用两个页面，源页面不放在缓存中，避免被目标页面淘汰
+  _pPageCache->Invalidate(nPageID);
+  RecordPage *pSrc = nullptr;
+  if (_iFormat == RecordFormat::PAX_FORMAT)
+    pSrc = new PaxRecordPage(nPageID, pTable->GetSlotSizeVec());
+  else
+    pSrc = new RecordPage(nPageID);
+  PageID nDstID = NULL_PAGE;
+  RecordPage *pDst = nullptr;
+  SlotID nSlotID = pSrc->NextRecord(0);
+  while (nSlotID < pSrc->GetCap()) {
+    if (pDst == nullptr) {
+      nDstID = _pFreeMap->Find(NeedLevel(0));
+      if (nDstID == NULL_PAGE) break;
+      pDst = _pPageCache->Get(nDstID);
+    }
+    uint8_t *pData = pSrc->GetRecord(nSlotID);
+    SlotID nNewID = pDst->InsertRecord(pData);
+    delete[] pData;
+    if (nNewID != NULL_SLOT) {
+      pSrc->DeleteRecord(nSlotID);
+      iMoved.push_back({{nPageID, nSlotID}, {nDstID, nNewID}});
+      nSlotID = pSrc->NextRecord(nSlotID + 1);
+    }
+    // 目标页面已满或映射过时，写回后重新查找
+    if (nNewID == NULL_SLOT || pDst->Full()) {
+      pDst->Store();
+      _pFreeMap->Update(nDstID, FreeLevel(pDst));
+      pDst = nullptr;
+    }
+  }
+  if (pDst != nullptr) {
+    pDst->Store();
+    _pFreeMap->Update(nDstID, FreeLevel(pDst));
+  }
+  bool bEmpty = (pSrc->GetUsed() == 0);
+  if (!bEmpty) _pFreeMap->Update(nPageID, FreeLevel(pSrc));
+  delete pSrc;
+  return bEmpty;
+}
+
+bool Table::MoveVarRecords(
+    PageID nPageID, std::vector<std::pair<PageSlotID, PageSlotID>> &iMoved) {
+  VarRecordPage *pSrc = new VarRecordPage(nPageID);
+  PageID nDstID = NULL_PAGE;
+  VarRecordPage *pDst = nullptr;
+  for (SlotID i = 0; i < pSrc->GetSlots(); ++i) {
+    if (!pSrc->HasRecord(i)) continue;
+    PageOffset nSize = pSrc->GetRecordSize(i);
+    uint8_t *pData = pSrc->GetRecord(i);
+    SlotID nNewID = (pDst != nullptr) ? pDst->InsertRecord(pData, nSize) : NULL_SLOT;
+    // 当前目标页面放不下时按映射中的等级查找其他页面
+    while (nNewID == NULL_SLOT) {
+      if (pDst != nullptr) {
+        _pFreeMap->Update(nDstID, FreeLevel(pDst));
+        delete pDst;
+        pDst = nullptr;
+      }
+      nDstID = _pFreeMap->Find(NeedLevel(nSize));
+      if (nDstID == NULL_PAGE) break;
+      pDst = new VarRecordPage(nDstID);
+      nNewID = pDst->InsertRecord(pData, nSize);
+    }
+    delete[] pData;
+    if (nNewID == NULL_SLOT) break;
+    pSrc->DeleteRecord(i);
+    iMoved.push_back({{nPageID, i}, {nDstID, nNewID}});
+  }
+  if (pDst != nullptr) {
+    _pFreeMap->Update(nDstID, FreeLevel(pDst));
+    delete pDst;
+  }
+  bool bEmpty = (pSrc->GetUsed() == 0);
+  if (!bEmpty) _pFreeMap->Update(nPageID, FreeLevel(pSrc));
+  delete pSrc;
+  return bEmpty;
+}
+
 FieldID Table::GetPos(const String &sCol) const { return pTable->GetPos(sCol); }
 
 FieldType Table::GetType(const String &sCol) const {
@@ -230,11 +739,20 @@ FieldType Table::GetType(const String &sCol) const {
 Size Table::GetSize(const String &sCol) const { return pTable->GetSize(sCol); }
 
 Record *Table::EmptyRecord() const {
-  FixedRecord *pRecord = new FixedRecord(
-      pTable->GetFieldSize(), pTable->GetTypeVec(), pTable->GetSizeVec());
+  if (_iFormat == RecordFormat::VAR_FORMAT)
+    return new VarRecord(pTable->GetFieldSize(), pTable->GetTypeVec(),
+                         pTable->GetSizeVec());
+  FixedRecord *pRecord =
+      new FixedRecord(pTable->GetFieldSize(), pTable->GetTypeVec(),
+                      pTable->GetSizeVec(), pTable->HasNullBitmap());
   return pRecord;
 }
 
+RowView Table::EmptyRowView() const {
+  return RowView(pTable->GetTypeVec(), pTable->GetSizeVec(),
+                 pTable->HasNullBitmap());
+}
+
 bool CmpByFieldID(const std::pair<String, FieldID> &a,
                   const std::pair<String, FieldID> &b) {
   return a.second < b.second;
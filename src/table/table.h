@@ -5,12 +5,17 @@
 #include "defines.h"
 #include "page/table_page.h"
 #include "record/record.h"
+#include "record/row_view.h"
 #include "record/transform.h"
 #include "table/schema.h"
 #include "transaction/transaction.h"
 
 namespace thdb {
 
+class FreeSpaceMap;
+class PaxRecordPage;
+class RecordPageCache;
+
 class Table {
  public:
   Table(PageID nTableID);
@@ -24,6 +29,13 @@ class Table {
    * @return Record* 对应记录
    */
   Record *GetRecord(PageID nPageID, SlotID nSlotID);
+  /**
+   * @brief 把一个指定位置的记录定长格式化的内容读到 dst，配合 RowView 使用。
+   * 定长表和列存表经过页面缓存直接复制，不构建 Record
+   *
+   * @param dst 长度至少为 EmptyRowView().GetTotalSize()
+   */
+  void ReadRow(PageID nPageID, SlotID nSlotID, uint8_t *dst);
   /**
    * @brief 插入一条数据
    *
@@ -31,6 +43,13 @@ class Table {
    * @return PageSlotID 插入的位置
    */
   PageSlotID InsertRecord(Record *pRecord);
+  /**
+   * @brief 批量插入数据，每个页面只打开和写回一次
+   *
+   * @param iRecordVec 待插入数据
+   * @return std::vector<PageSlotID> 各条数据插入的位置，与 iRecordVec 顺序一致
+   */
+  std::vector<PageSlotID> InsertRecords(const std::vector<Record *> &iRecordVec);
   /**
    * @brief 删除一条数据
    *
@@ -44,9 +63,10 @@ class Table {
    * @param nPageID 页编号
    * @param nSlotID 槽编号
    * @param iTrans 更新变化方式
+   * @return PageSlotID 更新后的位置，变长记录在原页面放不下时会移动到其他页面
    */
-  void UpdateRecord(PageID nPageID, SlotID nSlotID,
-                    const std::vector<Transform> &iTrans);
+  PageSlotID UpdateRecord(PageID nPageID, SlotID nSlotID,
+                          const std::vector<Transform> &iTrans);
   /**
    * @brief 条件检索
    *
@@ -61,6 +81,23 @@ class Table {
    *
    */
   void Clear();
+  /**
+   * @brief 从链表中摘下并释放除第一个页面之外的所有空页面
+   *
+   * @return Size 释放的页面数量
+   */
+  Size FreeEmptyPages();
+  /**
+   * @brief 整理的一步：把链表最后至多 nPages 个页面中的记录移动到其他有空闲空间的页面，
+   * 并释放移空的页面。每一步结束后表处于一致的状态，调用者据此更新索引
+   *
+   * @param iMoved 被移动记录的原位置和新位置，同一步中移动多次的记录只出现一次
+   * @param nFreed 累加释放的页面数量
+   * @return bool 其他页面已经放不下尾页面的记录、整理结束时返回 false
+   */
+  bool CompactStep(Size nPages,
+                   std::vector<std::pair<PageSlotID, PageSlotID>> &iMoved,
+                   Size &nFreed);
 
   FieldID GetPos(const String &sCol) const;
   FieldType GetType(const String &sCol) const;
@@ -71,9 +108,18 @@ class Table {
    * @return Record* 生成的空记录体
    */
   Record *EmptyRecord() const;
+  /**
+   * @brief 生成一个按本表字段布局读取定长格式化记录的视图
+   */
+  RowView EmptyRowView() const;
 
   std::vector<String> GetColumnNames() const;
   PageID GetPageID() const;
+  /**
+   * @brief 表中记录的存储格式，定长表使用 RecordPage，变长表使用 VarRecordPage，
+   * 列存表使用 PaxRecordPage
+   */
+  RecordFormat GetFormat() const;
 
  private:
   TablePage *pTable;
@@ -81,14 +127,61 @@ class Table {
   PageID _nTailID;
   /**
    * @brief 表示一个非满页编号，可用于构建一个时空高效的记录插入算法。
+   * 为 NULL_PAGE 时下次插入前通过空闲空间映射重新查找。
    */
   PageID _nNotFull;
+  RecordFormat _iFormat;
+  /**
+   * @brief 表中各记录页面的空闲空间等级，保存在表自己的映射页面中
+   */
+  FreeSpaceMap *_pFreeMap;
+  /**
+   * @brief 已解析的定长或列存记录页面，表的所有访问路径共用，变长表不使用
+   */
+  RecordPageCache *_pPageCache;
 
   /**
-   * @brief 查找一个可用于插入新记录的页面，不存在时自动添加一个新的页面
+   * @brief 通过空闲空间映射查找一个可用于插入新记录的页面，不存在时自动添加一个新的页面
+   *
+   * @param nSize 变长表中待插入记录的长度，定长表忽略
+   */
+  void NextNotFull(PageOffset nSize = 0);
+  /**
+   * @brief 扫描所有记录页面，为没有空闲空间映射的表建立映射
+   */
+  void BuildFreeMap();
+  /**
+   * @brief 向变长表插入一条序列化后的记录
+   */
+  PageSlotID InsertVarRecord(const uint8_t *src, PageOffset nSize);
+  /**
+   * @brief 向变长表批量插入记录
+   */
+  std::vector<PageSlotID> InsertVarRecords(
+      const std::vector<Record *> &iRecordVec);
+  /**
+   * @brief 在列存页面中检索，只读取 iPosVec 中的列
+   * @param iRow 记录的布局
+   * @param iPageData 转置后的记录，只有 iPosVec 中的列会被填充
+   */
+  void SearchColumns(PaxRecordPage *pPage, const std::vector<FieldID> &iPosVec,
+                     Condition *pCond, const Transaction *txn, RowView &iRow,
+                     std::vector<uint8_t> &iPageData,
+                     std::vector<PageSlotID> &iResult);
+  /**
+   * @brief 从链表中摘下一个记录页面并释放，第一个页面始终保留
+   */
+  void UnlinkPage(PageID nPageID);
+  /**
+   * @brief 把页面中的记录逐条移动到空闲空间映射中的其他页面，调用前页面已经从映射中移除
    *
+   * @param iMoved 追加每条移动的记录对应的原位置和新位置
+   * @return bool 页面中的记录全部移走时返回 true
    */
-  void NextNotFull();
+  bool MoveRecords(PageID nPageID,
+                   std::vector<std::pair<PageSlotID, PageSlotID>> &iMoved);
+  bool MoveVarRecords(PageID nPageID,
+                      std::vector<std::pair<PageSlotID, PageSlotID>> &iMoved);
 };
 
 }  // namespace thdb
@@ -0,0 +1,133 @@
+#include "utils/arena.h"
+
+#include <assert.h>
+
+#include <mutex>
+#include <new>
+
+#include "settings.h"
+
+namespace thdb {
+
+namespace {
+
+// 每次分配前的头部，记录所属的内存池(堆上分配时为 nullptr)和大小等级
+struct BlockHeader {
+  Arena *pArena;
+  size_t nClass;
+};
+
+const Size ARENA_ALIGN = 16;
+// 不超过该等级(512字节)的块释放后挂在空闲链表上复用
+const Size ARENA_SMALL_CLASSES = 32;
+// 超过块大小四分之一的分配直接使用堆
+const Size ARENA_LARGE_CLASS = ARENA_CHUNK_SIZE / 4 / ARENA_ALIGN;
+
+thread_local Arena *pCurrentArena = nullptr;
+
+std::mutex iPoolMutex;
+std::vector<uint8_t *> iChunkPool;
+
+uint8_t *NewChunk() {
+  {
+    std::lock_guard<std::mutex> iLock(iPoolMutex);
+    if (!iChunkPool.empty()) {
+      uint8_t *pChunk = iChunkPool.back();
+      iChunkPool.pop_back();
+      return pChunk;
+    }
+  }
+  return (uint8_t *)::operator new(ARENA_CHUNK_SIZE);
+}
+
+void DeleteChunk(uint8_t *pChunk) {
+  {
+    std::lock_guard<std::mutex> iLock(iPoolMutex);
+    if (iChunkPool.size() < ARENA_POOL_CHUNKS) {
+      iChunkPool.push_back(pChunk);
+      return;
+    }
+  }
+  ::operator delete(pChunk);
+}
+
+}  // namespace
+
+static_assert(sizeof(BlockHeader) == ARENA_ALIGN, "header keeps alignment");
+
+Arena::Arena()
+    : _nRef(1),
+      _pCur(nullptr),
+      _pEnd(nullptr),
+      _iFreeVec(ARENA_SMALL_CLASSES + 1, nullptr) {}
+
+Arena::~Arena() {
+  assert(pCurrentArena != this);
+  for (const auto &pChunk : _iChunkVec) DeleteChunk(pChunk);
+}
+
+void Arena::Ref() { ++_nRef; }
+
+void Arena::Unref() {
+  assert(_nRef > 0);
+  if (--_nRef == 0) delete this;
+}
+
+Arena *Arena::Current() { return pCurrentArena; }
+
+void *Arena::New(size_t nSize) {
+  Size nClass = (nSize + sizeof(BlockHeader) + ARENA_ALIGN - 1) / ARENA_ALIGN;
+  Arena *pArena = pCurrentArena;
+  BlockHeader *pHeader;
+  if (pArena != nullptr && nClass <= ARENA_LARGE_CLASS) {
+    pHeader = (BlockHeader *)pArena->Allocate(nClass);
+  } else {
+    pArena = nullptr;
+    pHeader = (BlockHeader *)::operator new(nClass * ARENA_ALIGN);
+  }
+  pHeader->pArena = pArena;
+  pHeader->nClass = nClass;
+  return pHeader + 1;
+}
+
+void Arena::Delete(void *pData) {
+  if (pData == nullptr) return;
+  BlockHeader *pHeader = (BlockHeader *)pData - 1;
+  if (pHeader->pArena == nullptr) {
+    ::operator delete(pHeader);
+  } else {
+    pHeader->pArena->Free(pHeader, pHeader->nClass);
+  }
+}
+
+void *Arena::Allocate(Size nClass) {
+  if (nClass <= ARENA_SMALL_CLASSES && _iFreeVec[nClass] != nullptr) {
+    void *pBlock = _iFreeVec[nClass];
+    _iFreeVec[nClass] = *(void **)pBlock;
+    return pBlock;
+  }
+  Size nBytes = nClass * ARENA_ALIGN;
+  if (_pCur == nullptr || _pCur + nBytes > _pEnd) {
+    _iChunkVec.push_back(NewChunk());
+    _pCur = _iChunkVec.back();
+    _pEnd = _pCur + ARENA_CHUNK_SIZE;
+  }
+  void *pBlock = _pCur;
+  _pCur += nBytes;
+  return pBlock;
+}
+
+void Arena::Free(void *pBlock, Size nClass) {
+  // 较大的块不再复用，随内存池一起回收
+  if (nClass > ARENA_SMALL_CLASSES) return;
+  *(void **)pBlock = _iFreeVec[nClass];
+  _iFreeVec[nClass] = pBlock;
+}
+
+ArenaScope::ArenaScope(Arena *pArena) : _pPrev(pCurrentArena) {
+  pCurrentArena = pArena;
+}
+
+ArenaScope::~ArenaScope() { pCurrentArena = _pPrev; }
+
+}  // namespace thdb
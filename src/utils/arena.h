@@ -0,0 +1,97 @@
+#ifndef THDB_ARENA_H_
+#define THDB_ARENA_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief 一条语句的内存池。
+ * 从 ARENA_CHUNK_SIZE 大小的块中顺序分配，释放的小块按大小挂在空闲链表上供后续分配复用，
+ * 池本身销毁时一次性归还所有块，归还的块留在全局的块池中供下一条语句使用。
+ * 内存池由引用计数管理，执行语句时持有一个引用，语句产生的每个 Result 各持有一个引用，
+ * 最后一个引用释放时销毁。
+ * 内存池不是线程安全的，只在设置了它的线程中分配和释放。
+ */
+class Arena {
+ public:
+  Arena();
+
+  void Ref();
+  void Unref();
+
+  /**
+   * @brief 当前线程正在使用的内存池，没有时返回 nullptr
+   */
+  static Arena *Current();
+  /**
+   * @brief 当前线程有内存池时从池中分配，否则从堆上分配
+   */
+  static void *New(size_t nSize);
+  /**
+   * @brief 释放 New 分配的空间，池中的空间在池销毁前只用于复用
+   */
+  static void Delete(void *pData);
+
+ private:
+  ~Arena();
+
+  void *Allocate(Size nClass);
+  void Free(void *pBlock, Size nClass);
+
+  Size _nRef;
+  std::vector<uint8_t *> _iChunkVec;
+  uint8_t *_pCur;
+  uint8_t *_pEnd;
+  // 按大小等级(16字节为一级)划分的空闲链表
+  std::vector<void *> _iFreeVec;
+};
+
+/**
+ * @brief 在作用域内把内存池设为当前线程的内存池，结束时恢复原来的设置
+ */
+class ArenaScope {
+ public:
+  ArenaScope(Arena *pArena);
+  ~ArenaScope();
+
+ private:
+  Arena *_pPrev;
+};
+
+/**
+ * @brief 通过 Arena::New/Delete 分配的 STL 分配器，
+ * 用于记录内部随记录一起创建和销毁的数组
+ */
+template <typename T>
+class ArenaAllocator {
+ public:
+  typedef T value_type;
+
+  ArenaAllocator() = default;
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U> &) {}
+
+  T *allocate(size_t n) { return (T *)Arena::New(n * sizeof(T)); }
+  void deallocate(T *p, size_t) { Arena::Delete(p); }
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T> &, const ArenaAllocator<U> &) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &, const ArenaAllocator<U> &) {
+  return false;
+}
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+}  // namespace thdb
+
+#endif  // THDB_ARENA_H_
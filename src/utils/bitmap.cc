@@ -4,30 +4,41 @@
 
 namespace thdb {
 
+const Size WORD_BITS = 64;
+
+// 序列化后的字节数
+static Size GetBytes(Size size) { return (size - 1) / 8 + 1; }
+
 Bitmap::Bitmap(Size size) {
-  _pBits = new uint8_t[(size - 1) / 8 + 1];
-  memset(_pBits, 0, (size - 1) / 8 + 1);
+  _nWords = (size + WORD_BITS - 1) / WORD_BITS;
+  _pWords = new uint64_t[_nWords];
+  memset(_pWords, 0, _nWords * sizeof(uint64_t));
   _nSize = size;
   _nUsed = 0;
+  _bDirty = false;
 }
 
-Bitmap::~Bitmap() { delete[] _pBits; }
+Bitmap::~Bitmap() { delete[] _pWords; }
 
 void Bitmap::Set(Size pos) {
   if (!Get(pos)) {
-    _pBits[pos >> 3] |= (1 << (pos & 7));
+    _pWords[pos / WORD_BITS] |= (uint64_t)1 << (pos % WORD_BITS);
     ++_nUsed;
+    _bDirty = true;
   }
 }
 
 void Bitmap::Unset(Size pos) {
   if (Get(pos)) {
-    _pBits[pos >> 3] &= ~(1 << (pos & 7));
+    _pWords[pos / WORD_BITS] &= ~((uint64_t)1 << (pos % WORD_BITS));
     --_nUsed;
+    _bDirty = true;
   }
 }
 
-bool Bitmap::Get(Size pos) const { return _pBits[pos >> 3] & (1 << (pos & 7)); }
+bool Bitmap::Get(Size pos) const {
+  return _pWords[pos / WORD_BITS] >> (pos % WORD_BITS) & 1;
+}
 
 Size Bitmap::GetSize() const { return _nSize; }
 
@@ -37,16 +48,48 @@ bool Bitmap::Empty() const { return _nUsed == 0; }
 
 bool Bitmap::Full() const { return _nUsed == _nSize; }
 
-// 将 pBits 反序列化到 Bitmap
+// 屏蔽掉第一个字中 pos 之前的位，之后逐字跳过全0的字
+Size Bitmap::NextSet(Size pos) const {
+  if (pos >= _nSize) return _nSize;
+  Size nWord = pos / WORD_BITS;
+  uint64_t nBits = _pWords[nWord] & (~(uint64_t)0 << (pos % WORD_BITS));
+  while (nBits == 0) {
+    if (++nWord == _nWords) return _nSize;
+    nBits = _pWords[nWord];
+  }
+  return nWord * WORD_BITS + __builtin_ctzll(nBits);
+}
+
+// 最后一个字中超出 _nSize 的位始终为0，找到时需要检查是否越界
+Size Bitmap::NextClear(Size pos) const {
+  if (pos >= _nSize) return _nSize;
+  Size nWord = pos / WORD_BITS;
+  uint64_t nBits = ~_pWords[nWord] & (~(uint64_t)0 << (pos % WORD_BITS));
+  while (nBits == 0) {
+    if (++nWord == _nWords) return _nSize;
+    nBits = ~_pWords[nWord];
+  }
+  Size nPos = nWord * WORD_BITS + __builtin_ctzll(nBits);
+  return nPos < _nSize ? nPos : _nSize;
+}
+
+bool Bitmap::IsDirty() const { return _bDirty; }
+
+// 将 pBits 反序列化到 Bitmap，小端序下字节数组与64位字数组布局一致
 void Bitmap::Load(const uint8_t *pBits) {
-  memcpy(_pBits, pBits, (_nSize - 1) / 8 + 1);
-  for (Size i = 0; i < _nSize; ++i)
-    if (Get(i)) ++_nUsed;
+  memset(_pWords, 0, _nWords * sizeof(uint64_t));
+  memcpy(_pWords, pBits, GetBytes(_nSize));
+  if (_nSize % WORD_BITS)
+    _pWords[_nWords - 1] &= ~(~(uint64_t)0 << (_nSize % WORD_BITS));
+  _nUsed = 0;
+  for (Size i = 0; i < _nWords; ++i) _nUsed += __builtin_popcountll(_pWords[i]);
+  _bDirty = false;
 }
 
 // 将 Bitmap 序列化到 pBits
 void Bitmap::Store(uint8_t *pBits) {
-  memcpy(pBits, _pBits, (_nSize - 1) / 8 + 1);
+  memcpy(pBits, _pWords, GetBytes(_nSize));
+  _bDirty = false;
 }
 
 }  // namespace thdb
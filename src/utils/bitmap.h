@@ -8,6 +8,11 @@
 
 namespace thdb {
 
+/**
+ * @brief 以64位字为单位存储的位图。
+ * 统计和查找按字进行，字内用 popcount 和 ctz 计算，序列化格式仍为小端序的字节数组。
+ * 位图记录自上次 Load/Store 以来是否被修改过，未修改的位图不需要写回。
+ */
 class Bitmap {
  public:
   Bitmap(Size size);
@@ -20,13 +25,27 @@ class Bitmap {
   Size GetUsed() const;
   bool Full() const;
   bool Empty() const;
+  /**
+   * @brief 返回不小于 pos 的第一个被设置的位，不存在时返回 GetSize()
+   */
+  Size NextSet(Size pos) const;
+  /**
+   * @brief 返回不小于 pos 的第一个未被设置的位，不存在时返回 GetSize()
+   */
+  Size NextClear(Size pos) const;
+  /**
+   * @brief 上次 Load/Store 之后是否被修改过
+   */
+  bool IsDirty() const;
   void Load(const uint8_t *pBits);
   void Store(uint8_t *pBits);
 
  private:
-  uint8_t *_pBits;
+  uint64_t *_pWords;
+  Size _nWords;
   Size _nSize;
   Size _nUsed;
+  bool _bDirty;
 };
 
 }  // namespace thdb
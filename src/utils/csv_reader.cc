@@ -0,0 +1,132 @@
+#include "utils/csv_reader.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "exception/exceptions.h"
+#include "settings.h"
+
+namespace thdb {
+
+CsvReader::CsvReader(const String &sPath, char cDelim)
+    : _nCapacity(COPY_BUFFER_SIZE),
+      _nBegin(0),
+      _nEnd(0),
+      _bEOF(false),
+      _cDelim(cDelim),
+      _nLine(0),
+      _nNextLine(1) {
+  _pFile = fopen(sPath.c_str(), "rb");
+  if (_pFile == nullptr) throw LoadException("cannot open " + sPath);
+  _pBuffer = new char[_nCapacity];
+}
+
+CsvReader::~CsvReader() {
+  fclose(_pFile);
+  delete[] _pBuffer;
+}
+
+bool CsvReader::Fill() {
+  if (_nBegin > 0) {
+    memmove(_pBuffer, _pBuffer + _nBegin, _nEnd - _nBegin);
+    _nEnd -= _nBegin;
+    _nBegin = 0;
+  }
+  if (_nEnd == _nCapacity) {
+    // 一行比缓冲区更长
+    char *pBuffer = new char[_nCapacity * 2];
+    memcpy(pBuffer, _pBuffer, _nEnd);
+    delete[] _pBuffer;
+    _pBuffer = pBuffer;
+    _nCapacity *= 2;
+  }
+  Size nRead = fread(_pBuffer + _nEnd, 1, _nCapacity - _nEnd, _pFile);
+  if (nRead == 0) {
+    if (ferror(_pFile)) throw LoadException("read failed");
+    _bEOF = true;
+    return false;
+  }
+  _nEnd += nRead;
+  return true;
+}
+
+Size CsvReader::FindEnd() const {
+  const char *pEnd = _pBuffer + _nEnd;
+  const char *p = _pBuffer + _nBegin;
+  while (p < pEnd) {
+    const char *pLine = (const char *)memchr(p, '\n', pEnd - p);
+    const char *pStop = pLine ? pLine : pEnd;
+    const char *pQuote = (const char *)memchr(p, '"', pStop - p);
+    if (pQuote == nullptr) return pLine ? pLine - _pBuffer : _nEnd;
+    // 跳过引号内的内容，连续的两个双引号相当于先关闭再打开
+    pQuote = (const char *)memchr(pQuote + 1, '"', pEnd - pQuote - 1);
+    if (pQuote == nullptr) return _nEnd;
+    p = pQuote + 1;
+  }
+  return _nEnd;
+}
+
+void CsvReader::Split(Size nEnd, std::vector<CsvField> &iFieldVec) {
+  iFieldVec.clear();
+  Size nPos = _nBegin;
+  while (true) {
+    CsvField iField;
+    if (nPos < nEnd && _pBuffer[nPos] == '"') {
+      // 原地去掉引号和转义
+      Size nRead = nPos + 1, nWrite = nPos + 1;
+      while (nRead < nEnd) {
+        if (_pBuffer[nRead] == '"') {
+          if (nRead + 1 < nEnd && _pBuffer[nRead + 1] == '"') {
+            _pBuffer[nWrite++] = '"';
+            nRead += 2;
+            continue;
+          }
+          ++nRead;
+          break;
+        }
+        _pBuffer[nWrite++] = _pBuffer[nRead++];
+      }
+      iField = {_pBuffer + nPos + 1, nWrite - nPos - 1, true};
+      // 结束引号之后到分隔符之前的内容被忽略
+      const char *pDelim =
+          (const char *)memchr(_pBuffer + nRead, _cDelim, nEnd - nRead);
+      nPos = pDelim ? pDelim - _pBuffer : nEnd;
+    } else {
+      const char *pDelim =
+          (const char *)memchr(_pBuffer + nPos, _cDelim, nEnd - nPos);
+      Size nStop = pDelim ? pDelim - _pBuffer : nEnd;
+      iField = {_pBuffer + nPos, nStop - nPos, false};
+      nPos = nStop;
+    }
+    iFieldVec.push_back(iField);
+    if (nPos >= nEnd) break;
+    ++nPos;
+  }
+}
+
+bool CsvReader::Next(std::vector<CsvField> &iFieldVec) {
+  while (true) {
+    Size nEnd = FindEnd();
+    if (nEnd == _nEnd && !_bEOF) {
+      // 缓冲区中没有完整的一行
+      Fill();
+      continue;
+    }
+    if (_nBegin == _nEnd) return false;
+    Size nNext = (nEnd < _nEnd) ? nEnd + 1 : nEnd;
+    _nLine = _nNextLine;
+    _nNextLine += std::count(_pBuffer + _nBegin, _pBuffer + nEnd, '\n') + 1;
+    if (nEnd > _nBegin && _pBuffer[nEnd - 1] == '\r') --nEnd;
+    if (nEnd == _nBegin) {
+      _nBegin = nNext;
+      continue;
+    }
+    Split(nEnd, iFieldVec);
+    _nBegin = nNext;
+    return true;
+  }
+}
+
+Size CsvReader::GetLine() const { return _nLine; }
+
+}  // namespace thdb
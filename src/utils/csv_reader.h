@@ -0,0 +1,70 @@
+#ifndef THDB_CSV_READER_H_
+#define THDB_CSV_READER_H_
+
+#include <cstdio>
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief CSV 文件中的一个字段，指向 CsvReader 内部的缓冲区
+ */
+struct CsvField {
+  const char *pData;
+  Size nSize;
+  /**
+   * @brief 字段是否带引号，带引号的空字段表示空字符串而不是 NULL
+   */
+  bool bQuoted;
+};
+
+/**
+ * @brief 流式读取 CSV 文件。
+ * 文件分块读入缓冲区，按分隔符和换行切分字段，不为字段分配字符串。
+ * 字段可以用双引号包围，引号内可以包含分隔符和换行，两个连续的双引号表示一个双引号。
+ */
+class CsvReader {
+ public:
+  CsvReader(const String &sPath, char cDelim = ',');
+  ~CsvReader();
+
+  /**
+   * @brief 读取下一行的所有字段，跳过空行
+   *
+   * @param iFieldVec 字段数组，其中的指针在下一次调用 Next 之前有效
+   * @return bool 文件已经读完时返回 false
+   */
+  bool Next(std::vector<CsvField> &iFieldVec);
+  /**
+   * @brief 最近一次 Next 读取的行在文件中的行号，从1开始
+   */
+  Size GetLine() const;
+
+ private:
+  /**
+   * @brief 把未处理的数据移动到缓冲区开头并继续读入文件，缓冲区已满时扩容
+   * @return bool 文件已经读完时返回 false
+   */
+  bool Fill();
+  /**
+   * @brief 查找从 _nBegin 开始的一行的结尾(不在引号内的换行)
+   * @return Size 换行符的位置，缓冲区中没有完整的一行时返回 _nEnd
+   */
+  Size FindEnd() const;
+  void Split(Size nEnd, std::vector<CsvField> &iFieldVec);
+
+  FILE *_pFile;
+  char *_pBuffer;
+  Size _nCapacity;
+  Size _nBegin;
+  Size _nEnd;
+  bool _bEOF;
+  char _cDelim;
+  Size _nLine;
+  Size _nNextLine;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_CSV_READER_H_
@@ -0,0 +1,39 @@
+#include "utils/parallel.h"
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace thdb {
+
+void ParallelFor(Size nTasks, Size nThreads,
+                 const std::function<void(Size)> &iTask) {
+  if (nThreads > nTasks) nThreads = nTasks;
+  if (nThreads <= 1) {
+    for (Size i = 0; i < nTasks; ++i) iTask(i);
+    return;
+  }
+  std::atomic<Size> nNext(0);
+  std::exception_ptr pError;
+  std::mutex iErrorMutex;
+  auto iWorker = [&]() {
+    for (Size i = nNext++; i < nTasks; i = nNext++) {
+      try {
+        iTask(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> iGuard(iErrorMutex);
+        if (!pError) pError = std::current_exception();
+        nNext = nTasks;
+      }
+    }
+  };
+  std::vector<std::thread> iThreadVec;
+  for (Size i = 1; i < nThreads; ++i) iThreadVec.push_back(std::thread(iWorker));
+  iWorker();
+  for (auto &iThread : iThreadVec) iThread.join();
+  if (pError) std::rethrow_exception(pError);
+}
+
+}  // namespace thdb
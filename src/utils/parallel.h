@@ -0,0 +1,20 @@
+#ifndef THDB_PARALLEL_H_
+#define THDB_PARALLEL_H_
+
+#include <functional>
+
+#include "defines.h"
+
+namespace thdb {
+
+/**
+ * @brief 用至多 nThreads 个线程执行 iTask(0), iTask(1), ..., iTask(nTasks - 1)。
+ * 任务按编号顺序领取，调用线程也参与执行。
+ * 任务中抛出的第一个异常会在所有线程结束后在调用线程中重新抛出。
+ */
+void ParallelFor(Size nTasks, Size nThreads,
+                 const std::function<void(Size)> &iTask);
+
+}  // namespace thdb
+
+#endif  // THDB_PARALLEL_H_
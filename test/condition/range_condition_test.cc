@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "condition/conditions.h"
+#include "exception/exceptions.h"
+#include "field/fields.h"
+#include "record/fixed_record.h"
+
+namespace thdb {
+
+static const std::vector<FieldType> TYPE_VEC{
+    FieldType::INT_TYPE, FieldType::BIGINT_TYPE, FieldType::FLOAT_TYPE,
+    FieldType::STRING_TYPE};
+static const std::vector<Size> SIZE_VEC{4, 8, 8, 8};
+
+static FixedRecord *MakeRecord(int nInt, int64_t nBig, double fFloat) {
+  FixedRecord *pRecord = new FixedRecord(4, TYPE_VEC, SIZE_VEC);
+  pRecord->SetField(0, new IntField(nInt));
+  pRecord->SetField(1, new BigIntField(nBig));
+  pRecord->SetField(2, new FloatField(fFloat));
+  pRecord->SetField(3, new StringField("abc"));
+  return pRecord;
+}
+
+// 与 MakeRecord 相同内容的定长格式，追加到 iData 的末尾
+static void AppendRow(std::vector<uint8_t> &iData, int nInt, int64_t nBig,
+                      double fFloat, const char *sStr = "abc") {
+  Size nBegin = iData.size();
+  iData.resize(nBegin + 28, 0);
+  memcpy(iData.data() + nBegin, &nInt, 4);
+  memcpy(iData.data() + nBegin + 4, &nBig, 8);
+  memcpy(iData.data() + nBegin + 12, &fFloat, 8);
+  memcpy(iData.data() + nBegin + 20, sStr, strlen(sStr));
+}
+
+static std::vector<SlotID> FilterAll(const Condition &iCond, RowView &iRow,
+                                     const std::vector<uint8_t> &iData) {
+  std::vector<SlotID> iSlotVec;
+  for (SlotID i = 0; i < iData.size() / iRow.GetTotalSize(); ++i)
+    iSlotVec.push_back(i);
+  iCond.Filter(iRow, iData.data(), iSlotVec);
+  return iSlotVec;
+}
+
+TEST(RangeConditionTest, MatchesNumericColumns) {
+  RangeCondition iInt(0, FieldType::INT_TYPE, 10.0, 20.0);
+  RangeCondition iBig(1, FieldType::BIGINT_TYPE, (int64_t)1 << 40,
+                      ((int64_t)1 << 40) + 2, true);
+  RangeCondition iFloat(2, FieldType::FLOAT_TYPE, 0.5, 1.5);
+  RowView iRow(TYPE_VEC, SIZE_VEC);
+  std::vector<uint8_t> iData;
+  AppendRow(iData, 10, ((int64_t)1 << 40) + 1, 1.5);
+  iRow.Reset(iData.data());
+  FixedRecord *pRecord = MakeRecord(10, ((int64_t)1 << 40) + 1, 1.5);
+  // 浮点边界为左闭右开区间，整数边界为闭区间
+  EXPECT_TRUE(iInt.Match(*pRecord));
+  EXPECT_TRUE(iInt.Match(iRow));
+  EXPECT_TRUE(iBig.Match(*pRecord));
+  EXPECT_TRUE(iBig.Match(iRow));
+  EXPECT_FALSE(iFloat.Match(*pRecord));
+  EXPECT_FALSE(iFloat.Match(iRow));
+  // 空值不满足任何范围
+  pRecord->SetField(0, new NoneField());
+  EXPECT_FALSE(iInt.Match(*pRecord));
+  delete pRecord;
+}
+
+TEST(RangeConditionTest, StringColumnThrows) {
+  EXPECT_THROW(RangeCondition(3, FieldType::STRING_TYPE, 0.0, 1.0),
+               RecordTypeException);
+  EXPECT_THROW(RangeCondition(3, FieldType::STRING_TYPE, 0, 1, true),
+               RecordTypeException);
+}
+
+TEST(RangeConditionTest, FilterPageOfRows) {
+  RowView iRow(TYPE_VEC, SIZE_VEC);
+  std::vector<uint8_t> iData;
+  for (int i = 0; i < 10; ++i)
+    AppendRow(iData, i - 3, (int64_t)i << 35, i * 0.5, i % 2 ? "odd" : "even");
+  // 负数和0也在范围内
+  EXPECT_EQ(FilterAll(RangeCondition(0, FieldType::INT_TYPE, -2.0, 1.0), iRow,
+                      iData),
+            (std::vector<SlotID>{1, 2, 3}));
+  EXPECT_EQ(FilterAll(RangeCondition(1, FieldType::BIGINT_TYPE,
+                                     (int64_t)7 << 35, INT64_MAX, true),
+                      iRow, iData),
+            (std::vector<SlotID>{7, 8, 9}));
+  EXPECT_EQ(FilterAll(RangeCondition(2, FieldType::FLOAT_TYPE, 1.0, 2.0), iRow,
+                      iData),
+            (std::vector<SlotID>{2, 3}));
+  EXPECT_EQ(FilterAll(StringRangeCondition(3, "odd", String("odd") + '\0'),
+                      iRow, iData),
+            (std::vector<SlotID>{1, 3, 5, 7, 9}));
+
+  // 只在给出的候选槽中筛选
+  std::vector<SlotID> iSlotVec{0, 4, 5, 9};
+  RangeCondition(0, FieldType::INT_TYPE, 0.0, 100.0)
+      .Filter(iRow, iData.data(), iSlotVec);
+  EXPECT_EQ(iSlotVec, (std::vector<SlotID>{4, 5, 9}));
+}
+
+TEST(RangeConditionTest, FilterCombinedConditions) {
+  RowView iRow(TYPE_VEC, SIZE_VEC);
+  std::vector<uint8_t> iData;
+  for (int i = 0; i < 10; ++i) AppendRow(iData, i, i, i);
+  AndCondition iAnd({new RangeCondition(0, FieldType::INT_TYPE, 2.0, 8.0),
+                     new RangeCondition(2, FieldType::FLOAT_TYPE, 5.0, 100.0)});
+  EXPECT_EQ(FilterAll(iAnd, iRow, iData), (std::vector<SlotID>{5, 6, 7}));
+  OrCondition iOr({new RangeCondition(0, FieldType::INT_TYPE, 8.0, 100.0),
+                   new RangeCondition(0, FieldType::INT_TYPE, 0.0, 2.0)});
+  EXPECT_EQ(FilterAll(iOr, iRow, iData), (std::vector<SlotID>{0, 1, 8, 9}));
+  NotCondition iNot(new RangeCondition(0, FieldType::INT_TYPE, 1.0, 9.0));
+  EXPECT_EQ(FilterAll(iNot, iRow, iData), (std::vector<SlotID>{0, 9}));
+}
+
+TEST(RangeConditionTest, FilterNarrowIntegersAndNulls) {
+  std::vector<FieldType> iTypeVec{FieldType::TINYINT_TYPE,
+                                  FieldType::SMALLINT_TYPE};
+  RowView iRow(iTypeVec, {1, 2}, true);
+  // 每条记录以1字节的空值位图开头
+  std::vector<uint8_t> iData;
+  for (int i = 0; i < 6; ++i) {
+    int8_t nTiny = -100 + i * 40;
+    int16_t nSmall = -30000 + i * 12000;
+    iData.push_back(i == 2 ? 1 : (i == 4 ? 2 : 0));
+    iData.push_back((uint8_t)nTiny);
+    iData.resize(iData.size() + 2);
+    memcpy(iData.data() + iData.size() - 2, &nSmall, 2);
+  }
+  // 第2条记录的 TINYINT、第4条记录的 SMALLINT 为空
+  EXPECT_EQ(FilterAll(RangeCondition(0, FieldType::TINYINT_TYPE, -128.0, 0.0),
+                      iRow, iData),
+            (std::vector<SlotID>{0, 1}));
+  EXPECT_EQ(FilterAll(RangeCondition(0, FieldType::TINYINT_TYPE, 0.0, 128.0),
+                      iRow, iData),
+            (std::vector<SlotID>{3, 4, 5}));
+  EXPECT_EQ(FilterAll(RangeCondition(1, FieldType::SMALLINT_TYPE, 0.0, 32768.0),
+                      iRow, iData),
+            (std::vector<SlotID>{3, 5}));
+}
+
+TEST(RangeConditionTest, ClosedIntegerBounds) {
+  RowView iRow(TYPE_VEC, SIZE_VEC);
+  std::vector<uint8_t> iData;
+  AppendRow(iData, 0, INT64_MAX - 1, 0.0);
+  AppendRow(iData, 5, INT64_MAX, 0.0);
+  AppendRow(iData, 4, INT64_MIN, 0.0);
+  // 上界可以取到 INT64_MAX
+  EXPECT_EQ(FilterAll(RangeCondition(1, FieldType::BIGINT_TYPE, INT64_MAX,
+                                     INT64_MAX, true),
+                      iRow, iData),
+            (std::vector<SlotID>{1}));
+  EXPECT_EQ(FilterAll(RangeCondition(1, FieldType::BIGINT_TYPE, INT64_MIN,
+                                     INT64_MAX, true),
+                      iRow, iData),
+            (std::vector<SlotID>{0, 1, 2}));
+  // 下界大于上界为空区间
+  EXPECT_TRUE(FilterAll(RangeCondition(1, FieldType::BIGINT_TYPE, INT64_MAX,
+                                       INT64_MIN, true),
+                        iRow, iData)
+                  .empty());
+  // 浮点边界换算为整数闭区间后，仍不包含上界本身
+  EXPECT_EQ(FilterAll(RangeCondition(0, FieldType::INT_TYPE, 0.0, 5.0), iRow,
+                      iData),
+            (std::vector<SlotID>{0, 2}));
+  EXPECT_EQ(FilterAll(RangeCondition(0, FieldType::INT_TYPE, 0.5, 4.5), iRow,
+                      iData),
+            (std::vector<SlotID>{2}));
+}
+
+TEST(IndexConditionTest, IntegerBoundsClampedToType) {
+  IndexCondition iCond("t", "a", -1000, 1000, FieldType::TINYINT_TYPE, true);
+  EXPECT_TRUE(iCond.IsClosed());
+  auto iRange = iCond.GetIndexRange();
+  EXPECT_EQ(iRange.first->ToString(), "-128");
+  EXPECT_EQ(iRange.second->ToString(), "127");
+  // 与类型取值范围不相交时统一为空区间[1, 0]
+  IndexCondition iEmpty("t", "a", 128, 1000, FieldType::TINYINT_TYPE, true);
+  iRange = iEmpty.GetIndexRange();
+  EXPECT_EQ(iRange.first->ToString(), "1");
+  EXPECT_EQ(iRange.second->ToString(), "0");
+  EXPECT_FALSE(IndexCondition("t", "a", 0.0, 1.0, FieldType::INT_TYPE)
+                   .IsClosed());
+}
+
+TEST(IndexConditionTest, NumericBoundsOnStringIndexThrow) {
+  EXPECT_THROW(IndexCondition("t", "b", 0.0, 1.0, FieldType::STRING_TYPE),
+               IndexTypeException);
+}
+
+}  // namespace thdb
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include "field/compare.h"
+#include "field/fields.h"
+
+namespace thdb {
+
+template <typename T, typename V>
+static std::vector<Field *> MakeKeys(const std::vector<V> &iValueVec) {
+  std::vector<Field *> iKeyVec;
+  for (const auto &iValue : iValueVec) iKeyVec.push_back(new T(iValue));
+  return iKeyVec;
+}
+
+static void DeleteKeys(std::vector<Field *> &iKeyVec) {
+  for (const auto &pKey : iKeyVec) delete pKey;
+  iKeyVec.clear();
+}
+
+TEST(CompareTest, BoundsForEachType) {
+  std::vector<Field *> iKeyVec =
+      MakeKeys<IntField>(std::vector<int>{-5, 1, 1, 1, 7});
+  const FieldComparator &iInt = GetComparator(FieldType::INT_TYPE);
+  IntField iOne(1), iBig(100);
+  EXPECT_EQ(iInt.LowerBound(iKeyVec, &iOne), 1);
+  EXPECT_EQ(iInt.UpperBound(iKeyVec, &iOne), 4);
+  EXPECT_EQ(iInt.LowerBound(iKeyVec, &iBig), 5);
+  EXPECT_TRUE(iInt.Less(iKeyVec[0], iKeyVec[1]));
+  EXPECT_TRUE(iInt.Equal(iKeyVec[1], iKeyVec[2]));
+  EXPECT_TRUE(iInt.Greater(iKeyVec[4], iKeyVec[3]));
+  DeleteKeys(iKeyVec);
+  // TINYINT、SMALLINT 的值也是 IntField
+  EXPECT_EQ(&GetComparator(FieldType::TINYINT_TYPE), &iInt);
+
+  iKeyVec = MakeKeys<BigIntField>(std::vector<int64_t>{
+      INT64_MIN, (int64_t)1 << 40, ((int64_t)1 << 40) + 1});
+  BigIntField iKey(((int64_t)1 << 40) + 1);
+  const FieldComparator &iBigCmp = GetComparator(FieldType::BIGINT_TYPE);
+  EXPECT_EQ(iBigCmp.LowerBound(iKeyVec, &iKey), 2);
+  EXPECT_EQ(iBigCmp.UpperBound(iKeyVec, &iKey), 3);
+  DeleteKeys(iKeyVec);
+
+  iKeyVec = MakeKeys<FloatField>(std::vector<double>{-1.5, 0.25, 0.5});
+  FloatField iHalf(0.3);
+  const FieldComparator &iFloat = GetComparator(FieldType::FLOAT_TYPE);
+  EXPECT_EQ(iFloat.LowerBound(iKeyVec, &iHalf), 2);
+  DeleteKeys(iKeyVec);
+
+  // 字符串按字节比较
+  iKeyVec = MakeKeys<StringField>(std::vector<String>{"a", "ab", "b", "b"});
+  StringField iB("b");
+  const FieldComparator &iStr = GetComparator(FieldType::STRING_TYPE);
+  EXPECT_EQ(iStr.LowerBound(iKeyVec, &iB), 2);
+  EXPECT_EQ(iStr.UpperBound(iKeyVec, &iB), 4);
+  DeleteKeys(iKeyVec);
+}
+
+TEST(CompareTest, SortIsStable) {
+  std::vector<Field *> iKeyVec =
+      MakeKeys<StringField>(std::vector<String>{"m", "c", "m", "a", "c"});
+  std::vector<std::pair<Field *, PageSlotID>> iEntryVec;
+  for (Size i = 0; i < iKeyVec.size(); ++i)
+    iEntryVec.push_back({iKeyVec[i], {1, i}});
+  GetComparator(FieldType::STRING_TYPE).Sort(iEntryVec);
+  std::vector<SlotID> iSlotVec;
+  for (const auto &iEntry : iEntryVec) iSlotVec.push_back(iEntry.second.second);
+  EXPECT_EQ(iSlotVec, (std::vector<SlotID>{3, 1, 4, 0, 2}));
+  DeleteKeys(iKeyVec);
+}
+
+TEST(CompareTest, NoneNeverCompares) {
+  NoneField iA, iB;
+  const FieldComparator &iNone = GetComparator(FieldType::NONE_TYPE);
+  EXPECT_FALSE(iNone.Less(&iA, &iB));
+  EXPECT_FALSE(iNone.Equal(&iA, &iB));
+  EXPECT_FALSE(iNone.Greater(&iA, &iB));
+}
+
+}  // namespace thdb
@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <map>
+
+#include "index/index.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+class StringIndexTest : public DBTest {
+ protected:
+  // 与索引中的内容对照的有序表
+  std::multimap<String, PageSlotID> _iRefMap;
+
+  void Insert(Index &iIndex, const String &sKey, const PageSlotID &iPair) {
+    StringField iKey(sKey);
+    EXPECT_TRUE(iIndex.Insert(&iKey, iPair));
+    _iRefMap.insert({sKey, iPair});
+  }
+
+  void Delete(Index &iIndex, const String &sKey, const PageSlotID &iPair) {
+    StringField iKey(sKey);
+    EXPECT_TRUE(iIndex.Delete(&iKey, iPair));
+    auto iRange = _iRefMap.equal_range(sKey);
+    for (auto it = iRange.first; it != iRange.second; ++it)
+      if (it->second == iPair) {
+        _iRefMap.erase(it);
+        break;
+      }
+  }
+
+  // 检查索引中[sLow, sHigh)的内容与对照表一致
+  void ExpectRange(Index &iIndex, const String &sLow, const String &sHigh) {
+    StringField iLow(sLow), iHigh(sHigh);
+    std::vector<PageSlotID> iResVec = iIndex.Range(&iLow, &iHigh);
+    std::vector<PageSlotID> iRefVec;
+    for (auto it = _iRefMap.lower_bound(sLow);
+         it != _iRefMap.lower_bound(sHigh); ++it)
+      iRefVec.push_back(it->second);
+    std::sort(iResVec.begin(), iResVec.end());
+    std::sort(iRefVec.begin(), iRefVec.end());
+    EXPECT_EQ(iResVec, iRefVec) << "[" << sLow << ", " << sHigh << ")";
+  }
+
+  void ExpectAll(Index &iIndex) {
+    ExpectRange(iIndex, "", String(1, '\x7f'));
+    for (const auto &iPair : _iRefMap) {
+      ExpectRange(iIndex, iPair.first, iPair.first + '\0');
+      if (testing::Test::HasFailure()) return;
+    }
+  }
+
+  static bool IsLeafRoot(const Index &iIndex) {
+    BPTreeNode iRoot(iIndex.GetRootID());
+    return iRoot.isLeaf();
+  }
+
+  // 长公共前缀加上不同长度的后缀，节点内前缀压缩的效果随键的分布变化
+  static String MakeKey(Size i) {
+    String sNum = std::to_string(i * 7919 % 100003);
+    return "customer/region-" + std::to_string(i % 3) + "/" +
+           String(6 - sNum.size(), '0') + sNum + String(i % 97, 'x');
+  }
+};
+
+TEST_F(StringIndexTest, SplitAndMerge) {
+  Index iIndex(FieldType::STRING_TYPE, 160);
+  const Size N = 3000;
+  for (Size i = 0; i < N; ++i) Insert(iIndex, MakeKey(i), {1, i});
+  // 重复的键进入溢出页
+  for (Size i = 0; i < N; i += 10) Insert(iIndex, MakeKey(i), {2, i});
+  EXPECT_FALSE(IsLeafRoot(iIndex));
+  ExpectAll(iIndex);
+  ExpectRange(iIndex, "customer/region-1/", "customer/region-1/05");
+  ExpectRange(iIndex, "customer/region-0/000", "customer/region-2");
+
+  // 首字节不同的短键缩短节点的公共前缀，节点可能需要分裂多次
+  for (Size i = 0; i < 200; ++i)
+    Insert(iIndex, String(1, 'a' + i % 26) + std::to_string(i), {3, i});
+  ExpectAll(iIndex);
+
+  // 删除大部分键，节点借用与合并
+  for (Size i = 0; i < N; ++i)
+    if (i % 50 != 0) Delete(iIndex, MakeKey(i), {1, i});
+  ExpectAll(iIndex);
+  for (Size i = 0; i < 200; ++i)
+    Delete(iIndex, String(1, 'a' + i % 26) + std::to_string(i), {3, i});
+  for (Size i = 0; i < N; i += 50) Delete(iIndex, MakeKey(i), {1, i});
+  for (Size i = 0; i < N; i += 10) Delete(iIndex, MakeKey(i), {2, i});
+  EXPECT_TRUE(_iRefMap.empty());
+  ExpectRange(iIndex, "", String(1, '\x7f'));
+  EXPECT_TRUE(IsLeafRoot(iIndex));
+  iIndex.Clear();
+}
+
+TEST_F(StringIndexTest, KeysNormalizedToColumn) {
+  Index iIndex(FieldType::STRING_TYPE, 8);
+  StringField iLong("abcdefghXYZ"), iNul(String("ab\0cd", 5));
+  iIndex.Insert(&iLong, {1, 1});
+  iIndex.Insert(&iNul, {1, 2});
+  // 键截断到列长度，'\0'之后的部分不保存
+  StringField iLow("abcdefgh"), iHigh(String("abcdefgh") + '\0');
+  EXPECT_EQ(iIndex.Range(&iLow, &iHigh), (std::vector<PageSlotID>{{1, 1}}));
+  StringField iAb("ab"), iAbEnd(String("ab") + '\0');
+  EXPECT_EQ(iIndex.Range(&iAb, &iAbEnd), (std::vector<PageSlotID>{{1, 2}}));
+  EXPECT_EQ(iIndex.Delete(&iLong), 1);
+  iIndex.Clear();
+  EXPECT_THROW(Index(FieldType::STRING_TYPE, BPTREE_MAX_KEY_SIZE + 1),
+               IndexTypeException);
+}
+
+TEST_F(StringIndexTest, IndexedQueriesMatchScan) {
+  Run("CREATE TABLE s(a INT, b VARCHAR(64));");
+  Run("CREATE TABLE i(a INT, b VARCHAR(64));");
+  Run("ALTER TABLE i ADD INDEX (b);");
+  for (const String sTable : {"s", "i"}) {
+    String sInsert = "INSERT INTO " + sTable + " VALUES ";
+    for (Size j = 1; j <= 2000; ++j) {
+      if (j > 1) sInsert += ",";
+      sInsert += "(" + std::to_string(j) + ",'" + MakeKey(j).substr(0, 60) +
+                 "')";
+    }
+    Run(sInsert + ";");
+    Run("DELETE FROM " + sTable + " WHERE " + sTable + ".a > 1500;");
+  }
+  std::vector<String> iWhereVec{
+      " = '" + MakeKey(77).substr(0, 60) + "'",
+      " >= 'customer/region-1/05'", " < 'customer/region-0/01'",
+      " > 'customer/region-2/09'", " <= 'customer/region-1'",
+      " <> '" + MakeKey(78).substr(0, 60) + "'"};
+  auto Select = [&](const String &sTable, const String &sWhere) {
+    std::vector<String> iRowVec =
+        Run("SELECT * FROM " + sTable + " WHERE " + sTable + ".b" + sWhere +
+            ";");
+    std::sort(iRowVec.begin(), iRowVec.end());
+    return iRowVec;
+  };
+  for (const auto &sWhere : iWhereVec) {
+    EXPECT_FALSE(Select("s", sWhere).empty()) << sWhere;
+    EXPECT_EQ(Select("i", sWhere), Select("s", sWhere)) << sWhere;
+  }
+  Restart();
+  for (const auto &sWhere : iWhereVec)
+    EXPECT_EQ(Select("i", sWhere), Select("s", sWhere)) << sWhere;
+}
+
+}  // namespace thdb
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <cstring>
+#include <future>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+#include "minios/buffer_pool.h"
+#include "minios/data_file.h"
+
+namespace thdb {
+
+// 页面保存在内存中的数据文件，记录每个页面被写回的次数
+class MemoryFile : public DataFile {
+ public:
+  void Read(PageID nPageID, uint8_t *pData) override {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    auto it = _iPageMap.find(nPageID);
+    if (it == _iPageMap.end())
+      memset(pData, 0, PAGE_SIZE);
+    else
+      memcpy(pData, it->second.data(), PAGE_SIZE);
+  }
+  void Write(PageID nPageID, const uint8_t *pData) override {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    _iPageMap[nPageID].assign(pData, pData + PAGE_SIZE);
+    ++_iWriteMap[nPageID];
+  }
+  void ReadRun(PageID nFirstID, uint8_t *const *pDataVec,
+               Size nPages) override {
+    for (Size i = 0; i < nPages; ++i) Read(nFirstID + i, pDataVec[i]);
+  }
+  void WriteRun(PageID nFirstID, uint8_t *const *pDataVec,
+                Size nPages) override {
+    for (Size i = 0; i < nPages; ++i) Write(nFirstID + i, pDataVec[i]);
+  }
+  void Sync() override {}
+
+  Size GetWrites(PageID nPageID) {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    return _iWriteMap[nPageID];
+  }
+  uint8_t GetByte(PageID nPageID) {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    return _iPageMap[nPageID][0];
+  }
+
+ private:
+  std::mutex _iMutex;
+  std::map<PageID, std::vector<uint8_t>> _iPageMap;
+  std::map<PageID, Size> _iWriteMap;
+};
+
+TEST(BufferPool, FlushWritesDirtyFrames) {
+  MemoryFile iFile;
+  BufferPool *pPool = new BufferPool(&iFile, 16);
+  for (PageID i = 0; i < 4; ++i) {
+    pPool->Pin(i, true)[0] = i + 1;
+    pPool->Unpin(i, true);
+  }
+  EXPECT_EQ(pPool->Flush(), 4);
+  EXPECT_EQ(pPool->Flush(), 0);
+  for (PageID i = 0; i < 4; ++i) EXPECT_EQ(iFile.GetByte(i), i + 1);
+  delete pPool;
+}
+
+TEST(BufferPool, FlushSkipsPinnedFrames) {
+  MemoryFile iFile;
+  BufferPool *pPool = new BufferPool(&iFile, 16);
+  uint8_t *pData = pPool->Pin(3, true);
+  pData[0] = 1;
+  pPool->Unpin(3, true);
+  // 再次固定后修改到一半，Flush 不能写出这个页面
+  pData = pPool->Pin(3);
+  pData[0] = 2;
+  EXPECT_EQ(pPool->Flush(), 0);
+  EXPECT_EQ(iFile.GetWrites(3), 0);
+  pPool->Unpin(3, true);
+  // 解除固定后仍然是脏的，下一次 Flush 写出最终内容
+  EXPECT_EQ(pPool->Flush(), 1);
+  EXPECT_EQ(iFile.GetWrites(3), 1);
+  EXPECT_EQ(iFile.GetByte(3), 2);
+  delete pPool;
+}
+
+// 读取指定页面时阻塞到 Release，或者在 bFail 时报告读取失败
+class BlockingFile : public MemoryFile {
+ public:
+  BlockingFile(PageID nBlockID) : _nBlockID(nBlockID) {}
+
+  void Read(PageID nPageID, uint8_t *pData) override {
+    if (nPageID == _nBlockID) {
+      std::unique_lock<std::mutex> iLock(_iMutex);
+      _bReading = true;
+      _iCond.notify_all();
+      _iCond.wait(iLock, [&]() { return _bReleased; });
+      if (_bFail) throw PageIOException(nPageID);
+    }
+    MemoryFile::Read(nPageID, pData);
+  }
+
+  void WaitReading() {
+    std::unique_lock<std::mutex> iLock(_iMutex);
+    _iCond.wait(iLock, [&]() { return _bReading; });
+  }
+
+  void Release(bool bFail) {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    _bReleased = true;
+    _bFail = bFail;
+    _iCond.notify_all();
+  }
+
+ private:
+  PageID _nBlockID;
+  std::mutex _iMutex;
+  std::condition_variable _iCond;
+  bool _bReading = false;
+  bool _bReleased = false;
+  bool _bFail = false;
+};
+
+// 读盘时不持有缓冲池的锁，其他页面的固定和写回不被阻塞
+TEST(BufferPool, MissReadsOutsideLock) {
+  BlockingFile iFile(5);
+  uint8_t pPage[PAGE_SIZE] = {7};
+  iFile.Write(5, pPage);
+  BufferPool *pPool = new BufferPool(&iFile, 16);
+  pPool->Pin(1, true)[0] = 1;
+  pPool->Unpin(1, true);
+  auto iSlow = std::async(std::launch::async, [&]() { return pPool->Pin(5); });
+  iFile.WaitReading();
+  auto iFast = std::async(std::launch::async, [&]() {
+    uint8_t nByte = pPool->Pin(1)[0];
+    pPool->Unpin(1, false);
+    pPool->Pin(2, true);
+    pPool->Unpin(2, true);
+    return nByte;
+  });
+  std::future_status iStatus = iFast.wait_for(std::chrono::seconds(10));
+  // 失败时先放行读盘，避免测试卡住
+  if (iStatus != std::future_status::ready) iFile.Release(false);
+  ASSERT_EQ(iStatus, std::future_status::ready);
+  EXPECT_EQ(iFast.get(), 1);
+  // 同一页面的第二次固定等待读入完成，得到同一个帧
+  auto iSame = std::async(std::launch::async, [&]() { return pPool->Pin(5); });
+  iFile.Release(false);
+  uint8_t *pData = iSlow.get();
+  EXPECT_EQ(iSame.get(), pData);
+  EXPECT_EQ(pData[0], 7);
+  pPool->Unpin(5, false);
+  pPool->Unpin(5, false);
+  delete pPool;
+}
+
+TEST(BufferPool, MissReadFailureReleasesFrame) {
+  BlockingFile iFile(5);
+  BufferPool *pPool = new BufferPool(&iFile, 2);
+  iFile.Release(true);
+  EXPECT_THROW(pPool->Pin(5), PageIOException);
+  EXPECT_EQ(pPool->GetResidentSize(), 0);
+  // 失败的帧被释放，缓冲池仍然可以使用全部的帧
+  pPool->Pin(1, true);
+  pPool->Pin(2, true);
+  pPool->Unpin(1, true);
+  pPool->Unpin(2, true);
+  EXPECT_THROW(pPool->Pin(5), PageIOException);
+  delete pPool;
+}
+
+}  // namespace thdb
@@ -0,0 +1,80 @@
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fstream>
+
+#include "minios/os.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+// 把当前目录下的数据文件复制到 sDir，相当于在此刻断电后留下的磁盘内容
+static void CopyDataFiles(const String &sDir) {
+  mkdir(sDir.c_str(), 0755);
+  DIR *pDir = opendir(".");
+  ASSERT_NE(pDir, nullptr);
+  while (struct dirent *pEntry = readdir(pDir)) {
+    String sName = pEntry->d_name;
+    if (sName.compare(0, 5, "THDB_") != 0) continue;
+    std::ifstream fin(sName, std::ios::binary);
+    std::ofstream fout(sDir + "/" + sName, std::ios::binary);
+    fout << fin.rdbuf();
+  }
+  closedir(pDir);
+}
+
+class CheckpointTest : public DBTest {};
+
+TEST_F(CheckpointTest, CatalogSurvivesCrash) {
+  Run("CREATE TABLE t(a INT, b VARCHAR(16));");
+  Run("ALTER TABLE t ADD INDEX (a);");
+  String sInsert = "INSERT INTO t VALUES ";
+  for (int i = 0; i < 2000; ++i) {
+    if (i > 0) sInsert += ",";
+    sInsert += "(" + std::to_string(i) + ",'row" + std::to_string(i) + "')";
+  }
+  Run(sInsert + ";");
+  MiniOS::GetOS()->Checkpoint();
+  CopyDataFiles("crash");
+
+  // 在只经过检查点的数据文件上重新打开，表、索引和数据都应该存在
+  delete _pDB;
+  Close();
+  ASSERT_EQ(chdir("crash"), 0);
+  _pDB = new Instance();
+  EXPECT_EQ(_pDB->GetTableNames(), std::vector<String>{"t"});
+  EXPECT_TRUE(_pDB->IsIndex("t", "a"));
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 1234;"),
+            std::vector<String>{"1234,row1234"});
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a > 1990;").size(), 9);
+  EXPECT_EQ(Run("SELECT * FROM t;").size(), 2000);
+  delete _pDB;
+  Close();
+  Clear();
+  ASSERT_EQ(chdir(".."), 0);
+  rmdir("crash");
+  _pDB = new Instance();
+}
+
+TEST_F(CheckpointTest, DropTableSurvivesCrash) {
+  Run("CREATE TABLE t(a INT);");
+  Run("CREATE TABLE s(a INT);");
+  Restart();
+  Run("DROP TABLE t;");
+  MiniOS::GetOS()->Checkpoint();
+  CopyDataFiles("crash");
+  delete _pDB;
+  Close();
+  ASSERT_EQ(chdir("crash"), 0);
+  _pDB = new Instance();
+  EXPECT_EQ(_pDB->GetTableNames(), std::vector<String>{"s"});
+  delete _pDB;
+  Close();
+  Clear();
+  ASSERT_EQ(chdir(".."), 0);
+  rmdir("crash");
+  _pDB = new Instance();
+}
+
+}  // namespace thdb
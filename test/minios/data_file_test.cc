@@ -0,0 +1,199 @@
+#include "minios/data_file.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "macros.h"
+#include "minios/buffer_pool.h"
+#include "minios/os.h"
+
+namespace thdb {
+
+// 段大小在编译时固定，用例直接在真实的段边界附近读写，段文件是稀疏文件，
+// 只有写入的页面实际占用磁盘
+const PageID LAST_PAGE = SEGMENT_PAGES - 1;
+
+static void RemoveFiles() {
+  for (Size i = 0; i < 2; ++i) {
+    std::remove(SegmentName("THDB_PAGE", i).c_str());
+    std::remove(SegmentName("THDB_BITMAP", i).c_str());
+  }
+}
+
+static off_t FileSize(const String &sName) {
+  struct stat iStat;
+  if (stat(sName.c_str(), &iStat) != 0) return -1;
+  return iStat.st_size;
+}
+
+// 记录每次批量读写的起始页面和页面数
+class RecordingFile : public DataFile {
+ public:
+  void ReadRun(PageID nFirstID, uint8_t *const *pDataVec,
+               Size nPages) override {
+    Record(&_iReadVec, nFirstID, nPages);
+    DataFile::ReadRun(nFirstID, pDataVec, nPages);
+  }
+  void WriteRun(PageID nFirstID, uint8_t *const *pDataVec,
+                Size nPages) override {
+    Record(&_iWriteVec, nFirstID, nPages);
+    DataFile::WriteRun(nFirstID, pDataVec, nPages);
+  }
+
+  std::vector<std::pair<PageID, Size>> GetReads() {
+    std::lock_guard<std::mutex> iGuard(_iRunMutex);
+    return _iReadVec;
+  }
+  std::vector<std::pair<PageID, Size>> GetWrites() {
+    std::lock_guard<std::mutex> iGuard(_iRunMutex);
+    return _iWriteVec;
+  }
+
+ private:
+  void Record(std::vector<std::pair<PageID, Size>> *pRunVec, PageID nFirstID,
+              Size nPages) {
+    std::lock_guard<std::mutex> iGuard(_iRunMutex);
+    pRunVec->push_back({nFirstID, nPages});
+  }
+
+  std::mutex _iRunMutex;
+  std::vector<std::pair<PageID, Size>> _iReadVec;
+  std::vector<std::pair<PageID, Size>> _iWriteVec;
+};
+
+class DataFileTest : public ::testing::Test {
+ protected:
+  void SetUp() override { RemoveFiles(); }
+  void TearDown() override { RemoveFiles(); }
+};
+
+TEST_F(DataFileTest, PagesAroundSegmentBoundary) {
+  DataFile *pFile = new DataFile();
+  std::vector<uint8_t> iPage(PAGE_SIZE);
+  for (PageID nPageID = LAST_PAGE - 1; nPageID <= LAST_PAGE + 2; ++nPageID) {
+    memset(iPage.data(), nPageID % 251, PAGE_SIZE);
+    pFile->Write(nPageID, iPage.data());
+  }
+  // 第0段恰好写满，之后的页面从第1段开头开始
+  EXPECT_EQ(FileSize("THDB_PAGE"), (off_t)SEGMENT_PAGES * PAGE_SIZE);
+  EXPECT_EQ(FileSize("THDB_PAGE.1"), 2 * PAGE_SIZE);
+  for (PageID nPageID = LAST_PAGE - 1; nPageID <= LAST_PAGE + 2; ++nPageID) {
+    pFile->Read(nPageID, iPage.data());
+    EXPECT_EQ(iPage[0], nPageID % 251);
+    EXPECT_EQ(iPage[PAGE_SIZE - 1], nPageID % 251);
+  }
+  // 第1段末尾之后的部分读出全0
+  std::vector<uint8_t> iRun(3 * PAGE_SIZE, 0xff);
+  uint8_t *pDataVec[3] = {&iRun[0], &iRun[PAGE_SIZE], &iRun[2 * PAGE_SIZE]};
+  pFile->ReadRun(SEGMENT_PAGES, pDataVec, 3);
+  EXPECT_EQ(iRun[0], SEGMENT_PAGES % 251);
+  EXPECT_EQ(iRun[PAGE_SIZE], (SEGMENT_PAGES + 1) % 251);
+  EXPECT_EQ(iRun[2 * PAGE_SIZE], 0);
+  delete pFile;
+}
+
+TEST_F(DataFileTest, BufferPoolSplitsRunsAtSegmentBoundary) {
+  RecordingFile *pFile = new RecordingFile();
+  BufferPool *pPool = new BufferPool(pFile, 64);
+  std::vector<PageID> iPageVec;
+  for (PageID nPageID = LAST_PAGE - 3; nPageID <= LAST_PAGE + 4; ++nPageID) {
+    pPool->Pin(nPageID, true)[0] = nPageID % 251;
+    pPool->Unpin(nPageID, true);
+    iPageVec.push_back(nPageID);
+  }
+  EXPECT_EQ(pPool->Flush(), 8);
+  // 写回的每一批都位于同一个段内
+  Size nWritten = 0;
+  for (const auto &iRun : pFile->GetWrites()) {
+    EXPECT_EQ(DataFile::GetSegment(iRun.first),
+              DataFile::GetSegment(iRun.first + iRun.second - 1));
+    nWritten += iRun.second;
+  }
+  EXPECT_EQ(nWritten, 8);
+  delete pPool;
+
+  pPool = new BufferPool(pFile, 64);
+  EXPECT_EQ(pPool->Load(iPageVec), 8);
+  EXPECT_EQ(pFile->GetReads(),
+            (std::vector<std::pair<PageID, Size>>{{LAST_PAGE - 3, 4},
+                                                  {SEGMENT_PAGES, 4}}));
+  for (const auto &nPageID : iPageVec) {
+    EXPECT_EQ(pPool->Pin(nPageID)[0], nPageID % 251);
+    pPool->Unpin(nPageID, false);
+  }
+  delete pPool;
+  delete pFile;
+}
+
+TEST_F(DataFileTest, PagesSurviveReopenAcrossSegments) {
+  MiniOS *pOS = MiniOS::GetOS();
+  uint8_t pData[PAGE_SIZE];
+  ASSERT_EQ(pOS->NewPage(LAST_PAGE), LAST_PAGE);
+  ASSERT_EQ(pOS->NewPage(SEGMENT_PAGES), SEGMENT_PAGES);
+  memset(pData, 1, PAGE_SIZE);
+  pOS->WritePage(LAST_PAGE, pData, PAGE_SIZE, 0);
+  memset(pData, 2, PAGE_SIZE);
+  pOS->WritePage(SEGMENT_PAGES, pData, PAGE_SIZE, 0);
+  MiniOS::WriteBack();
+
+  pOS = MiniOS::GetOS();
+  EXPECT_TRUE(pOS->Used(LAST_PAGE));
+  EXPECT_TRUE(pOS->Used(SEGMENT_PAGES));
+  pOS->ReadPage(LAST_PAGE, pData, PAGE_SIZE, 0);
+  EXPECT_EQ(pData[PAGE_SIZE - 1], 1);
+  pOS->ReadPage(SEGMENT_PAGES, pData, PAGE_SIZE, 0);
+  EXPECT_EQ(pData[PAGE_SIZE - 1], 2);
+  MiniOS::WriteBack();
+}
+
+// 旧版本的数据文件是单个文件，只按编号顺序紧凑存放已使用的页面
+TEST_F(DataFileTest, ReopensCompactSingleFileLayout) {
+  MiniOS *pOS = MiniOS::GetOS();
+  uint8_t pData[PAGE_SIZE];
+  for (PageID i = 0; i < 6; ++i) {
+    ASSERT_EQ(pOS->NewPage(), i);
+    memset(pData, i + 1, PAGE_SIZE);
+    pOS->WritePage(i, pData, PAGE_SIZE, 0);
+  }
+  pOS->DeletePage(1);
+  pOS->DeletePage(3);
+  MiniOS::WriteBack();
+
+  // 把已使用的页面 0, 2, 4, 5 依次移到文件开头，得到旧版本的布局
+  const PageID pUsed[] = {0, 2, 4, 5};
+  FILE *pFile = fopen("THDB_PAGE", "r+b");
+  ASSERT_NE(pFile, nullptr);
+  for (Size i = 0; i < 4; ++i) {
+    fseek(pFile, (long)pUsed[i] * PAGE_SIZE, SEEK_SET);
+    ASSERT_EQ(fread(pData, 1, PAGE_SIZE, pFile), PAGE_SIZE);
+    fseek(pFile, (long)i * PAGE_SIZE, SEEK_SET);
+    ASSERT_EQ(fwrite(pData, 1, PAGE_SIZE, pFile), PAGE_SIZE);
+  }
+  fclose(pFile);
+  ASSERT_EQ(truncate("THDB_PAGE", 4 * PAGE_SIZE), 0);
+
+  pOS = MiniOS::GetOS();
+  EXPECT_FALSE(pOS->Used(1));
+  EXPECT_FALSE(pOS->Used(3));
+  for (const auto &nPageID : pUsed) {
+    pOS->ReadPage(nPageID, pData, PAGE_SIZE, 0);
+    EXPECT_EQ(pData[0], nPageID + 1);
+    EXPECT_EQ(pData[PAGE_SIZE - 1], nPageID + 1);
+  }
+  MiniOS::WriteBack();
+  // 展开后是新的布局，再次打开时不再搬运
+  EXPECT_EQ(FileSize("THDB_PAGE"), 6 * PAGE_SIZE);
+  pOS = MiniOS::GetOS();
+  pOS->ReadPage(5, pData, PAGE_SIZE, 0);
+  EXPECT_EQ(pData[0], 6);
+  MiniOS::WriteBack();
+}
+
+}  // namespace thdb
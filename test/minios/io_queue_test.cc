@@ -0,0 +1,189 @@
+#include "minios/io_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "macros.h"
+#include "minios/buffer_pool.h"
+
+namespace thdb {
+
+// 页面保存在内存中的数据文件，关闭时写操作阻塞，记录每次批量写的页面范围
+class GateFile : public DataFile {
+ public:
+  void Read(PageID nPageID, uint8_t *pData) override {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    ++_nReads;
+    auto it = _iPageMap.find(nPageID);
+    if (it == _iPageMap.end())
+      memset(pData, 0, PAGE_SIZE);
+    else
+      memcpy(pData, it->second.data(), PAGE_SIZE);
+  }
+  void Write(PageID nPageID, const uint8_t *pData) override {
+    WriteRun(nPageID, (uint8_t *const *)&pData, 1);
+  }
+  void ReadRun(PageID nFirstID, uint8_t *const *pDataVec,
+               Size nPages) override {
+    for (Size i = 0; i < nPages; ++i) Read(nFirstID + i, pDataVec[i]);
+  }
+  void WriteRun(PageID nFirstID, uint8_t *const *pDataVec,
+                Size nPages) override {
+    std::unique_lock<std::mutex> iLock(_iMutex);
+    ++_nEntered;
+    _iCond.notify_all();
+    _iCond.wait(iLock, [&]() { return _bOpen; });
+    _iRunVec.push_back({nFirstID, nPages});
+    for (Size i = 0; i < nPages; ++i)
+      _iPageMap[nFirstID + i].assign(pDataVec[i], pDataVec[i] + PAGE_SIZE);
+  }
+  void Sync() override {}
+
+  void Close() {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    _bOpen = false;
+  }
+  void Open() {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    _bOpen = true;
+    _iCond.notify_all();
+  }
+  // 等待 I/O 线程进入第 nCount 次写操作
+  void WaitEntered(Size nCount) {
+    std::unique_lock<std::mutex> iLock(_iMutex);
+    _iCond.wait(iLock, [&]() { return _nEntered >= nCount; });
+  }
+  std::vector<std::pair<PageID, Size>> GetRuns() {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    return _iRunVec;
+  }
+  uint8_t GetByte(PageID nPageID) {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    return _iPageMap[nPageID][0];
+  }
+  Size GetReads() {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    return _nReads;
+  }
+
+ private:
+  std::mutex _iMutex;
+  std::condition_variable _iCond;
+  bool _bOpen = true;
+  Size _nEntered = 0;
+  Size _nReads = 0;
+  std::map<PageID, std::vector<uint8_t>> _iPageMap;
+  std::vector<std::pair<PageID, Size>> _iRunVec;
+};
+
+typedef std::vector<std::pair<PageID, Size>> RunVec;
+
+static void SubmitByte(IOQueue *pQueue, PageID nPageID, uint8_t nByte,
+                       const IOCallback &iCallback = nullptr) {
+  uint8_t pPage[PAGE_SIZE] = {nByte};
+  pQueue->Submit(nPageID, pPage, iCallback);
+}
+
+TEST(IOQueue, ReadReturnsQueuedContent) {
+  GateFile iFile;
+  IOQueue *pQueue = new IOQueue(&iFile, 1, 16);
+  uint8_t pPage[PAGE_SIZE];
+  iFile.Close();
+  SubmitByte(pQueue, 5, 1);
+  iFile.WaitEntered(1);
+  // 正在写出的内容
+  EXPECT_TRUE(pQueue->Read(5, pPage));
+  EXPECT_EQ(pPage[0], 1);
+  // 写出期间再次提交，读到更新的内容
+  SubmitByte(pQueue, 5, 2);
+  EXPECT_TRUE(pQueue->Read(5, pPage));
+  EXPECT_EQ(pPage[0], 2);
+  EXPECT_FALSE(pQueue->Read(6, pPage));
+  EXPECT_EQ(pQueue->GetPendingSize(), 2);
+  iFile.Open();
+  pQueue->Wait();
+  EXPECT_EQ(pQueue->GetPendingSize(), 0);
+  EXPECT_FALSE(pQueue->Read(5, pPage));
+  EXPECT_EQ(iFile.GetByte(5), 2);
+  EXPECT_EQ(iFile.GetRuns(), (RunVec{{5, 1}, {5, 1}}));
+  delete pQueue;
+}
+
+TEST(IOQueue, CancelThenReusePage) {
+  GateFile iFile;
+  IOQueue *pQueue = new IOQueue(&iFile, 1, 16);
+  uint8_t pPage[PAGE_SIZE];
+  iFile.Close();
+  SubmitByte(pQueue, 1, 1);
+  iFile.WaitEntered(1);
+  int nDone = 0;
+  SubmitByte(pQueue, 2, 2, [&](PageID nPageID, bool bSuccess) {
+    EXPECT_EQ(nPageID, 2);
+    EXPECT_TRUE(bSuccess);
+    ++nDone;
+  });
+  // 删除页面时丢弃尚未写出的内容，回调视为成功
+  pQueue->Cancel(2);
+  EXPECT_EQ(nDone, 1);
+  EXPECT_FALSE(pQueue->Read(2, pPage));
+  // 同一编号重新分配后提交的内容正常写出
+  SubmitByte(pQueue, 2, 3);
+  EXPECT_TRUE(pQueue->Read(2, pPage));
+  EXPECT_EQ(pPage[0], 3);
+  iFile.Open();
+  pQueue->Wait();
+  EXPECT_EQ(iFile.GetByte(2), 3);
+  EXPECT_EQ(iFile.GetRuns(), (RunVec{{1, 1}, {2, 1}}));
+  EXPECT_EQ(nDone, 1);
+  delete pQueue;
+}
+
+// 电梯式扫描从正在写出的页面之后继续，连续的页面合并写出，但不跨越段边界
+TEST(IOQueue, CoalescesRunsWithinSegments) {
+  GateFile iFile;
+  IOQueue *pQueue = new IOQueue(&iFile, 1, 16);
+  iFile.Close();
+  SubmitByte(pQueue, 100, 1);
+  iFile.WaitEntered(1);
+  const PageID pPageVec[] = {SEGMENT_PAGES,     12, SEGMENT_PAGES - 2, 5,
+                             SEGMENT_PAGES + 1, 10, SEGMENT_PAGES - 1, 11};
+  for (const auto &nPageID : pPageVec) SubmitByte(pQueue, nPageID, 2);
+  iFile.Open();
+  pQueue->Wait();
+  EXPECT_EQ(iFile.GetRuns(), (RunVec{{100, 1},
+                                     {SEGMENT_PAGES - 2, 2},
+                                     {SEGMENT_PAGES, 2},
+                                     {5, 1},
+                                     {10, 3}}));
+  for (const auto &nPageID : pPageVec) EXPECT_EQ(iFile.GetByte(nPageID), 2);
+  delete pQueue;
+}
+
+// 被淘汰的脏页面仍在写回队列中时，再次固定直接从队列读取，不读数据文件
+TEST(IOQueue, BufferPoolReadsQueuedPage) {
+  GateFile iFile;
+  BufferPool *pPool = new BufferPool(&iFile, 2);
+  iFile.Close();
+  pPool->Pin(1, true)[0] = 7;
+  pPool->Unpin(1, true);
+  // 只有两个帧，之后固定的页面一定把页面1淘汰
+  for (PageID i = 2; i < 8; ++i) {
+    pPool->Pin(i, true);
+    pPool->Unpin(i, true);
+  }
+  iFile.WaitEntered(1);
+  EXPECT_EQ(pPool->Pin(1)[0], 7);
+  pPool->Unpin(1, false);
+  EXPECT_EQ(iFile.GetReads(), 0);
+  iFile.Open();
+  pPool->Flush();
+  EXPECT_EQ(iFile.GetByte(1), 7);
+  delete pPool;
+}
+
+}  // namespace thdb
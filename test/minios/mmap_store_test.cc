@@ -0,0 +1,91 @@
+#include "minios/mmap_store.h"
+
+#include <sys/stat.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include "macros.h"
+#include "minios/os.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+static off_t FileSize(const String &sName) {
+  struct stat iStat;
+  if (stat(sName.c_str(), &iStat) != 0) return -1;
+  return iStat.st_size;
+}
+
+TEST(MmapStore, TruncatesToUsedPages) {
+  std::remove("THDB_PAGE");
+  DataFile *pFile = new DataFile();
+  MmapStore *pStore = new MmapStore(pFile);
+  for (PageID i = 0; i < 3; ++i) {
+    pStore->Pin(i, true)[0] = i + 1;
+    pStore->Unpin(i, true);
+  }
+  // 文件按 4MB 扩展，关闭时截断到实际使用的页面
+  EXPECT_EQ(FileSize("THDB_PAGE") % (1024 * PAGE_SIZE), 0);
+  EXPECT_EQ(pStore->Flush(), 3);
+  delete pStore;
+  delete pFile;
+  EXPECT_EQ(FileSize("THDB_PAGE"), 3 * PAGE_SIZE);
+
+  pFile = new DataFile();
+  pStore = new MmapStore(pFile);
+  for (PageID i = 0; i < 3; ++i) {
+    EXPECT_EQ(pStore->Pin(i)[0], i + 1);
+    pStore->Unpin(i, false);
+  }
+  delete pStore;
+  delete pFile;
+  std::remove("THDB_PAGE");
+}
+
+// 整个数据库通过 THDB_MMAP=1 使用映射文件
+class MmapStoreTest : public DBTest {
+ protected:
+  void SetUp() override {
+    setenv("THDB_MMAP", "1", 1);
+    DBTest::SetUp();
+  }
+
+  void TearDown() override {
+    DBTest::TearDown();
+    unsetenv("THDB_MMAP");
+  }
+};
+
+TEST_F(MmapStoreTest, SurvivesRestart) {
+  Run("CREATE TABLE t(a INT, b VARCHAR(16));");
+  Run("ALTER TABLE t ADD INDEX (a);");
+  String sInsert = "INSERT INTO t VALUES ";
+  for (int i = 0; i < 3000; ++i) {
+    if (i > 0) sInsert += ",";
+    sInsert += "(" + std::to_string(i) + ",'row" + std::to_string(i) + "')";
+  }
+  Run(sInsert + ";");
+  Run("UPDATE t SET b = 'new' WHERE t.a = 7;");
+  Run("DELETE FROM t WHERE t.a >= 2000;");
+  // 打开期间数据文件按整块扩展，说明确实在使用映射文件
+  EXPECT_EQ(FileSize("THDB_PAGE") % (1024 * PAGE_SIZE), 0);
+
+  Restart();
+  EXPECT_EQ(FileSize("THDB_PAGE") % PAGE_SIZE, 0);
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 7;"),
+            std::vector<String>{"7,new"});
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 1999;"),
+            std::vector<String>{"1999,row1999"});
+  EXPECT_TRUE(Run("SELECT * FROM t WHERE t.a = 2500;").empty());
+  EXPECT_EQ(Run("SELECT * FROM t;").size(), 2000u);
+
+  // 数据文件格式与缓冲池相同，可以不使用映射重新打开
+  unsetenv("THDB_MMAP");
+  Restart();
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 7;"),
+            std::vector<String>{"7,new"});
+  EXPECT_EQ(Run("SELECT * FROM t;").size(), 2000u);
+}
+
+}  // namespace thdb
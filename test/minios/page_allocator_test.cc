@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "macros.h"
+#include "minios/page_allocator.h"
+
+namespace thdb {
+
+TEST(PageAllocator, HintKeepsChainContiguous) {
+  PageAllocator iAlloc(8192, 4096);
+  // 两条交替增长的链表先共用第一个区段，之后各自占用保留的新区段
+  std::vector<PageID> iChainA{iAlloc.Allocate()}, iChainB{iAlloc.Allocate()};
+  for (int i = 0; i < 200; ++i) {
+    iChainA.push_back(iAlloc.Allocate(iChainA.back()));
+    iChainB.push_back(iAlloc.Allocate(iChainB.back()));
+  }
+  for (Size i = 1; i < iChainA.size(); ++i) {
+    if (iChainA[i] < EXTENT_PAGES) continue;
+    if (iChainA[i] % EXTENT_PAGES != 0) {
+      EXPECT_EQ(iChainA[i], iChainA[i - 1] + 1);
+    }
+    if (iChainB[i] % EXTENT_PAGES != 0) {
+      EXPECT_EQ(iChainB[i], iChainB[i - 1] + 1);
+    }
+    EXPECT_NE(iChainA[i] / EXTENT_PAGES, iChainB[i] / EXTENT_PAGES);
+  }
+  EXPECT_GE(iChainA.back(), EXTENT_PAGES);
+  EXPECT_EQ(iAlloc.GetUsed(), 402);
+}
+
+TEST(PageAllocator, UnhintedAvoidsReservedExtents) {
+  PageAllocator iAlloc(8192, 4096);
+  PageID nFirst = iAlloc.Allocate();
+  PageID nChain = iAlloc.Allocate(nFirst);
+  for (int i = 0; i < 10; ++i) {
+    PageID nPageID = iAlloc.Allocate();
+    EXPECT_NE(nPageID / EXTENT_PAGES, nChain / EXTENT_PAGES);
+  }
+}
+
+TEST(PageAllocator, StoreAndLoad) {
+  PageAllocator iAlloc(8192, 4096);
+  std::vector<PageID> iPageVec;
+  for (int i = 0; i < 300; ++i) iPageVec.push_back(iAlloc.Allocate());
+  iAlloc.Unset(iPageVec[7]);
+  PageID nFar = 5000;
+  iAlloc.Set(nFar);
+  EXPECT_TRUE(iAlloc.IsSegmentDirty(0));
+  EXPECT_TRUE(iAlloc.IsSegmentDirty(1));
+  PageAllocator iCopy(8192, 4096);
+  std::vector<uint8_t> iBits(iAlloc.GetSegmentBytes());
+  for (Size i = 0; i < iAlloc.GetSegmentSize(); ++i) {
+    iAlloc.Store(i, iBits.data());
+    EXPECT_FALSE(iAlloc.IsSegmentDirty(i));
+    iCopy.Load(i, iBits.data());
+  }
+  EXPECT_EQ(iCopy.GetUsed(), 300);
+  EXPECT_FALSE(iCopy.Get(iPageVec[7]));
+  EXPECT_TRUE(iCopy.Get(iPageVec[8]));
+  EXPECT_TRUE(iCopy.Get(nFar));
+  EXPECT_EQ(iCopy.NextUsed(iPageVec.back() + 1), nFar);
+}
+
+}  // namespace thdb
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "exception/exceptions.h"
+#include "macros.h"
+#include "minios/compressed_file.h"
+#include "minios/page_codec.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+// 依次生成全0、稀疏、重复字符和随机内容的页面
+static void FillPage(uint8_t *pPage, int nKind) {
+  for (PageOffset i = 0; i < PAGE_SIZE; ++i) {
+    if (nKind == 0)
+      pPage[i] = 0;
+    else if (nKind == 1)
+      pPage[i] = (i % 97 == 0) ? (uint8_t)i : 0;
+    else if (nKind == 2)
+      pPage[i] = "abcabcabd"[i % 9];
+    else
+      pPage[i] = (uint8_t)rand();
+  }
+}
+
+static void CheckRoundTrip(const PageCodec &iCodec) {
+  uint8_t pPage[PAGE_SIZE], pOut[PAGE_SIZE], pBack[PAGE_SIZE];
+  for (int nKind = 0; nKind < 4; ++nKind) {
+    FillPage(pPage, nKind);
+    PageOffset nLength = iCodec.Encode(pPage, pOut);
+    EXPECT_LE(nLength, PAGE_SIZE);
+    if (nKind == 0) {
+      EXPECT_EQ(nLength, 0);
+    }
+    memset(pBack, 0xff, PAGE_SIZE);
+    iCodec.Decode(1, pOut, nLength, pBack);
+    EXPECT_EQ(memcmp(pPage, pBack, PAGE_SIZE), 0) << iCodec.GetName() << nKind;
+  }
+}
+
+TEST(PageCodec, ZeroRoundTrip) {
+  ZeroCodec iCodec;
+  CheckRoundTrip(iCodec);
+}
+
+TEST(PageCodec, LZRoundTrip) {
+  srand(1);
+  LZCodec iCodec;
+  CheckRoundTrip(iCodec);
+  // 有规律的页面被压缩，随机页面原样存储
+  uint8_t pPage[PAGE_SIZE], pOut[PAGE_SIZE];
+  FillPage(pPage, 2);
+  EXPECT_LT(iCodec.Encode(pPage, pOut), PAGE_SIZE / 8);
+  FillPage(pPage, 3);
+  EXPECT_EQ(iCodec.Encode(pPage, pOut), PAGE_SIZE);
+}
+
+TEST(PageCodec, LZRejectsTruncatedInput) {
+  LZCodec iCodec;
+  uint8_t pPage[PAGE_SIZE], pOut[PAGE_SIZE], pBack[PAGE_SIZE];
+  FillPage(pPage, 1);
+  PageOffset nLength = iCodec.Encode(pPage, pOut);
+  ASSERT_GT(nLength, 1);
+  ASSERT_LT(nLength, PAGE_SIZE);
+  EXPECT_THROW(iCodec.Decode(1, pOut, nLength / 2, pBack), PageIOException);
+}
+
+TEST(PageCodec, NewByName) {
+  EXPECT_EQ(NewPageCodec("none"), nullptr);
+  PageCodec *pCodec = NewPageCodec("lz");
+  EXPECT_EQ(pCodec->GetName(), "lz");
+  delete pCodec;
+  EXPECT_THROW(NewPageCodec("gzip"), PageCodecException);
+}
+
+TEST(PageCodec, CompressedFileRoundTrip) {
+  uint8_t pPage[PAGE_SIZE], pBack[PAGE_SIZE];
+  CompressedFile *pFile = new CompressedFile(new LZCodec());
+  for (PageID i = 0; i < 40; ++i) {
+    FillPage(pPage, i % 4);
+    pPage[0] = (uint8_t)i;
+    pFile->Write(i, pPage);
+  }
+  // 覆盖写入长度不同的内容
+  FillPage(pPage, 3);
+  pFile->Write(2, pPage);
+  pFile->Sync();
+  delete pFile;
+  pFile = new CompressedFile(new LZCodec());
+  pFile->Read(2, pBack);
+  EXPECT_EQ(memcmp(pPage, pBack, PAGE_SIZE), 0);
+  for (PageID i = 4; i < 40; ++i) {
+    pFile->Read(i, pBack);
+    EXPECT_EQ(pBack[0], (uint8_t)i);
+  }
+  delete pFile;
+  std::remove(SegmentName("THDB_PAGE", 0).c_str());
+  std::remove(SegmentName("THDB_PAGEDIR", 0).c_str());
+}
+
+class CompressedDBTest : public DBTest {
+ protected:
+  void SetUp() override {
+    Clear();
+    Init("lz");
+    _pDB = new Instance();
+  }
+};
+
+TEST_F(CompressedDBTest, DataSurvivesRestart) {
+  Run("CREATE TABLE t(a INT, b VARCHAR(32));");
+  for (int i = 0; i < 20; ++i) {
+    String sInsert = "INSERT INTO t VALUES ";
+    for (int j = 0; j < 100; ++j) {
+      int nVal = i * 100 + j;
+      if (j > 0) sInsert += ",";
+      sInsert += "(" + std::to_string(nVal) + ",'v" + std::to_string(nVal) + "')";
+    }
+    Run(sInsert + ";");
+  }
+  Restart();
+  EXPECT_EQ(Run("SELECT * FROM t;").size(), 2000);
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 1999;"),
+            std::vector<String>{"1999,v1999"});
+}
+
+}  // namespace thdb
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include "minios/os.h"
+
+namespace thdb {
+
+// 各任务共用的执行记录
+struct StepLog {
+  std::mutex iMutex;
+  std::condition_variable iCond;
+  std::vector<int> iOrderVec;
+};
+
+// 记录执行顺序的任务，执行 nSteps 次后离开队列
+class CountingTask : public PrefetchTask {
+ public:
+  CountingTask(int nID, int nSteps, StepLog *pLog)
+      : _nID(nID), _nSteps(nSteps), _pLog(pLog) {}
+
+  bool Step() override {
+    std::lock_guard<std::mutex> iGuard(_pLog->iMutex);
+    _pLog->iOrderVec.push_back(_nID);
+    _pLog->iCond.notify_all();
+    return --_nSteps > 0;
+  }
+
+ private:
+  int _nID;
+  int _nSteps;
+  StepLog *_pLog;
+};
+
+// 第一次 Step 阻塞到 Release 为止
+class BlockingTask : public PrefetchTask {
+ public:
+  bool Step() override {
+    std::unique_lock<std::mutex> iLock(_iMutex);
+    ++_nSteps;
+    _iCond.notify_all();
+    _iCond.wait(iLock, [&]() { return _bReleased; });
+    return true;
+  }
+
+  void WaitStep() {
+    std::unique_lock<std::mutex> iLock(_iMutex);
+    _iCond.wait(iLock, [&]() { return _nSteps > 0; });
+  }
+  void Release() {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    _bReleased = true;
+    _iCond.notify_all();
+  }
+  int GetSteps() {
+    std::lock_guard<std::mutex> iGuard(_iMutex);
+    return _nSteps;
+  }
+
+ private:
+  std::mutex _iMutex;
+  std::condition_variable _iCond;
+  int _nSteps = 0;
+  bool _bReleased = false;
+};
+
+class PrefetchTest : public ::testing::Test {
+ protected:
+  void TearDown() override { MiniOS::WriteBack(); }
+};
+
+// 多个扫描共用一个预读线程，任务每执行一批就排到队尾
+TEST_F(PrefetchTest, TasksTakeTurns) {
+  MiniOS *pOS = MiniOS::GetOS();
+  StepLog iLog;
+  BlockingTask iGate;
+  CountingTask iFirst(1, 3, &iLog);
+  CountingTask iSecond(2, 2, &iLog);
+  pOS->SubmitPrefetch(&iGate);
+  iGate.WaitStep();
+  pOS->SubmitPrefetch(&iFirst);
+  pOS->SubmitPrefetch(&iSecond);
+  iGate.Release();
+  pOS->CancelPrefetch(&iGate);
+  {
+    std::unique_lock<std::mutex> iLock(iLog.iMutex);
+    iLog.iCond.wait_for(iLock, std::chrono::seconds(10),
+                        [&]() { return iLog.iOrderVec.size() == 5; });
+    EXPECT_EQ(iLog.iOrderVec, (std::vector<int>{1, 2, 1, 2, 1}));
+  }
+  pOS->CancelPrefetch(&iFirst);
+  pOS->CancelPrefetch(&iSecond);
+}
+
+// 取消时等待正在执行的 Step 结束，之后任务不再执行
+TEST_F(PrefetchTest, CancelWaitsForRunningStep) {
+  MiniOS *pOS = MiniOS::GetOS();
+  BlockingTask iTask;
+  pOS->SubmitPrefetch(&iTask);
+  iTask.WaitStep();
+  auto iCancel =
+      std::async(std::launch::async, [&]() { pOS->CancelPrefetch(&iTask); });
+  EXPECT_EQ(iCancel.wait_for(std::chrono::milliseconds(100)),
+            std::future_status::timeout);
+  iTask.Release();
+  iCancel.get();
+  EXPECT_EQ(iTask.GetSteps(), 1);
+}
+
+}  // namespace thdb
@@ -0,0 +1,101 @@
+#include "page/free_space_map.h"
+
+#include <map>
+
+#include "minios/os.h"
+#include "page/linked_page.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+// 与 free_space_map.cc 中每个映射页面的项数相同
+const Size LEAF_ENTRIES = DATA_SIZE / (sizeof(PageID) + 1);
+
+// 映射链表中的页面
+static std::vector<PageID> LeafPages(PageID nRootID) {
+  std::vector<PageID> iLeafVec;
+  for (PageID nPageID = nRootID; nPageID != NULL_PAGE;) {
+    iLeafVec.push_back(nPageID);
+    LinkedPage *pPage = new LinkedPage(nPageID);
+    nPageID = pPage->GetNextID();
+    delete pPage;
+  }
+  return iLeafVec;
+}
+
+static void ExpectLevels(const FreeSpaceMap &iMap,
+                         const std::map<PageID, uint8_t> &iLevelMap) {
+  for (const auto &iPair : iLevelMap)
+    EXPECT_EQ(iMap.Get(iPair.first), iPair.second) << iPair.first;
+}
+
+class FreeSpaceMapTest : public DBTest {};
+
+TEST_F(FreeSpaceMapTest, LeavesGrowShrinkAndReload) {
+  FreeSpaceMap *pMap = new FreeSpaceMap(NULL_PAGE, true);
+  PageID nRootID = pMap->GetRootID();
+  // 除两项外等级都是1，最后一项位于第三个映射页面
+  const Size nEntries = 2 * LEAF_ENTRIES + 10;
+  const PageID nBase = 100000;
+  const PageID nHigh = nBase + LEAF_ENTRIES + 5;
+  const PageID nLast = nBase + nEntries - 1;
+  std::map<PageID, uint8_t> iLevelMap;
+  for (Size i = 0; i < nEntries; ++i) iLevelMap[nBase + i] = 1;
+  iLevelMap[nHigh] = 9;
+  iLevelMap[nLast] = 7;
+  for (const auto &iPair : iLevelMap) pMap->Update(iPair.first, iPair.second);
+  std::vector<PageID> iLeafVec = LeafPages(nRootID);
+  ASSERT_EQ(iLeafVec.size(), 3);
+  EXPECT_EQ(pMap->Find(9), nHigh);
+  EXPECT_EQ(pMap->Find(7), nHigh);
+  EXPECT_EQ(pMap->Find(10), NULL_PAGE);
+  EXPECT_EQ(pMap->Get(nBase + nEntries), 0);
+
+  // 移除第一项，第三个映射页面中的最后一项移到第一个映射页面
+  pMap->Remove(nBase);
+  iLevelMap.erase(nBase);
+  EXPECT_EQ(pMap->Find(7), nLast);
+  EXPECT_EQ(pMap->Find(9), nHigh);
+  // 第三个映射页面只剩最后一项，移除后从链表中释放
+  for (PageID i = 1; i < 9; ++i) {
+    pMap->Remove(nBase + i);
+    iLevelMap.erase(nBase + i);
+  }
+  EXPECT_EQ(LeafPages(nRootID).size(), 3);
+  pMap->Remove(nBase + 9);
+  iLevelMap.erase(nBase + 9);
+  EXPECT_EQ(LeafPages(nRootID).size(), 2);
+  EXPECT_FALSE(MiniOS::GetOS()->Used(iLeafVec[2]));
+  ExpectLevels(*pMap, iLevelMap);
+  // 移除第二个映射页面中的最大等级后重新计算
+  pMap->Remove(nHigh);
+  iLevelMap.erase(nHigh);
+  EXPECT_EQ(pMap->Find(9), NULL_PAGE);
+  EXPECT_EQ(pMap->Find(7), nLast);
+  delete pMap;
+
+  // 从第一个映射页面重新导入
+  pMap = new FreeSpaceMap(nRootID);
+  ExpectLevels(*pMap, iLevelMap);
+  EXPECT_EQ(pMap->Get(nBase), 0);
+  EXPECT_EQ(pMap->Get(nHigh), 0);
+  EXPECT_EQ(pMap->Find(7), nLast);
+  EXPECT_EQ(pMap->Find(8), NULL_PAGE);
+  // 导入后第二个映射页面还差1项才满，继续添加会再次扩展链表
+  for (PageID i = 0; i < 10; ++i) pMap->Update(nBase + nEntries + i, 5);
+  EXPECT_EQ(LeafPages(nRootID).size(), 3);
+  pMap->Update(nLast, 1);
+  EXPECT_EQ(pMap->Find(5), nBase + nEntries);
+  delete pMap;
+
+  pMap = new FreeSpaceMap(nRootID);
+  EXPECT_EQ(pMap->Get(nLast), 1);
+  EXPECT_EQ(pMap->Get(nBase + nEntries + 9), 5);
+  EXPECT_EQ(pMap->Find(5), nBase + nEntries);
+  pMap->Clear();
+  for (const auto &nPageID : iLeafVec)
+    EXPECT_FALSE(MiniOS::GetOS()->Used(nPageID));
+  delete pMap;
+}
+
+}  // namespace thdb
@@ -0,0 +1,42 @@
+#include "page/log_page.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+class LogPageTest : public DBTest {};
+
+TEST_F(LogPageTest, RunCountRoundTrip) {
+  LogPage *pPage = new LogPage();
+  PageID nPageID = pPage->GetPageID();
+  pPage->log(LogLine(7, 1, LogOperation::INSERT, {11, 0}, 40));
+  pPage->log(LogLine(7, 1, LogOperation::INSERT, {12, 3}));
+  pPage->log(LogLine(7, 1, LogOperation::COMMIT, {0, 0}));
+  delete pPage;
+
+  pPage = new LogPage(nPageID);
+  std::vector<LogLine> iLogVec = pPage->getLogs();
+  delete pPage;
+  ASSERT_EQ(iLogVec.size(), 3);
+  EXPECT_EQ(iLogVec[0]._tableID, 7);
+  EXPECT_EQ(iLogVec[0]._location, PageSlotID(11, 0));
+  EXPECT_EQ(iLogVec[0]._count, 40);
+  EXPECT_EQ(iLogVec[1]._location, PageSlotID(12, 3));
+  EXPECT_EQ(iLogVec[1]._count, 1);
+  EXPECT_EQ(iLogVec[2]._logOp, LogOperation::COMMIT);
+}
+
+TEST_F(LogPageTest, FullPageRejectsLog) {
+  LogPage *pPage = new LogPage();
+  Size nLogs = 0;
+  LogLine iLine(1, 0, LogOperation::INSERT, {5, 0}, 2);
+  while (pPage->CanLog(iLine)) {
+    pPage->log(iLine);
+    ++nLogs;
+  }
+  EXPECT_TRUE(pPage->Full());
+  EXPECT_GT(nLogs, 100);
+  EXPECT_EQ(pPage->getLogs().size(), nLogs);
+  delete pPage;
+}
+
+}  // namespace thdb
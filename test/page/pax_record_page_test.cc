@@ -0,0 +1,81 @@
+#include <cstring>
+
+#include "page/pax_record_page.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+class PaxRecordPageTest : public DBTest {};
+
+static const std::vector<Size> SIZE_VEC{4, 8, 3};
+
+// 第 i 条记录的行格式：各列依次填充 'a'+i、'A'+i、'0'+i
+static std::vector<uint8_t> MakeRow(int i) {
+  std::vector<uint8_t> iRow;
+  iRow.insert(iRow.end(), SIZE_VEC[0], 'a' + i);
+  iRow.insert(iRow.end(), SIZE_VEC[1], 'A' + i);
+  iRow.insert(iRow.end(), SIZE_VEC[2], '0' + i);
+  return iRow;
+}
+
+TEST_F(PaxRecordPageTest, RowsRoundTripThroughColumns) {
+  PaxRecordPage *pPage = new PaxRecordPage(SIZE_VEC, true);
+  PageID nPageID = pPage->GetPageID();
+  // 容量与同样长度的行格式页面相同
+  RecordPage *pRowPage = new RecordPage(4 + 8 + 3, true);
+  EXPECT_EQ(pPage->GetCap(), pRowPage->GetCap());
+  EXPECT_EQ(pPage->GetFixedSize(), 15);
+  delete pRowPage;
+
+  for (int i = 0; i < 10; ++i)
+    EXPECT_EQ(pPage->InsertRecord(MakeRow(i).data()), (SlotID)i);
+  pPage->DeleteRecord(4);
+  pPage->UpdateRecord(7, MakeRow(20).data());
+  delete pPage;
+
+  pPage = new PaxRecordPage(nPageID, SIZE_VEC);
+  EXPECT_EQ(pPage->GetUsed(), 9);
+  EXPECT_FALSE(pPage->HasRecord(4));
+  std::vector<uint8_t> iBuffer(15);
+  pPage->ReadRecord(3, iBuffer.data());
+  EXPECT_EQ(iBuffer, MakeRow(3));
+  pPage->ReadRecord(7, iBuffer.data());
+  EXPECT_EQ(iBuffer, MakeRow(20));
+  // 空槽被优先复用
+  EXPECT_EQ(pPage->InsertRecord(MakeRow(9).data()), 4);
+  delete pPage;
+}
+
+TEST_F(PaxRecordPageTest, ColumnMinipagesAreContiguous) {
+  PaxRecordPage *pPage = new PaxRecordPage(SIZE_VEC, true);
+  Size nCap = pPage->GetCap();
+  for (int i = 0; i < 5; ++i) pPage->InsertRecord(MakeRow(i).data());
+  for (FieldID nPos = 0; nPos < SIZE_VEC.size(); ++nPos) {
+    Size nSize = pPage->GetColumnSize(nPos);
+    EXPECT_EQ(nSize, SIZE_VEC[nPos]);
+    std::vector<uint8_t> iColumn(nCap * nSize);
+    pPage->GetColumn(nPos, iColumn.data());
+    // 第 i 个槽的值位于小页的第 i 个位置
+    for (int i = 0; i < 5; ++i) {
+      std::vector<uint8_t> iRow = MakeRow(i);
+      Size nOffset = 0;
+      for (FieldID j = 0; j < nPos; ++j) nOffset += SIZE_VEC[j];
+      EXPECT_EQ(memcmp(iColumn.data() + i * nSize, iRow.data() + nOffset, nSize),
+                0);
+    }
+  }
+  delete pPage;
+}
+
+TEST_F(PaxRecordPageTest, FillToCapacity) {
+  PaxRecordPage *pPage = new PaxRecordPage(SIZE_VEC, true);
+  Size nCap = pPage->GetCap();
+  for (Size i = 0; i < nCap; ++i) pPage->InsertRecord(MakeRow(i % 30).data());
+  EXPECT_TRUE(pPage->Full());
+  std::vector<uint8_t> iBuffer(15);
+  pPage->ReadRecord(nCap - 1, iBuffer.data());
+  EXPECT_EQ(iBuffer, MakeRow((nCap - 1) % 30));
+  delete pPage;
+}
+
+}  // namespace thdb
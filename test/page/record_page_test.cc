@@ -0,0 +1,42 @@
+#include <cstring>
+
+#include "page/record_page.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+class RecordPageTest : public DBTest {};
+
+// 槽的占用位图只有1024位，很窄的记录也不能超过这个容量
+TEST_F(RecordPageTest, NarrowRowsCappedByBitmap) {
+  for (PageOffset nFixed : {1, 2, 3, 4}) {
+    RecordPage *pPage = new RecordPage(nFixed, true);
+    EXPECT_LE(pPage->GetCap(), 1024) << nFixed;
+    delete pPage;
+  }
+  RecordPage *pPage = new RecordPage(2, true);
+  PageID nPageID = pPage->GetPageID();
+  Size nCap = pPage->GetCap();
+  EXPECT_EQ(nCap, 1024);
+  uint8_t pData[2];
+  for (Size i = 0; i < nCap; ++i) {
+    pData[0] = 0;
+    pData[1] = i % 251;
+    EXPECT_EQ(pPage->InsertRecord(pData), (SlotID)i);
+  }
+  EXPECT_TRUE(pPage->Full());
+  delete pPage;
+
+  // 写回的位图不覆盖记录内容
+  pPage = new RecordPage(nPageID);
+  EXPECT_EQ(pPage->GetUsed(), nCap);
+  for (Size i = 0; i < nCap; ++i) {
+    uint8_t *pRecord = pPage->GetRecord(i);
+    EXPECT_EQ(pRecord[0], 0) << i;
+    EXPECT_EQ(pRecord[1], i % 251) << i;
+    delete[] pRecord;
+  }
+  delete pPage;
+}
+
+}  // namespace thdb
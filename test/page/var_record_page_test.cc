@@ -0,0 +1,92 @@
+#include <cstring>
+
+#include "page/var_record_page.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+class VarRecordPageTest : public DBTest {};
+
+static String MakeRecord(char c, Size nSize) { return String(nSize, c); }
+
+static String ReadRecord(VarRecordPage *pPage, SlotID nSlotID) {
+  uint8_t *pData = pPage->GetRecord(nSlotID);
+  String sRecord((char *)pData, pPage->GetRecordSize(nSlotID));
+  delete[] pData;
+  return sRecord;
+}
+
+TEST_F(VarRecordPageTest, InsertDeleteReuseSlot) {
+  VarRecordPage *pPage = new VarRecordPage(NULL_PAGE, true);
+  PageID nPageID = pPage->GetPageID();
+  std::vector<String> iRecordVec;
+  for (int i = 0; i < 10; ++i) {
+    iRecordVec.push_back(MakeRecord('a' + i, 10 + i * 7));
+    SlotID nSlotID = pPage->InsertRecord(
+        (const uint8_t *)iRecordVec[i].data(), iRecordVec[i].size());
+    EXPECT_EQ(nSlotID, (SlotID)i);
+  }
+  pPage->DeleteRecord(3);
+  EXPECT_FALSE(pPage->HasRecord(3));
+  EXPECT_EQ(pPage->GetUsed(), 9);
+  // 空槽被优先复用
+  String sNew = MakeRecord('z', 5);
+  EXPECT_EQ(pPage->InsertRecord((const uint8_t *)sNew.data(), sNew.size()), 3);
+  delete pPage;
+
+  // 槽目录在析构时写回，重新导入后内容不变
+  pPage = new VarRecordPage(nPageID);
+  EXPECT_EQ(pPage->GetSlots(), 10);
+  EXPECT_EQ(ReadRecord(pPage, 3), sNew);
+  for (int i = 0; i < 10; ++i) {
+    if (i != 3) {
+      EXPECT_EQ(ReadRecord(pPage, i), iRecordVec[i]);
+    }
+  }
+  delete pPage;
+}
+
+TEST_F(VarRecordPageTest, CompactReclaimsHoles) {
+  VarRecordPage *pPage = new VarRecordPage(NULL_PAGE, true);
+  String sRecord = MakeRecord('x', 200);
+  std::vector<SlotID> iSlotVec;
+  while (pPage->CanInsert(sRecord.size()))
+    iSlotVec.push_back(
+        pPage->InsertRecord((const uint8_t *)sRecord.data(), sRecord.size()));
+  EXPECT_EQ(pPage->InsertRecord((const uint8_t *)sRecord.data(),
+                                sRecord.size()),
+            NULL_SLOT);
+  // 删除隔一条记录后，更长的记录需要整理页面才能放下
+  for (Size i = 0; i < iSlotVec.size(); i += 2) pPage->DeleteRecord(iSlotVec[i]);
+  String sLong = MakeRecord('y', 350);
+  SlotID nSlotID =
+      pPage->InsertRecord((const uint8_t *)sLong.data(), sLong.size());
+  ASSERT_NE(nSlotID, NULL_SLOT);
+  EXPECT_EQ(ReadRecord(pPage, nSlotID), sLong);
+  for (Size i = 1; i < iSlotVec.size(); i += 2)
+    EXPECT_EQ(ReadRecord(pPage, iSlotVec[i]), sRecord);
+  delete pPage;
+}
+
+TEST_F(VarRecordPageTest, UpdateGrowAndShrink) {
+  VarRecordPage *pPage = new VarRecordPage(NULL_PAGE, true);
+  String sA = MakeRecord('a', 100), sB = MakeRecord('b', 100);
+  SlotID nA = pPage->InsertRecord((const uint8_t *)sA.data(), sA.size());
+  SlotID nB = pPage->InsertRecord((const uint8_t *)sB.data(), sB.size());
+  String sShort = MakeRecord('c', 10);
+  EXPECT_TRUE(
+      pPage->UpdateRecord(nA, (const uint8_t *)sShort.data(), sShort.size()));
+  String sLong = MakeRecord('d', 1000);
+  EXPECT_TRUE(
+      pPage->UpdateRecord(nB, (const uint8_t *)sLong.data(), sLong.size()));
+  EXPECT_EQ(ReadRecord(pPage, nA), sShort);
+  EXPECT_EQ(ReadRecord(pPage, nB), sLong);
+  // 超过页面容量的更新失败，原记录不变
+  String sHuge = MakeRecord('e', VarRecordPage::GetMaxRecordSize() + 1);
+  EXPECT_FALSE(
+      pPage->UpdateRecord(nA, (const uint8_t *)sHuge.data(), sHuge.size()));
+  EXPECT_EQ(ReadRecord(pPage, nA), sShort);
+  delete pPage;
+}
+
+}  // namespace thdb
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include "field/fields.h"
+#include "record/fixed_record.h"
+#include "record/row_view.h"
+
+namespace thdb {
+
+static const std::vector<FieldType> TYPE_VEC{
+    FieldType::INT_TYPE, FieldType::BIGINT_TYPE, FieldType::FLOAT_TYPE,
+    FieldType::STRING_TYPE, FieldType::TINYINT_TYPE};
+static const std::vector<Size> SIZE_VEC{4, 8, 8, 6, 1};
+
+TEST(NullBitmapTest, StoreAndLoad) {
+  FixedRecord iRecord(5, TYPE_VEC, SIZE_VEC, true);
+  iRecord.Build({"7", "NULL", "1.5", "NULL", "-3"});
+  EXPECT_EQ(iRecord.GetField(1)->GetType(), FieldType::NONE_TYPE);
+  // 1字节位图 + 4 + 8 + 8 + 6 + 1
+  std::vector<uint8_t> iData(28, 0xee);
+  EXPECT_EQ(iRecord.Store(iData.data()), 28);
+  EXPECT_EQ(iData[0], (1 << 1) | (1 << 3));
+  // 空字段的内容为0
+  for (Size i = 5; i < 13; ++i) EXPECT_EQ(iData[i], 0);
+  for (Size i = 21; i < 27; ++i) EXPECT_EQ(iData[i], 0);
+
+  FixedRecord iLoaded(5, TYPE_VEC, SIZE_VEC, true);
+  EXPECT_EQ(iLoaded.Load(iData.data()), 28);
+  EXPECT_EQ(iLoaded.GetField(0)->ToString(), "7");
+  EXPECT_EQ(iLoaded.GetField(1)->GetType(), FieldType::NONE_TYPE);
+  EXPECT_EQ(iLoaded.GetField(2)->ToString(), "1.5");
+  EXPECT_EQ(iLoaded.GetField(3)->GetType(), FieldType::NONE_TYPE);
+  EXPECT_EQ(iLoaded.GetField(4)->ToString(), "-3");
+}
+
+TEST(NullBitmapTest, WideRows) {
+  // 9个字段需要2字节的位图
+  std::vector<FieldType> iTypeVec(9, FieldType::SMALLINT_TYPE);
+  std::vector<Size> iSizeVec(9, 2);
+  FixedRecord iRecord(9, iTypeVec, iSizeVec, true);
+  iRecord.Build({"1", "2", "3", "4", "5", "6", "7", "8", "NULL"});
+  std::vector<uint8_t> iData(20, 0xee);
+  EXPECT_EQ(iRecord.Store(iData.data()), 20);
+  EXPECT_EQ(iData[0], 0);
+  EXPECT_EQ(iData[1], 1);
+  RowView iRow(iTypeVec, iSizeVec, true);
+  EXPECT_EQ(iRow.GetNullBitmapSize(), 2);
+  EXPECT_EQ(iRow.GetTotalSize(), 20);
+  iRow.Reset(iData.data());
+  EXPECT_FALSE(iRow.IsNull(7));
+  EXPECT_EQ(iRow.GetInt(7), 8);
+  EXPECT_TRUE(iRow.IsNull(8));
+  EXPECT_EQ(iRow.ToString(8), "");
+}
+
+TEST(NullBitmapTest, RowViewNullFree) {
+  FixedRecord iRecord(5, TYPE_VEC, SIZE_VEC, true);
+  iRecord.Build({"NULL", "1", "2.5", "'ab'", "NULL"});
+  std::vector<uint8_t> iData(28);
+  iRecord.Store(iData.data());
+  RowView iRow(TYPE_VEC, SIZE_VEC, true);
+  iRow.Reset(iData.data());
+  EXPECT_TRUE(iRow.MayHaveNull());
+  EXPECT_TRUE(iRow.IsNull(0));
+  EXPECT_FALSE(iRow.IsNull(1));
+  EXPECT_TRUE(iRow.IsNull(4));
+  EXPECT_EQ(iRow.GetBigInt(1), 1);
+  EXPECT_EQ(String(iRow.GetString(3), iRow.GetStringSize(3)), "ab");
+  // 扫描确认页面中没有空值后不再检查位图
+  iRow.SetNullFree(true);
+  EXPECT_FALSE(iRow.MayHaveNull());
+  EXPECT_FALSE(iRow.IsNull(0));
+  iRow.SetNullFree(false);
+  EXPECT_TRUE(iRow.IsNull(0));
+
+  // 早期版本的表没有位图，空字段无法保存
+  RowView iOld(TYPE_VEC, SIZE_VEC);
+  EXPECT_EQ(iOld.GetNullBitmapSize(), 0);
+  EXPECT_EQ(iOld.GetTotalSize(), 27);
+  EXPECT_FALSE(iOld.MayHaveNull());
+}
+
+}  // namespace thdb
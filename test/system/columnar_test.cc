@@ -0,0 +1,69 @@
+#include <algorithm>
+
+#include "test_utils.h"
+
+namespace thdb {
+
+class ColumnarTest : public DBTest {
+ protected:
+  // 同样的数据分别写入行存表 r 和列存表 c
+  void FillBoth(int nRows) {
+    Run("CREATE TABLE r(a INT, b VARCHAR(16), f FLOAT);");
+    Run("CREATE TABLE c(a INT, b VARCHAR(16), f FLOAT) WITH LAYOUT = COLUMNAR;");
+    String sValues;
+    for (int i = 1; i <= nRows; ++i) {
+      if (i > 1) sValues += ",";
+      String sB = (i % 5 == 0) ? "NULL" : "'s" + std::to_string(i % 13) + "'";
+      sValues += "(" + std::to_string(i) + "," + sB + "," +
+                 std::to_string(i % 17) + ".5)";
+    }
+    Run("INSERT INTO r VALUES " + sValues + ";");
+    Run("INSERT INTO c VALUES " + sValues + ";");
+  }
+
+  std::vector<String> Sorted(const String &sSQL) {
+    std::vector<String> iRowVec = Run(sSQL);
+    std::sort(iRowVec.begin(), iRowVec.end());
+    return iRowVec;
+  }
+
+  // 语句中的 $ 替换为表名，两张表的结果应当相同
+  void ExpectSame(const String &sSQL) {
+    EXPECT_EQ(Sorted(WithTable(sSQL, "c")), Sorted(WithTable(sSQL, "r")))
+        << sSQL;
+  }
+
+  static String WithTable(String sSQL, const String &sTable) {
+    std::replace(sSQL.begin(), sSQL.end(), '$', sTable[0]);
+    return sSQL;
+  }
+};
+
+TEST_F(ColumnarTest, ScansMatchRowLayout) {
+  FillBoth(3000);
+  ExpectSame("SELECT * FROM $;");
+  // 只检查部分列的条件走列存的小页扫描
+  ExpectSame("SELECT * FROM $ WHERE $.a >= 2500;");
+  EXPECT_EQ(Run("SELECT * FROM c WHERE c.a >= 2500;").size(), 501);
+  EXPECT_EQ(Run("SELECT * FROM c WHERE c.b = 's7';").size(), 185);
+  ExpectSame("SELECT * FROM $ WHERE $.b = 's7';");
+  ExpectSame("SELECT * FROM $ WHERE $.f > 10.0 AND $.a < 900;");
+  ExpectSame("SELECT * FROM $ WHERE $.b = 's3' AND $.f < 3.0;");
+}
+
+TEST_F(ColumnarTest, UpdateDeleteAndIndex) {
+  FillBoth(2000);
+  Run("ALTER TABLE c ADD INDEX (a);");
+  Run("UPDATE c SET b = 'upd' WHERE c.a >= 1990;");
+  Run("UPDATE r SET b = 'upd' WHERE r.a >= 1990;");
+  Run("DELETE FROM c WHERE c.f < 2.0;");
+  Run("DELETE FROM r WHERE r.f < 2.0;");
+  ExpectSame("SELECT * FROM $ WHERE $.b = 'upd';");
+  ExpectSame("SELECT * FROM $ WHERE $.a = 1995;");
+  EXPECT_EQ(Run("SELECT * FROM c WHERE c.a = 1995;").size(), 1);
+  Restart();
+  ExpectSame("SELECT * FROM $;");
+  ExpectSame("SELECT * FROM $ WHERE $.a >= 1000;");
+}
+
+}  // namespace thdb
@@ -0,0 +1,71 @@
+#include <cstdio>
+#include <fstream>
+
+#include "exception/exceptions.h"
+#include "settings.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+static const char *CSV_PATH = "copy_test.csv";
+
+class CopyTest : public DBTest {
+ protected:
+  void TearDown() override {
+    std::remove(CSV_PATH);
+    DBTest::TearDown();
+  }
+
+  void WriteFile(const String &sContent) {
+    std::ofstream fout{CSV_PATH, std::ios::binary};
+    fout << sContent;
+  }
+};
+
+TEST_F(CopyTest, CopyFromStatement) {
+  Run("CREATE TABLE t(a INT, b VARCHAR(10), c FLOAT);");
+  WriteFile("1,x,1.5\n2,\"\",2.5\n3,,\nNULL,\"y,z\",4\n");
+  std::vector<String> iResVec =
+      Run(String("COPY t FROM '") + CSV_PATH + "';");
+  ASSERT_EQ(iResVec.size(), 1);
+  EXPECT_EQ(iResVec[0].substr(0, 2), "4,");
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 1;").front().substr(0, 4), "1,x,");
+  // 带引号的空字段是空字符串，未加引号的空字段和 NULL 是空值
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.b = '';").size(), 1);
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.b = 'y,z';").size(), 1);
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a > 0;").size(), 3);
+}
+
+TEST_F(CopyTest, DelimiterOption) {
+  Run("CREATE TABLE t(a INT, b VARCHAR(10));");
+  Run("ALTER TABLE t ADD INDEX (a);");
+  String sContent;
+  for (int i = 1; i <= (int)COPY_BATCH_ROWS * 2 + 5; ++i)
+    sContent += std::to_string(i) + "|s" + std::to_string(i % 3) + "\n";
+  WriteFile(sContent);
+  Run(String("COPY t FROM '") + CSV_PATH + "' DELIMITER '|';");
+  EXPECT_EQ(Run("SELECT * FROM t;").size(), COPY_BATCH_ROWS * 2 + 5);
+  // 导入的记录同时插入索引
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 4097;"),
+            std::vector<String>{"4097,s2"});
+  EXPECT_THROW(Run(String("COPY t FROM '") + CSV_PATH + "' DELIMITER '||';"),
+               ParserException);
+}
+
+TEST_F(CopyTest, ErrorKeepsEarlierBatches) {
+  Run("CREATE TABLE t(a INT, b INT);");
+  String sContent;
+  for (Size i = 1; i <= COPY_BATCH_ROWS; ++i)
+    sContent += std::to_string(i) + ",0\n";
+  sContent += "1,2,3\n";
+  WriteFile(sContent);
+  EXPECT_THROW(Run(String("COPY t FROM '") + CSV_PATH + "';"), LoadException);
+  EXPECT_EQ(Run("SELECT * FROM t;").size(), COPY_BATCH_ROWS);
+
+  WriteFile("1,abc\n");
+  EXPECT_THROW(Run(String("COPY t FROM '") + CSV_PATH + "';"), LoadException);
+  EXPECT_THROW(Run("COPY t FROM 'no_such_file.csv';"), LoadException);
+  EXPECT_THROW(Run("COPY missing FROM 'x.csv';"), TableException);
+}
+
+}  // namespace thdb
@@ -0,0 +1,108 @@
+#include <algorithm>
+
+#include "exception/exceptions.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+class IntTypesTest : public DBTest {};
+
+// 列类型由语法解析，同名的列在不同的表中互不影响
+TEST_F(IntTypesTest, TypesPerTable) {
+  Run("CREATE TABLE a(x BIGINT, y TINYINT, z SMALLINT); "
+      "CREATE TABLE b(x INT, y VARCHAR(4));");
+  EXPECT_EQ(Run("DESC a;"), (std::vector<String>{"x,BigInt,8", "y,TinyInt,1",
+                                                 "z,SmallInt,2"}));
+  EXPECT_EQ(Run("DESC b;"),
+            (std::vector<String>{"x,Integer,4", "y,String,4"}));
+  // 类型名不是保留字之外的标识符，不能作为列名
+  EXPECT_THROW(Run("CREATE TABLE c(BIGINT INT);"), ParserException);
+  // 字符串中的类型名不受影响
+  Run("INSERT INTO b VALUES (1,'INT');");
+  EXPECT_EQ(Run("SELECT * FROM b;"), std::vector<String>{"1,INT"});
+}
+
+TEST_F(IntTypesTest, ValueRanges) {
+  Run("CREATE TABLE t(a TINYINT, b SMALLINT, c BIGINT);");
+  Run("INSERT INTO t VALUES (1,32767,9223372036854775807),"
+      "(127,1,9223372036854775806);");
+  EXPECT_THROW(Run("INSERT INTO t VALUES (128,1,1);"), RecordValueException);
+  EXPECT_THROW(Run("INSERT INTO t VALUES (1,32768,1);"), RecordValueException);
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.c = 9223372036854775806;"),
+            std::vector<String>{"127,1,9223372036854775806"});
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.b > 100;"),
+            std::vector<String>{"1,32767,9223372036854775807"});
+}
+
+// 整数列上的条件换算为整数闭区间，0 和类型的最大值都能取到，有无索引结果相同
+TEST_F(IntTypesTest, IntegerBounds) {
+  Run("CREATE TABLE t(a TINYINT, b SMALLINT, c BIGINT, d INT);");
+  Run("INSERT INTO t VALUES (0,0,9223372036854775807,2147483647),"
+      "(5,300,9223372036854775806,0),(127,32767,0,7);");
+  const std::vector<std::pair<String, Size>> iCaseVec = {
+      {"t.c = 9223372036854775807", 1},
+      {"t.c >= 9223372036854775807", 1},
+      {"t.c <= 9223372036854775807", 3},
+      {"t.c > 9223372036854775806", 1},
+      {"t.c < 9223372036854775807", 2},
+      {"t.c <> 9223372036854775807", 2},
+      {"t.c > 9223372036854775807", 0},
+      {"t.a < 10", 2},
+      {"t.a <= 0", 1},
+      {"t.a >= 127", 1},
+      {"t.a > 127", 0},
+      {"t.a < 1000", 3},
+      {"t.b < 1", 1},
+      {"t.b = 32767", 1},
+      {"t.d >= 2147483647", 1},
+      {"t.d < 1", 1},
+      {"t.a = 0 AND t.c < 5", 0},
+      {"t.a = 0 AND t.b < 5", 1},
+  };
+  for (int nRound = 0; nRound < 2; ++nRound) {
+    if (nRound == 1)
+      for (const String sCol : {"a", "b", "c", "d"})
+        Run("ALTER TABLE t ADD INDEX (" + sCol + ");");
+    for (const auto &iCase : iCaseVec)
+      EXPECT_EQ(Run("SELECT * FROM t WHERE " + iCase.first + ";").size(),
+                iCase.second)
+          << iCase.first << (nRound ? " with index" : "");
+  }
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.c = 9223372036854775807;"),
+            std::vector<String>{"0,0,9223372036854775807,2147483647"});
+}
+
+// 一个 TINYINT 列加上空值位图每条记录2字节，页面容量受槽位图的限制
+TEST_F(IntTypesTest, NarrowRowsSurviveRestart) {
+  Run("CREATE TABLE t(a TINYINT);");
+  Run("CREATE TABLE s(a TINYINT, b TINYINT);");
+  for (const String sTable : {"t", "s"}) {
+    String sInsert = "INSERT INTO " + sTable + " VALUES ";
+    for (int i = 0; i < 3000; ++i) {
+      if (i > 0) sInsert += ",";
+      String sValue = std::to_string(i % 100 + 1);
+      sInsert += (sTable == "t") ? "(" + sValue + ")"
+                                 : "(" + sValue + "," + sValue + ")";
+    }
+    Run(sInsert + ";");
+  }
+  for (int nRound = 0; nRound < 2; ++nRound) {
+    for (const String sTable : {"t", "s"}) {
+      std::vector<String> iRowVec = Run("SELECT * FROM " + sTable + ";");
+      EXPECT_EQ(iRowVec.size(), 3000);
+      EXPECT_EQ(std::count_if(iRowVec.begin(), iRowVec.end(),
+                              [](const String &sRow) {
+                                return sRow.empty() || sRow[0] == ',' ||
+                                       sRow.back() == ',';
+                              }),
+                0);
+      EXPECT_EQ(Run("SELECT * FROM " + sTable + " WHERE " + sTable +
+                    ".a = 42;")
+                    .size(),
+                30);
+    }
+    Restart();
+  }
+}
+
+}  // namespace thdb
@@ -0,0 +1,52 @@
+#include "exception/exceptions.h"
+#include "table/table.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+class LayoutTest : public DBTest {};
+
+TEST_F(LayoutTest, TableOptionSelectsFormat) {
+  Run("CREATE TABLE r(a INT);");
+  Run("CREATE TABLE v(a INT, b VARCHAR(20)) WITH LAYOUT = VARIABLE;");
+  Run("CREATE TABLE c(a INT) WITH LAYOUT = columnar;");
+  Run("CREATE TABLE f(a INT) WITH LAYOUT = Row;");
+  EXPECT_EQ(_pDB->GetTable("r")->GetFormat(), RecordFormat::FIXED_FORMAT);
+  EXPECT_EQ(_pDB->GetTable("v")->GetFormat(), RecordFormat::VAR_FORMAT);
+  EXPECT_EQ(_pDB->GetTable("c")->GetFormat(), RecordFormat::PAX_FORMAT);
+  EXPECT_EQ(_pDB->GetTable("f")->GetFormat(), RecordFormat::FIXED_FORMAT);
+  // 格式保存在表的元数据页面中
+  Restart();
+  EXPECT_EQ(_pDB->GetTable("v")->GetFormat(), RecordFormat::VAR_FORMAT);
+  EXPECT_EQ(_pDB->GetTable("c")->GetFormat(), RecordFormat::PAX_FORMAT);
+}
+
+TEST_F(LayoutTest, UnknownLayoutRejected) {
+  EXPECT_THROW(Run("CREATE TABLE t(a INT) WITH LAYOUT = DIAGONAL;"),
+               ParserException);
+  EXPECT_THROW(Run("CREATE TABLE t(a INT) WITH LAYOUT;"), ParserException);
+  EXPECT_EQ(_pDB->GetTable("t"), nullptr);
+}
+
+TEST_F(LayoutTest, VariableRowsMoveOnGrowingUpdate) {
+  Run("CREATE TABLE t(a INT, b VARCHAR(255)) WITH LAYOUT = VARIABLE;");
+  Run("ALTER TABLE t ADD INDEX (a);");
+  String sInsert = "INSERT INTO t VALUES ";
+  for (int i = 0; i < 500; ++i) {
+    if (i > 0) sInsert += ",";
+    sInsert += "(" + std::to_string(i) + ",'s')";
+  }
+  Run(sInsert + ";");
+  String sLong(200, 'x');
+  // 原页面放不下变长后的记录，记录被移动到其他页面，索引指向新位置
+  Run("UPDATE t SET b = '" + sLong + "' WHERE t.a >= 400;");
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 442;"),
+            std::vector<String>{"442," + sLong});
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 42;"),
+            std::vector<String>{"42,s"});
+  Restart();
+  EXPECT_EQ(Run("SELECT * FROM t;").size(), 500);
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.b = '" + sLong + "';").size(), 100);
+}
+
+}  // namespace thdb
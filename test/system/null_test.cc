@@ -0,0 +1,78 @@
+#include <algorithm>
+
+#include "test_utils.h"
+
+namespace thdb {
+
+class NullTest : public DBTest,
+                 public ::testing::WithParamInterface<const char *> {
+ protected:
+  void Create(const String &sTable) {
+    Run("CREATE TABLE " + sTable +
+        "(a INT, b BIGINT, c FLOAT, d VARCHAR(8)) WITH LAYOUT = " +
+        GetParam() + ";");
+  }
+
+  std::vector<String> Select(const String &sTable, const String &sWhere) {
+    std::vector<String> iRowVec =
+        Run("SELECT * FROM " + sTable + " WHERE " + sWhere + ";");
+    std::sort(iRowVec.begin(), iRowVec.end());
+    return iRowVec;
+  }
+};
+
+// 与 NULL 的比较结果为假，<> 也不例外
+TEST_P(NullTest, NotEqualSkipsNull) {
+  for (const String sTable : {"s", "i"}) {
+    Create(sTable);
+    Run("INSERT INTO " + sTable +
+        " VALUES (1,10,1.5,'x'),(2,20,2.5,'y'),"
+        "(NULL,NULL,NULL,NULL),(3,NULL,3.5,NULL);");
+  }
+  Run("ALTER TABLE i ADD INDEX (a);");
+  Run("ALTER TABLE i ADD INDEX (b);");
+  Run("ALTER TABLE i ADD INDEX (c);");
+  Run("ALTER TABLE i ADD INDEX (d);");
+  for (int nRound = 0; nRound < 2; ++nRound) {
+    for (const String sTable : {"s", "i"}) {
+      EXPECT_EQ(Select(sTable, sTable + ".a <> 2"),
+                (std::vector<String>{"1,10,1.5,x", "3,,3.5,"}));
+      EXPECT_EQ(Select(sTable, sTable + ".b <> 20"),
+                (std::vector<String>{"1,10,1.5,x"}));
+      EXPECT_EQ(Select(sTable, sTable + ".c <> 1.5"),
+                (std::vector<String>{"2,20,2.5,y", "3,,3.5,"}));
+      EXPECT_EQ(Select(sTable, sTable + ".d <> 'x'"),
+                (std::vector<String>{"2,20,2.5,y"}));
+      EXPECT_EQ(Select(sTable, sTable + ".b >= 10").size(), 2);
+      EXPECT_EQ(Select(sTable, sTable + ".a > 0").size(), 3);
+    }
+    Restart();
+  }
+}
+
+// 没有空值的页面跳过逐条的空值检查，结果与有空值的页面一致
+TEST_P(NullTest, PagesWithAndWithoutNulls) {
+  Create("t");
+  String sInsert = "INSERT INTO t VALUES ";
+  for (int i = 1; i <= 3000; ++i) {
+    if (i > 1) sInsert += ",";
+    String sValue = std::to_string(i % 10);
+    if (i > 2500 && i % 3 == 0)
+      sInsert += "(" + std::to_string(i) + ",NULL,NULL,NULL)";
+    else
+      sInsert += "(" + std::to_string(i) + "," + sValue + "," + sValue +
+                 ",'" + sValue + "')";
+  }
+  Run(sInsert + ";");
+  // 2501..3000 中有167个3的倍数
+  EXPECT_EQ(Select("t", "t.b <> 5").size(), 3000 - 167 - 283);
+  EXPECT_EQ(Select("t", "t.c = 5").size(), 283);
+  EXPECT_EQ(Select("t", "t.d <> '5'").size(), 3000 - 167 - 283);
+  EXPECT_EQ(Select("t", "t.b < 5").size(), 1500 - 167 / 2 - 1);
+  EXPECT_EQ(Select("t", "t.a <> 7").size(), 2999);
+}
+
+INSTANTIATE_TEST_SUITE_P(Layouts, NullTest,
+                         ::testing::Values("ROW", "VARIABLE", "COLUMNAR"));
+
+}  // namespace thdb
@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <map>
+
+#include "manager/transaction_manager.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+// 表的页面数超过 RECORD_PAGE_CACHE_PAGES，扫描时缓存中的页面不断被淘汰，
+// 删除、更新、事务撤销和整理都要让缓存中的对象与页面内容保持一致
+class PageCacheTest : public DBTest {
+ protected:
+  void SetUp() override {
+    unsetenv("THDB_PAGE_CACHE");
+    DBTest::SetUp();
+  }
+
+  void Fill(int nBegin, int nEnd) {
+    String sInsert = "INSERT INTO t VALUES ";
+    for (int i = nBegin; i < nEnd; ++i) {
+      if (i > nBegin) sInsert += ",";
+      sInsert += "(" + std::to_string(i) + ",'v" + std::to_string(i) + "')";
+      _iRowMap[i] = "v" + std::to_string(i);
+    }
+    Run(sInsert + ";");
+  }
+
+  void Erase(int nBegin, int nEnd) {
+    Run("DELETE FROM t WHERE t.a >= " + std::to_string(nBegin) +
+        " AND t.a < " + std::to_string(nEnd) + ";");
+    _iRowMap.erase(_iRowMap.lower_bound(nBegin), _iRowMap.lower_bound(nEnd));
+  }
+
+  void Rename(int nBegin, int nEnd, const String &sValue) {
+    Run("UPDATE t SET b = '" + sValue + "' WHERE t.a >= " +
+        std::to_string(nBegin) + " AND t.a < " + std::to_string(nEnd) + ";");
+    for (auto it = _iRowMap.lower_bound(nBegin);
+         it != _iRowMap.lower_bound(nEnd); ++it)
+      it->second = sValue;
+  }
+
+  // 全表扫描、带条件的扫描和索引查找都与期望的内容相同
+  void Check() {
+    std::vector<String> iExpectVec;
+    for (const auto &iPair : _iRowMap)
+      iExpectVec.push_back(std::to_string(iPair.first) + "," + iPair.second);
+    std::sort(iExpectVec.begin(), iExpectVec.end());
+    std::vector<String> iRowVec = Run("SELECT * FROM t;");
+    std::sort(iRowVec.begin(), iRowVec.end());
+    ASSERT_EQ(iRowVec, iExpectVec);
+    Size nCount = 0;
+    for (const auto &iPair : _iRowMap)
+      if (iPair.second == "u") ++nCount;
+    EXPECT_EQ(Run("SELECT * FROM t WHERE t.b = 'u';").size(), nCount);
+    for (const auto &iPair : _iRowMap) {
+      if (iPair.first % 997 != 0) continue;
+      EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = " +
+                    std::to_string(iPair.first) + ";"),
+                std::vector<String>{std::to_string(iPair.first) + "," +
+                                    iPair.second});
+    }
+  }
+
+  void Interleave(const String &sLayout) {
+    Run("CREATE TABLE t(a INT, b VARCHAR(40))" + sLayout + ";");
+    Run("ALTER TABLE t ADD INDEX (a);");
+    Fill(0, 30000);
+    Check();
+    Erase(1000, 9000);
+    Check();
+    Rename(20000, 30000, "u");
+    Check();
+
+    // 未提交的插入填入删除留下的空间，撤销后从扫描中消失
+    TransactionManager *pTxnManager = _pDB->GetTransactionManager();
+    Transaction *txn = pTxnManager->Begin();
+    std::vector<std::vector<String>> iRawVec;
+    for (int i = 40000; i < 41000; ++i)
+      iRawVec.push_back({std::to_string(i), "'x'"});
+    _pDB->InsertBatch("t", iRawVec, txn);
+    EXPECT_EQ(Run("SELECT * FROM t WHERE t.a >= 40000;").size(), 1000);
+    pTxnManager->Abort(txn);
+    delete txn;
+    Check();
+
+    // 整理把尾部页面的记录移动到前部，之后继续修改
+    EXPECT_GT(std::stoi(Run("VACUUM t;")[0]), 0);
+    Check();
+    Rename(25000, 26000, "w");
+    Erase(28000, 29000);
+    Fill(30000, 31000);
+    Check();
+    Restart();
+    Check();
+  }
+
+  std::map<int, String> _iRowMap;
+};
+
+TEST_F(PageCacheTest, FixedLayout) { Interleave(""); }
+
+TEST_F(PageCacheTest, ColumnarLayout) { Interleave(" WITH LAYOUT = COLUMNAR"); }
+
+}  // namespace thdb
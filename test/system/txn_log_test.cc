@@ -0,0 +1,111 @@
+#include <set>
+
+#include "manager/recovery_manager.h"
+#include "manager/transaction_manager.h"
+#include "page/log_page.h"
+#include "table/schema.h"
+#include "table/table.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+class TxnLogTest : public DBTest {
+ protected:
+  std::vector<std::vector<String>> MakeRows(int nBegin, int nEnd) {
+    std::vector<std::vector<String>> iRowVec;
+    for (int i = nBegin; i < nEnd; ++i)
+      iRowVec.push_back({std::to_string(i), std::to_string(i % 7)});
+    return iRowVec;
+  }
+
+  // 沿日志链表读出所有日志
+  std::vector<LogLine> ReadLogs() {
+    std::vector<LogLine> iLogVec;
+    PageID nPageID = _pDB->GetTransactionManager()->getLogPageID();
+    while (nPageID != NULL_PAGE) {
+      LogPage *pPage = new LogPage(nPageID);
+      std::vector<LogLine> iPageVec = pPage->getLogs();
+      iLogVec.insert(iLogVec.end(), iPageVec.begin(), iPageVec.end());
+      nPageID = pPage->GetNextID();
+      delete pPage;
+    }
+    return iLogVec;
+  }
+
+  void CreateTxnTable() {
+    _pDB->CreateTable("t",
+                      Schema({Column("a", FieldType::INT_TYPE),
+                              Column("b", FieldType::INT_TYPE)}),
+                      true);
+  }
+};
+
+TEST_F(TxnLogTest, BatchInsertLogsPageRuns) {
+  CreateTxnTable();
+  TransactionManager *pTxnManager = _pDB->GetTransactionManager();
+  Transaction *txn = pTxnManager->Begin();
+  std::vector<PageSlotID> iPairVec = _pDB->InsertBatch("t", MakeRows(0, 3000), txn);
+  std::set<PageID> iPageSet;
+  for (const auto &iPair : iPairVec) iPageSet.insert(iPair.first);
+
+  Size nInserts = 0, nRows = 0;
+  for (const auto &iLog : ReadLogs()) {
+    if (iLog._logOp != LogOperation::INSERT) continue;
+    ++nInserts;
+    nRows += iLog._count;
+  }
+  // 一个页面上连续插入的记录只写一条日志
+  EXPECT_EQ(nRows, 3000);
+  EXPECT_EQ(nInserts, iPageSet.size());
+  pTxnManager->Commit(txn);
+  delete txn;
+}
+
+TEST_F(TxnLogTest, UndoWalksRunsAcrossLogPages) {
+  CreateTxnTable();
+  TransactionManager *pTxnManager = _pDB->GetTransactionManager();
+  Transaction *pCommitted = pTxnManager->Begin();
+  _pDB->InsertBatch("t", MakeRows(0, 500), pCommitted);
+  pTxnManager->Commit(pCommitted);
+  delete pCommitted;
+
+  // 逐条插入使每行一条日志，日志写满第一个页面后追加新页面
+  Transaction *pActive = pTxnManager->Begin();
+  for (int i = 500; i < 1500; ++i)
+    _pDB->Insert("t", {std::to_string(i), "0"}, pActive);
+  _pDB->InsertBatch("t", MakeRows(1500, 4000), pActive);
+  PageID nLogPageID = pTxnManager->getLogPageID();
+  EXPECT_NE(LinkedPage(nLogPageID).GetNextID(), NULL_PAGE);
+
+  // 未提交事务的插入全部被撤销，已提交的保留
+  _pDB->GetRecoveryManager()->Undo();
+  Table *pTable = _pDB->GetTable("t");
+  EXPECT_EQ(pTable->SearchRecord(nullptr).size(), 500);
+  delete pActive;
+}
+
+TEST_F(TxnLogTest, BatchIndexMaintenance) {
+  Run("CREATE TABLE t(a INT, b INT);");
+  Run("ALTER TABLE t ADD INDEX (a);");
+  // 乱序且重复的键按排序后批量插入索引，叶子分裂时继续插入正确的叶子
+  String sInsert = "INSERT INTO t VALUES ";
+  for (int i = 0; i < 3000; ++i) {
+    if (i > 0) sInsert += ",";
+    int nKey = (i * 7919) % 1000 + 1;
+    sInsert += "(" + std::to_string(nKey) + "," + std::to_string(i) + ")";
+  }
+  Run(sInsert + ";");
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 1;").size(), 3);
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 1000;").size(), 3);
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a >= 500;").size(), 1503);
+
+  // 在已有数据上建立索引同样走批量插入
+  Run("ALTER TABLE t ADD INDEX (b);");
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.b = 2999;"),
+            std::vector<String>{std::to_string(2999 * 7919 % 1000 + 1) + ",2999"});
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.b >= 1000;").size(), 2000);
+  Restart();
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 777;").size(), 3);
+}
+
+}  // namespace thdb
@@ -0,0 +1,70 @@
+#include "exception/exceptions.h"
+#include "manager/transaction_manager.h"
+#include "test_utils.h"
+
+namespace thdb {
+
+class VacuumTest : public DBTest {
+ protected:
+  void Fill(const String &sTable, int nRows) {
+    String sInsert = "INSERT INTO " + sTable + " VALUES ";
+    for (int i = 1; i <= nRows; ++i) {
+      if (i > 1) sInsert += ",";
+      sInsert += "(" + std::to_string(i) + ",'v" + std::to_string(i) + "')";
+    }
+    Run(sInsert + ";");
+  }
+
+  int Vacuum(const String &sTable) {
+    std::vector<String> iResVec = Run("VACUUM " + sTable + ";");
+    EXPECT_EQ(iResVec.size(), 1);
+    return std::stoi(iResVec[0]);
+  }
+};
+
+TEST_F(VacuumTest, FreesPagesAndKeepsIndex) {
+  Run("CREATE TABLE t(a INT, b VARCHAR(40));");
+  Run("ALTER TABLE t ADD INDEX (a);");
+  Fill("t", 5000);
+  // 删除大部分记录后，剩余记录移动到前部页面，尾部页面被释放
+  Run("DELETE FROM t WHERE t.a > 100;");
+  Run("INSERT INTO t VALUES (4900,'late');");
+  EXPECT_GT(Vacuum("t"), 0);
+  EXPECT_EQ(Run("SELECT * FROM t;").size(), 101);
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 4900;"),
+            std::vector<String>{"4900,late"});
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a >= 50;").size(), 52);
+  // 已经整理过的表再次整理不释放页面
+  EXPECT_EQ(Vacuum("t"), 0);
+  Restart();
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 4900;"),
+            std::vector<String>{"4900,late"});
+  Fill("t", 10);
+  EXPECT_EQ(Run("SELECT * FROM t;").size(), 111);
+}
+
+TEST_F(VacuumTest, VariableLayout) {
+  Run("CREATE TABLE t(a INT, b VARCHAR(40)) WITH LAYOUT = VARIABLE;");
+  Run("ALTER TABLE t ADD INDEX (a);");
+  Fill("t", 5000);
+  Run("DELETE FROM t WHERE t.a < 4000;");
+  EXPECT_GT(Vacuum("t"), 0);
+  EXPECT_EQ(Run("SELECT * FROM t;").size(), 1001);
+  EXPECT_EQ(Run("SELECT * FROM t WHERE t.a = 4321;"),
+            std::vector<String>{"4321,v4321"});
+}
+
+TEST_F(VacuumTest, Errors) {
+  EXPECT_THROW(Run("VACUUM missing;"), TableException);
+  EXPECT_THROW(Run("VACUUM;"), ParserException);
+  Run("CREATE TABLE t(a INT, b VARCHAR(40));");
+  // 日志中记录的是记录位置，有活跃事务时不能整理
+  TransactionManager *pTxnManager = _pDB->GetTransactionManager();
+  Transaction *txn = pTxnManager->Begin();
+  EXPECT_THROW(Run("VACUUM t;"), TableBusyException);
+  pTxnManager->Commit(txn);
+  delete txn;
+  EXPECT_EQ(Vacuum("t"), 0);
+}
+
+}  // namespace thdb
@@ -0,0 +1,54 @@
+#ifndef THDB_TEST_UTILS_H_
+#define THDB_TEST_UTILS_H_
+
+#include <gtest/gtest.h>
+
+#include "backend/backend.h"
+#include "defines.h"
+#include "system/instance.h"
+
+namespace thdb {
+
+/**
+ * @brief 每个用例在当前目录下新建的空数据库上执行，结束时删除数据文件
+ */
+class DBTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    Clear();
+    Init();
+    _pDB = new Instance();
+  }
+
+  void TearDown() override {
+    delete _pDB;
+    Close();
+    Clear();
+  }
+
+  /**
+   * @brief 正常关闭后重新打开数据库
+   */
+  void Restart() {
+    delete _pDB;
+    Close();
+    _pDB = new Instance();
+  }
+
+  /**
+   * @brief 执行一条语句，返回最后一个结果的各行
+   */
+  std::vector<String> Run(const String &sSQL) {
+    std::vector<Result *> iResVec = Execute(_pDB, sSQL);
+    std::vector<String> iRowVec;
+    if (!iResVec.empty()) iRowVec = iResVec.back()->ToVector();
+    for (const auto &pRes : iResVec) delete pRes;
+    return iRowVec;
+  }
+
+  Instance *_pDB;
+};
+
+}  // namespace thdb
+
+#endif  // THDB_TEST_UTILS_H_
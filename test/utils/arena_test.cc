@@ -0,0 +1,132 @@
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "field/fields.h"
+#include "record/fixed_record.h"
+#include "settings.h"
+#include "test_utils.h"
+#include "utils/arena.h"
+
+namespace thdb {
+
+TEST(ArenaTest, ScopeSetsCurrentArena) {
+  EXPECT_EQ(Arena::Current(), nullptr);
+  Arena *pOuter = new Arena();
+  Arena *pInner = new Arena();
+  {
+    ArenaScope iOuter(pOuter);
+    EXPECT_EQ(Arena::Current(), pOuter);
+    {
+      ArenaScope iInner(pInner);
+      EXPECT_EQ(Arena::Current(), pInner);
+    }
+    EXPECT_EQ(Arena::Current(), pOuter);
+  }
+  EXPECT_EQ(Arena::Current(), nullptr);
+  pInner->Unref();
+  pOuter->Unref();
+  // 没有内存池时从堆上分配
+  void *pData = Arena::New(24);
+  memset(pData, 0xab, 24);
+  Arena::Delete(pData);
+  Arena::Delete(nullptr);
+}
+
+TEST(ArenaTest, ReusesFreedBlocksBySize) {
+  Arena *pArena = new Arena();
+  {
+    ArenaScope iScope(pArena);
+    void *pA = Arena::New(40);
+    void *pB = Arena::New(40);
+    EXPECT_EQ((uintptr_t)pA % 16, 0);
+    EXPECT_NE(pA, pB);
+    Arena::Delete(pA);
+    // 同一大小等级的分配复用释放的块，不同等级的分配不复用
+    void *pC = Arena::New(200);
+    EXPECT_NE(pC, pA);
+    EXPECT_EQ(Arena::New(33), pA);
+    Arena::Delete(pB);
+    Arena::Delete(pC);
+  }
+  pArena->Unref();
+}
+
+TEST(ArenaTest, ManyAllocationsSpanChunks) {
+  Arena *pArena = new Arena();
+  std::vector<uint32_t *> iDataVec;
+  {
+    ArenaScope iScope(pArena);
+    // 共约 ARENA_CHUNK_SIZE 的 10 倍，需要多个块
+    for (uint32_t i = 0; i < ARENA_CHUNK_SIZE / 10; ++i) {
+      Size nWords = 1 + i % 24;
+      uint32_t *pData = (uint32_t *)Arena::New(nWords * sizeof(uint32_t));
+      for (Size j = 0; j < nWords; ++j) pData[j] = i;
+      iDataVec.push_back(pData);
+    }
+    // 超过块大小四分之一的分配使用堆，释放后不影响池中的内容
+    void *pLarge = Arena::New(ARENA_CHUNK_SIZE);
+    memset(pLarge, 0xff, ARENA_CHUNK_SIZE);
+    Arena::Delete(pLarge);
+  }
+  for (uint32_t i = 0; i < iDataVec.size(); ++i)
+    for (Size j = 0; j < 1 + i % 24; ++j) ASSERT_EQ(iDataVec[i][j], i);
+  // 离开作用域后释放的块仍然归还到所属的内存池
+  for (const auto &pData : iDataVec) Arena::Delete(pData);
+  pArena->Unref();
+}
+
+TEST(ArenaTest, ChunksRecycledAcrossArenas) {
+  Arena *pFirst = new Arena();
+  void *pData;
+  {
+    ArenaScope iScope(pFirst);
+    pData = Arena::New(16);
+  }
+  pFirst->Unref();
+  // 销毁的内存池的块进入全局块池，下一个内存池首先使用它
+  Arena *pSecond = new Arena();
+  {
+    ArenaScope iScope(pSecond);
+    EXPECT_EQ(Arena::New(16), pData);
+  }
+  pSecond->Unref();
+}
+
+TEST(ArenaTest, RecordsAndFieldsInArena) {
+  Arena *pArena = new Arena();
+  Record *pCopy;
+  {
+    ArenaScope iScope(pArena);
+    FixedRecord *pRecord = new FixedRecord(
+        2, {FieldType::INT_TYPE, FieldType::STRING_TYPE}, {4, 16});
+    pRecord->SetField(0, new IntField(7));
+    pRecord->SetField(1, new StringField("arena"));
+    pCopy = pRecord->Copy();
+    delete pRecord;
+  }
+  EXPECT_EQ(pCopy->GetField(0)->ToString(), "7");
+  EXPECT_EQ(pCopy->GetField(1)->ToString(), "arena");
+  delete pCopy;
+  pArena->Unref();
+}
+
+class ArenaResultTest : public DBTest {};
+
+// 结果持有语句内存池的引用，语句执行结束后结果中的记录仍然有效
+TEST_F(ArenaResultTest, ResultOutlivesStatement) {
+  Run("CREATE TABLE t(a INT, b VARCHAR(20));");
+  Run("INSERT INTO t VALUES (1,'x'),(2,'y'),(3,'z');");
+  std::vector<Result *> iFirstVec =
+      Execute(_pDB, "SELECT * FROM t WHERE t.a >= 2;");
+  std::vector<Result *> iSecondVec = Execute(_pDB, "SELECT * FROM t;");
+  for (const auto &pRes : iSecondVec) delete pRes;
+  Run("INSERT INTO t VALUES (4,'w');");
+  ASSERT_EQ(iFirstVec.size(), 1);
+  EXPECT_EQ(iFirstVec[0]->ToVector(), (std::vector<String>{"2,y", "3,z"}));
+  for (const auto &pRes : iFirstVec) delete pRes;
+  EXPECT_EQ(Arena::Current(), nullptr);
+}
+
+}  // namespace thdb
@@ -0,0 +1,85 @@
+#include <cstdio>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "exception/exceptions.h"
+#include "settings.h"
+#include "utils/csv_reader.h"
+
+namespace thdb {
+
+static const char *CSV_PATH = "csv_reader_test.csv";
+
+class CsvReaderTest : public ::testing::Test {
+ protected:
+  void TearDown() override { std::remove(CSV_PATH); }
+
+  void WriteFile(const String &sContent) {
+    std::ofstream fout{CSV_PATH, std::ios::binary};
+    fout << sContent;
+  }
+
+  // 读出所有行，字段用'|'连接，带引号的字段前加'"'
+  std::vector<String> ReadAll(char cDelim = ',') {
+    CsvReader iReader(CSV_PATH, cDelim);
+    std::vector<CsvField> iFieldVec;
+    std::vector<String> iLineVec;
+    while (iReader.Next(iFieldVec)) {
+      String sLine;
+      for (Size i = 0; i < iFieldVec.size(); ++i) {
+        if (i > 0) sLine += "|";
+        if (iFieldVec[i].bQuoted) sLine += "\"";
+        sLine += String(iFieldVec[i].pData, iFieldVec[i].nSize);
+      }
+      iLineVec.push_back(sLine);
+    }
+    return iLineVec;
+  }
+};
+
+TEST_F(CsvReaderTest, SplitsFieldsAndSkipsEmptyLines) {
+  WriteFile("1,abc,2.5\n\n3,,x\r\n4,d,e");
+  std::vector<String> iExpected{"1|abc|2.5", "3||x", "4|d|e"};
+  EXPECT_EQ(ReadAll(), iExpected);
+}
+
+TEST_F(CsvReaderTest, QuotedFields) {
+  WriteFile("\"a,b\",\"\",\"say \"\"hi\"\"\"\n\"two\nlines\",z\n");
+  std::vector<String> iExpected{"\"a,b|\"|\"say \"hi\"", "\"two\nlines|z"};
+  EXPECT_EQ(ReadAll(), iExpected);
+}
+
+TEST_F(CsvReaderTest, CustomDelimiterAndLineNumbers) {
+  WriteFile("1|a,b\n\"x\ny\"|2\n3|c\n");
+  CsvReader iReader(CSV_PATH, '|');
+  std::vector<CsvField> iFieldVec;
+  ASSERT_TRUE(iReader.Next(iFieldVec));
+  EXPECT_EQ(iFieldVec.size(), 2);
+  EXPECT_EQ(String(iFieldVec[1].pData, iFieldVec[1].nSize), "a,b");
+  EXPECT_EQ(iReader.GetLine(), 1);
+  ASSERT_TRUE(iReader.Next(iFieldVec));
+  EXPECT_EQ(iReader.GetLine(), 2);
+  // 引号内的换行不计入新的一行
+  ASSERT_TRUE(iReader.Next(iFieldVec));
+  EXPECT_EQ(iReader.GetLine(), 4);
+  EXPECT_FALSE(iReader.Next(iFieldVec));
+}
+
+TEST_F(CsvReaderTest, LinesAcrossBufferRefills) {
+  // 一行比缓冲区更长，其余行跨越缓冲区边界
+  String sLong(COPY_BUFFER_SIZE * 2 + 17, 'q');
+  String sContent = "0," + sLong + "\n";
+  for (int i = 1; i < 20000; ++i) sContent += std::to_string(i) + ",v\n";
+  WriteFile(sContent);
+  std::vector<String> iLineVec = ReadAll();
+  ASSERT_EQ(iLineVec.size(), 20000);
+  EXPECT_EQ(iLineVec[0], "0|" + sLong);
+  EXPECT_EQ(iLineVec[19999], "19999|v");
+}
+
+TEST_F(CsvReaderTest, MissingFileThrows) {
+  EXPECT_THROW(CsvReader("no_such_file.csv"), LoadException);
+}
+
+}  // namespace thdb